@@ -358,6 +358,46 @@ void EPD_7IN5B_V2_Display_Partial(const UBYTE *Image, UWORD Xstart, UWORD Ystart
     EPD_7IN5B_V2_SendCommand(0x92);
 }
 
+/******************************************************************************
+function :	Start sending one plane row by row
+parameter:
+    Plane : EPD_7IN5B_V2_PLANE_BLACK, then EPD_7IN5B_V2_PLANE_RED
+info:
+    Same sequence as EPD_7IN5B_V2_Display, for images rendered in strips:
+    Begin a plane, send all of its rows, begin the next plane, send its
+    rows, then End refreshes the panel.
+******************************************************************************/
+void EPD_7IN5B_V2_Display_Begin(UBYTE Plane)
+{
+    if (Plane == EPD_7IN5B_V2_PLANE_RED)
+        EPD_7IN5B_V2_SendCommand(0x92);
+    EPD_7IN5B_V2_SendCommand(Plane);
+}
+
+/******************************************************************************
+function :	Send the next rows of the current plane
+parameter:
+    Image : Rows of EPD_7IN5B_V2_WIDTH / 8 bytes, 1 = white
+    Rows  : Number of rows
+    Plane : Plane being sent, the red plane is inverted on the way
+******************************************************************************/
+void EPD_7IN5B_V2_Display_Rows(const UBYTE *Image, UWORD Rows, UBYTE Plane)
+{
+    UDOUBLE Width, Count;
+    Width =(EPD_7IN5B_V2_WIDTH % 8 == 0)?(EPD_7IN5B_V2_WIDTH / 8 ):(EPD_7IN5B_V2_WIDTH / 8 + 1);
+    Count = Width * Rows;
+    UBYTE Invert = (Plane == EPD_7IN5B_V2_PLANE_RED) ? 0xFF : 0x00;
+
+    for (UDOUBLE i = 0; i < Count; i++) {
+        EPD_7IN5B_V2_SendData(Image[i] ^ Invert);
+    }
+}
+
+void EPD_7IN5B_V2_Display_End(void)
+{
+    EPD_7IN5B_V2_TurnOnDisplay();
+}
+
 /******************************************************************************
 function :	Enter sleep mode
 parameter:
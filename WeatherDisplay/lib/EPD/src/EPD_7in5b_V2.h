@@ -40,6 +40,10 @@
 #define EPD_7IN5B_V2_WIDTH       800
 #define EPD_7IN5B_V2_HEIGHT      480
 
+// Image planes, as written to the panel RAM
+#define EPD_7IN5B_V2_PLANE_BLACK 0x10
+#define EPD_7IN5B_V2_PLANE_RED   0x13
+
 UBYTE EPD_7IN5B_V2_Init(void);
 UBYTE EPD_7IN5B_V2_Init_Fast(void);
 UBYTE EPD_7IN5B_V2_Init_Part(void);
@@ -50,6 +54,9 @@ void EPD_7IN5B_V2_Display(const UBYTE *blackimage, const UBYTE *ryimage);
 void EPD_7IN5B_V2_Display_Fast(const UBYTE *blackimage);
 void EPD_7IN5B_V2_Display_Base_color(UBYTE color);
 void EPD_7IN5B_V2_Display_Partial(const UBYTE *Image, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void EPD_7IN5B_V2_Display_Begin(UBYTE Plane);
+void EPD_7IN5B_V2_Display_Rows(const UBYTE *Image, UWORD Rows, UBYTE Plane);
+void EPD_7IN5B_V2_Display_End(void);
 void EPD_7IN5B_V2_Sleep(void);
 
 #endif
@@ -1373,12 +1373,36 @@ const uint8_t Font12_Table[] =
 	0x00, //        
 	0x00, //        
 	0x00, //        
+
+	// @1140 degree sign in place of DEL (7 pixels wide)
+	0x00, //        
+	0x38, //  ###   
+	0x6C, // ## ##  
+	0x6C, // ## ##  
+	0x38, //  ###   
+	0x00, //        
+	0x00, //        
+	0x00, //        
+	0x00, //        
+	0x00, //        
+	0x00, //        
+	0x00, //        
 };
 
 sFONT Font12 = {
   Font12_Table,
   7, /* Width */
   12, /* Height */
+  0, /* Glyphs: cells of Width from ' ' */
+  0, /* First */
+  0, /* Last */
+  FONT_ENCODING_BITS,
+  0, /* Map */
+  0, /* Fallback */
+  0, /* Ranges */
+  0, /* RangeCount */
+  0, /* Kerning: none */
+  0, /* KernCount */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
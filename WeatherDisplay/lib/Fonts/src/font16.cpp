@@ -1753,12 +1753,40 @@ const uint8_t Font16_Table[] =
 	0x00, 0x00, //            
 	0x00, 0x00, //            
 	0x00, 0x00, //            
+
+	// @3040 degree sign in place of DEL (11 pixels wide)
+	0x00, 0x00, //            
+	0x0E, 0x00, //    ###     
+	0x1B, 0x00, //   ## ##    
+	0x11, 0x00, //   #   #    
+	0x1B, 0x00, //   ## ##    
+	0x0E, 0x00, //    ###     
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
 };
 
 sFONT Font16 = {
   Font16_Table,
   11, /* Width */
   16, /* Height */
+  0, /* Glyphs: cells of Width from ' ' */
+  0, /* First */
+  0, /* Last */
+  FONT_ENCODING_BITS,
+  0, /* Map */
+  0, /* Fallback */
+  0, /* Ranges */
+  0, /* RangeCount */
+  0, /* Kerning: none */
+  0, /* KernCount */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
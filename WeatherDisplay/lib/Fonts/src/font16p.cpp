@@ -0,0 +1,1255 @@
+/**
+  ******************************************************************************
+  * @file    font16p.cpp
+  * @brief   Proportional version of Font16: every glyph is cut to its ink
+  *          and packed without row padding, see sGLYPH in fonts.h.
+  *          Rows equal to the one above are stored as a single bit
+  *          (FONT_ENCODING_ROWS).
+  *          Generated by tools/fontgen, do not edit:
+  *          fontgen -e ROWS -n Font16P -o font16p.cpp font16.cpp
+  ******************************************************************************
+  */
+
+#include "fonts.h"
+
+const uint8_t Font16P_Table[] =
+{
+	// @0 '!' (2x10)
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//  
+	//##
+	0x7F, 0xC3,
+
+	// @2 '"' (7x5)
+	//### ###
+	//### ###
+	// #   # 
+	// #   # 
+	// #   # 
+	0x77, 0x91, 0x60,
+
+	// @5 '#' (8x11)
+	//  ## ## 
+	//  ## ## 
+	//  ## ## 
+	//  ## ## 
+	//########
+	// ## ##  
+	//########
+	// ## ##  
+	// ## ##  
+	// ## ##  
+	// ## ##  
+	0x1B, 0x77, 0xF9, 0xB1, 0xFE, 0x6C, 0xE0,
+
+	// @12 '$' (7x13)
+	//   #   
+	// ######
+	//##   ##
+	//##   ##
+	//###    
+	// ####  
+	//  #### 
+	//    ###
+	//##   ##
+	//##   ##
+	//###### 
+	//   #   
+	//   #   
+	0x08, 0x3F, 0x63, 0xB8, 0x1E, 0x0F, 0x03, 0xB1, 0xDF, 0x82, 0x20,
+
+	// @23 '%' (8x10)
+	// ##     
+	//#  #    
+	//#  #    
+	// ##   ##
+	//   #### 
+	// ####   
+	//##   ## 
+	//    #  #
+	//    #  #
+	//     ## 
+	0x30, 0x24, 0x26, 0x30, 0xF1, 0xE1, 0x8C, 0x09, 0x81, 0x80,
+
+	// @33 '&' (7x9)
+	//  #### 
+	// ##    
+	// ##    
+	// ##    
+	//  ##   
+	// ### ##
+	//## ### 
+	//##  ## 
+	// ### ##
+	0x1E, 0x30, 0xC6, 0x0E, 0xDB, 0x99, 0x8E, 0xC0,
+
+	// @41 ''' (3x5)
+	//###
+	//###
+	// # 
+	// # 
+	// # 
+	0x79, 0x60,
+
+	// @43 '(' (4x12)
+	//  ##
+	//  ##
+	// ## 
+	//### 
+	//##  
+	//##  
+	//##  
+	//##  
+	//### 
+	// ## 
+	//  ##
+	//  ##
+	0x1C, 0xCE, 0x67, 0x71, 0x87,
+
+	// @48 ')' (4x12)
+	//##  
+	//##  
+	// ## 
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	// ## 
+	//### 
+	//##  
+	0x64, 0xC3, 0xF9, 0x9C, 0xC0,
+
+	// @53 '*' (8x7)
+	//   ##   
+	//   ##   
+	//########
+	//########
+	//  ####  
+	// ###### 
+	// ##  ## 
+	0x0C, 0x5F, 0xF1, 0xE1, 0xF8, 0xCC,
+
+	// @59 '+' (7x7)
+	//   #   
+	//   #   
+	//   #   
+	//#######
+	//   #   
+	//   #   
+	//   #   
+	0x08, 0xDF, 0xC2, 0x30,
+
+	// @63 ',' (3x5)
+	// ##
+	// # 
+	//## 
+	//#  
+	//#  
+	0x32, 0x64, 0x80,
+
+	// @66 '-' (7x1)
+	//#######
+	0x7F,
+
+	// @67 '.' (2x2)
+	//##
+	//##
+	0x70,
+
+	// @68 '/' (8x13)
+	//      ##
+	//      ##
+	//     ## 
+	//     ## 
+	//    ##  
+	//    ##  
+	//   ##   
+	//  ##    
+	//  ##    
+	// ##     
+	// ##     
+	//##      
+	//##      
+	0x01, 0xC0, 0xD0, 0x64, 0x30, 0x30, 0x98, 0x2C, 0x08,
+
+	// @77 '0' (7x10)
+	//  ###  
+	// ## ## 
+	//##   ##
+	//##   ##
+	//##   ##
+	//##   ##
+	//##   ##
+	//##   ##
+	// ## ## 
+	//  ###  
+	0x1C, 0x36, 0x63, 0xF9, 0xB0, 0xE0,
+
+	// @83 '1' (8x10)
+	//   ##   
+	//#####   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//########
+	0x0C, 0x3E, 0x03, 0x1F, 0xBF, 0xC0,
+
+	// @89 '2' (7x10)
+	//  #### 
+	// ##  ##
+	//##   ##
+	//##   ##
+	//    ## 
+	//   ##  
+	//  ##   
+	// ##    
+	//##     
+	//#######
+	0x1E, 0x33, 0x63, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x3F, 0x80,
+
+	// @99 '3' (8x10)
+	// ###### 
+	//##    ##
+	//      ##
+	//     ## 
+	//  ##### 
+	//     ###
+	//      ##
+	//      ##
+	//##    ##
+	// ###### 
+	0x3F, 0x30, 0xC0, 0x60, 0x61, 0xF0, 0x1C, 0x07, 0x61, 0x9F, 0x80,
+
+	// @110 '4' (7x10)
+	//   ### 
+	//   ### 
+	//  #### 
+	//  # ## 
+	// ## ## 
+	// #  ## 
+	//##  ## 
+	//#######
+	//    ## 
+	//  #####
+	0x0E, 0x8F, 0x0B, 0x1B, 0x13, 0x33, 0x3F, 0x83, 0x0F, 0x80,
+
+	// @120 '5' (7x10)
+	// ######
+	// ##    
+	// ##    
+	// ##    
+	// ##### 
+	// #   ##
+	//     ##
+	//     ##
+	//#    ##
+	// ##### 
+	0x3F, 0x30, 0xCF, 0x88, 0xC0, 0xE8, 0x67, 0xC0,
+
+	// @128 '6' (7x10)
+	//   ####
+	// ###   
+	// ##    
+	//##     
+	//## ### 
+	//###  ##
+	//##   ##
+	//##   ##
+	// ##  ##
+	//  #### 
+	0x0F, 0x38, 0x30, 0x60, 0x6E, 0x73, 0x63, 0x99, 0x8F, 0x00,
+
+	// @138 '7' (7x10)
+	//#######
+	//#    ##
+	//     ##
+	//    ## 
+	//    ## 
+	//    ## 
+	//    ## 
+	//   ##  
+	//   ##  
+	//   ##  
+	0x7F, 0x43, 0x03, 0x06, 0xE1, 0x98,
+
+	// @144 '8' (7x10)
+	// ##### 
+	//##   ##
+	//##   ##
+	//##   ##
+	// ##### 
+	//##   ##
+	//##   ##
+	//##   ##
+	//##   ##
+	// ##### 
+	0x3E, 0x63, 0xCF, 0x98, 0xF9, 0xF0,
+
+	// @150 '9' (7x10)
+	// ####  
+	//##  ## 
+	//##   ##
+	//##   ##
+	//##  ###
+	// ### ##
+	//     ##
+	//    ## 
+	//   ### 
+	//####   
+	0x3C, 0x66, 0x63, 0xB3, 0x9D, 0x81, 0x83, 0x07, 0x3C, 0x00,
+
+	// @160 ':' (2x7)
+	//##
+	//##
+	//  
+	//  
+	//  
+	//##
+	//##
+	0x71, 0xB8,
+
+	// @162 ';' (4x9)
+	//  ##
+	//  ##
+	//    
+	//    
+	//    
+	// ## 
+	// #  
+	//#   
+	//#   
+	0x1C, 0x19, 0x88, 0x88,
+
+	// @166 '<' (9x9)
+	//       ##
+	//     ##  
+	//    #    
+	//  ##     
+	//##       
+	//  ##     
+	//    #    
+	//     ##  
+	//       ##
+	0x00, 0xC0, 0xC0, 0x40, 0x60, 0x60, 0x06, 0x00, 0x40, 0x0C, 0x00, 0xC0,
+
+	// @178 '=' (9x3)
+	//#########
+	//         
+	//#########
+	0x7F, 0xC0, 0x07, 0xFC,
+
+	// @182 '>' (9x9)
+	//##       
+	//  ##     
+	//    #    
+	//     ##  
+	//       ##
+	//     ##  
+	//    #    
+	//  ##     
+	//##       
+	0x60, 0x06, 0x00, 0x40, 0x0C, 0x00, 0xC0, 0xC0, 0x40, 0x60, 0x60, 0x00,
+
+	// @194 '?' (7x9)
+	// ##### 
+	//##   ##
+	//##   ##
+	//     ##
+	//   ### 
+	//  ##   
+	//  ##   
+	//       
+	//  ##   
+	0x3E, 0x63, 0x81, 0x87, 0x0C, 0x40, 0x06, 0x00,
+
+	// @202 '@' (6x11)
+	//  ### 
+	// #   #
+	//#    #
+	//#    #
+	//#  ###
+	//# #  #
+	//# #  #
+	//#  ###
+	//#     
+	// #   #
+	//  ### 
+	0x1C, 0x45, 0x0D, 0x3A, 0x9A, 0x74, 0x04, 0x47, 0x00,
+
+	// @211 'A' (10x9)
+	// ######   
+	//   ####   
+	//   #  #   
+	//  ##  ##  
+	//  ##  ##  
+	//  ######  
+	// ##    ## 
+	// ##    ## 
+	//####  ####
+	0x3F, 0x01, 0xE0, 0x24, 0x0C, 0xC8, 0xFC, 0x30, 0xD7, 0x9E,
+
+	// @221 'B' (8x9)
+	//####### 
+	// ##   ##
+	// ##   ##
+	// ##   ##
+	// ###### 
+	// ##   ##
+	// ##   ##
+	// ##   ##
+	//####### 
+	0x7F, 0x18, 0xF3, 0xF1, 0x8F, 0x7F, 0x00,
+
+	// @228 'C' (9x9)
+	//  ##### #
+	// ##    ##
+	//##      #
+	//##       
+	//##       
+	//##       
+	//##      #
+	// ##    # 
+	//  #####  
+	0x1F, 0x4C, 0x36, 0x05, 0x80, 0xD8, 0x13, 0x08, 0x7C,
+
+	// @237 'D' (9x9)
+	//#######  
+	// ##   ## 
+	// ##    ##
+	// ##    ##
+	// ##    ##
+	// ##    ##
+	// ##    ##
+	// ##   ## 
+	//#######  
+	0x7F, 0x0C, 0x63, 0x0F, 0xCC, 0x67, 0xF0,
+
+	// @244 'E' (8x9)
+	//########
+	// ##    #
+	// ##    #
+	// ##  #  
+	// #####  
+	// ##  #  
+	// ##    #
+	// ##    #
+	//########
+	0x7F, 0x98, 0x66, 0x43, 0xE1, 0x90, 0xC3, 0x7F, 0x80,
+
+	// @253 'F' (9x9)
+	//#########
+	// ##     #
+	// ##     #
+	// ##  #   
+	// #####   
+	// ##  #   
+	// ##      
+	// ##      
+	//#####    
+	0x7F, 0xCC, 0x19, 0x90, 0x7C, 0x19, 0x06, 0x05, 0xF0,
+
+	// @262 'G' (9x9)
+	//  #### # 
+	// ##   ## 
+	//##     # 
+	//##       
+	//##       
+	//##  #####
+	//##    ## 
+	// ##   ## 
+	//  #####  
+	0x1E, 0x8C, 0x66, 0x09, 0x80, 0xB3, 0xEC, 0x31, 0x8C, 0x3E, 0x00,
+
+	// @273 'H' (9x9)
+	//#### ####
+	// ##   ## 
+	// ##   ## 
+	// ##   ## 
+	// ####### 
+	// ##   ## 
+	// ##   ## 
+	// ##   ## 
+	//#### ####
+	0x7B, 0xCC, 0x6C, 0xFE, 0x31, 0xB7, 0xBC,
+
+	// @280 'I' (8x9)
+	//########
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//########
+	0x7F, 0x86, 0x3F, 0x7F, 0x80,
+
+	// @285 'J' (9x9)
+	//  #######
+	//     ##  
+	//     ##  
+	//     ##  
+	//     ##  
+	//##   ##  
+	//##   ##  
+	//##   ##  
+	// #####   
+	0x1F, 0xC0, 0xCE, 0xC6, 0x67, 0xC0,
+
+	// @291 'K' (9x9)
+	//#### ####
+	// ##   ## 
+	// ##  ##  
+	// ## ##   
+	// ####    
+	// #####   
+	// ##  ##  
+	// ##   ## 
+	//####  ###
+	0x7B, 0xCC, 0x63, 0x30, 0xD8, 0x3C, 0x0F, 0x83, 0x30, 0xC6, 0x79, 0xC0,
+
+	// @303 'L' (9x9)
+	//######   
+	//  ##     
+	//  ##     
+	//  ##     
+	//  ##     
+	//  ##    #
+	//  ##    #
+	//  ##    #
+	//#########
+	0x7E, 0x06, 0x0E, 0x30, 0xEF, 0xF8,
+
+	// @309 'M' (11x9)
+	//###     ###
+	// ##     ## 
+	// ###   ### 
+	// #### #### 
+	// ## # # ## 
+	// ## ### ## 
+	// ##  #  ## 
+	// ##     ## 
+	//##### #####
+	0x70, 0x73, 0x06, 0x38, 0xE3, 0xDE, 0x35, 0x63, 0x76, 0x32, 0x63, 0x06, 0x7D, 0xF0,
+
+	// @323 'N' (9x9)
+	//###  ####
+	// ##   ## 
+	// ###  ## 
+	// #### ## 
+	// ## # ## 
+	// ## #### 
+	// ##  ### 
+	// ##   ## 
+	//####  ## 
+	0x73, 0xCC, 0x63, 0x98, 0xF6, 0x35, 0x8D, 0xE3, 0x38, 0xC6, 0x79, 0x80,
+
+	// @335 'O' (9x9)
+	//  #####  
+	// ##   ## 
+	//##     ##
+	//##     ##
+	//##     ##
+	//##     ##
+	//##     ##
+	// ##   ## 
+	//  #####  
+	0x1F, 0x0C, 0x66, 0x0F, 0xCC, 0x61, 0xF0,
+
+	// @342 'P' (8x9)
+	//####### 
+	// ##   ##
+	// ##   ##
+	// ##   ##
+	// ##   ##
+	// ###### 
+	// ##     
+	// ##     
+	//######  
+	0x7F, 0x18, 0xF9, 0xF8, 0xC1, 0x7E, 0x00,
+
+	// @349 'Q' (9x11)
+	//  #####  
+	// ##   ## 
+	//##     ##
+	//##     ##
+	//##     ##
+	//##     ##
+	//##     ##
+	// ##   ## 
+	//  #####  
+	//   ##  ##
+	//  ###### 
+	0x1F, 0x0C, 0x66, 0x0F, 0xCC, 0x61, 0xF0, 0x33, 0x1F, 0x80,
+
+	// @359 'R' (10x9)
+	//#######   
+	// ##   ##  
+	// ##   ##  
+	// ##   ##  
+	// #####    
+	// ##  ##   
+	// ##   ##  
+	// ##   ##  
+	//#####  ###
+	0x7F, 0x06, 0x33, 0x3E, 0x06, 0x60, 0xC6, 0x5F, 0x38,
+
+	// @368 'S' (7x9)
+	// ######
+	//##   ##
+	//##   ##
+	//###    
+	// ##### 
+	//    ###
+	//##   ##
+	//##   ##
+	//###### 
+	0x3F, 0x63, 0xB8, 0x1F, 0x03, 0xB1, 0xDF, 0x80,
+
+	// @376 'T' (8x9)
+	//########
+	//#  ##  #
+	//#  ##  #
+	//#  ##  #
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	// ###### 
+	0x7F, 0xA6, 0x70, 0xC7, 0x3F, 0x00,
+
+	// @382 'U' (9x9)
+	//#### ####
+	// ##   ## 
+	// ##   ## 
+	// ##   ## 
+	// ##   ## 
+	// ##   ## 
+	// ##   ## 
+	// ##   ## 
+	//  #####  
+	0x7B, 0xCC, 0x6F, 0xC7, 0xC0,
+
+	// @387 'V' (9x9)
+	//#### ####
+	// ##   ## 
+	// ##   ## 
+	//  ## ##  
+	//  ## ##  
+	//  ## ##  
+	//   # #   
+	//   ###   
+	//   ###   
+	0x7B, 0xCC, 0x68, 0xD9, 0x85, 0x01, 0xC4,
+
+	// @394 'W' (11x9)
+	//##### #####
+	// ##     ## 
+	// ##  #  ## 
+	// ## ### ## 
+	// ## ### ## 
+	//  # # # #  
+	//  ### ###  
+	//  ### ###  
+	//  ##   ##  
+	0x7D, 0xF3, 0x06, 0x32, 0x63, 0x76, 0x8A, 0xA0, 0xEE, 0x46, 0x30,
+
+	// @405 'X' (9x9)
+	//#### ####
+	// ##   ## 
+	//  ## ##  
+	//   ###   
+	//   ###   
+	//   ###   
+	//  ## ##  
+	// ##   ## 
+	//#### ####
+	0x7B, 0xCC, 0x61, 0xB0, 0x38, 0xC6, 0xC3, 0x19, 0xEF,
+
+	// @414 'Y' (10x9)
+	//####  ####
+	// ##    ## 
+	//  ##  ##  
+	//   ####   
+	//    ##    
+	//    ##    
+	//    ##    
+	//    ##    
+	//  ######  
+	0x79, 0xE6, 0x18, 0x66, 0x07, 0x80, 0x61, 0xC7, 0xE0,
+
+	// @423 'Z' (7x9)
+	//#######
+	//#    ##
+	//#   ## 
+	//   ##  
+	//   #   
+	//  ##   
+	// ##   #
+	//##    #
+	//#######
+	0x7F, 0x43, 0x46, 0x0C, 0x08, 0x18, 0x31, 0x61, 0x7F,
+
+	// @432 '[' (4x12)
+	//####
+	//##  
+	//##  
+	//##  
+	//##  
+	//##  
+	//##  
+	//##  
+	//##  
+	//##  
+	//##  
+	//####
+	0x7B, 0x3F, 0xEF,
+
+	// @435 '\' (8x13)
+	//##      
+	//##      
+	// ##     
+	// ##     
+	//  ##    
+	//  ##    
+	//   ##   
+	//    ##  
+	//    ##  
+	//     ## 
+	//     ## 
+	//      ##
+	//      ##
+	0x60, 0x4C, 0x11, 0x84, 0x30, 0x0C, 0x81, 0xA0, 0x38,
+
+	// @444 ']' (4x12)
+	//####
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	//####
+	0x78, 0xFF, 0xEF,
+
+	// @447 '^' (7x6)
+	//   #   
+	//  # #  
+	//  # #  
+	// #   # 
+	//#     #
+	//#     #
+	0x08, 0x14, 0x91, 0x20, 0xC0,
+
+	// @452 '_' (11x1)
+	//###########
+	0x7F, 0xF0,
+
+	// @454 '`' (3x3)
+	//#  
+	// # 
+	//  #
+	0x42, 0x10,
+
+	// @456 'a' (8x7)
+	// #####  
+	//     ## 
+	//     ## 
+	// ###### 
+	//##   ## 
+	//##  ### 
+	// ### ###
+	0x3E, 0x01, 0xA7, 0xE6, 0x33, 0x38, 0xEE,
+
+	// @463 'b' (9x10)
+	//###      
+	// ##      
+	// ##      
+	// ## ###  
+	// ###  ## 
+	// ##    ##
+	// ##    ##
+	// ##    ##
+	// ###  ## 
+	//### ###  
+	0x70, 0x0C, 0x09, 0xB8, 0x73, 0x18, 0x79, 0xCC, 0xEE, 0x00,
+
+	// @473 'c' (8x7)
+	//  #### #
+	// ##   ##
+	//##     #
+	//##      
+	//##     #
+	// ##   ##
+	//  ##### 
+	0x1E, 0x98, 0xD8, 0x2C, 0x06, 0x09, 0x8C, 0x7C,
+
+	// @481 'd' (9x10)
+	//     ### 
+	//      ## 
+	//      ## 
+	//  ### ## 
+	// ##  ### 
+	//##    ## 
+	//##    ## 
+	//##    ## 
+	// ##  ### 
+	//  ### ###
+	0x03, 0x80, 0x68, 0xEC, 0x67, 0x30, 0xD9, 0x9C, 0x3B, 0x80,
+
+	// @491 'e' (9x7)
+	//  #####  
+	// ##   ## 
+	//##     ##
+	//#########
+	//##       
+	// ##    ##
+	//  ###### 
+	0x1F, 0x0C, 0x66, 0x0D, 0xFF, 0x60, 0x0C, 0x31, 0xF8,
+
+	// @500 'f' (9x10)
+	//   ######
+	//  ##     
+	//  ##     
+	//#######  
+	//  ##     
+	//  ##     
+	//  ##     
+	//  ##     
+	//  ##     
+	//#######  
+	0x0F, 0xC6, 0x0B, 0xF8, 0x30, 0x7B, 0xF8,
+
+	// @507 'g' (9x10)
+	//  ### ###
+	// ##  ### 
+	//##    ## 
+	//##    ## 
+	//##    ## 
+	// ##  ### 
+	//  ### ## 
+	//      ## 
+	//      ## 
+	//  #####  
+	0x1D, 0xCC, 0xE6, 0x1B, 0x33, 0x87, 0x60, 0x1A, 0x3E, 0x00,
+
+	// @517 'h' (9x10)
+	//###      
+	// ##      
+	// ##      
+	// ## ###  
+	// ###  ## 
+	// ##   ## 
+	// ##   ## 
+	// ##   ## 
+	// ##   ## 
+	//#### ####
+	0x70, 0x0C, 0x09, 0xB8, 0x73, 0x18, 0xDD, 0xEF,
+
+	// @525 'i' (8x10)
+	//   ##   
+	//   ##   
+	//        
+	// ####   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//########
+	0x0C, 0x40, 0x07, 0x80, 0xC7, 0xBF, 0xC0,
+
+	// @532 'j' (6x13)
+	//   ## 
+	//   ## 
+	//      
+	//######
+	//    ##
+	//    ##
+	//    ##
+	//    ##
+	//    ##
+	//    ##
+	//    ##
+	//    ##
+	//##### 
+	0x0D, 0x00, 0xFC, 0x1F, 0xF7, 0xC0,
+
+	// @538 'k' (9x10)
+	//###      
+	// ##      
+	// ##      
+	// ## #### 
+	// ## ##   
+	// ####    
+	// ####    
+	// ## ##   
+	// ##  ##  
+	//### #####
+	0x70, 0x0C, 0x09, 0xBC, 0x6C, 0x1E, 0x13, 0x60, 0xCC, 0x77, 0xC0,
+
+	// @549 'l' (8x10)
+	// ####   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//########
+	0x3C, 0x06, 0x3F, 0xBF, 0xC0,
+
+	// @554 'm' (10x7)
+	//########  
+	// ## ## ## 
+	// ## ## ## 
+	// ## ## ## 
+	// ## ## ## 
+	// ## ## ## 
+	//### ## ###
+	0x7F, 0x86, 0xDB, 0xDD, 0xB8,
+
+	// @559 'n' (9x7)
+	//### ###  
+	// ###  ## 
+	// ##   ## 
+	// ##   ## 
+	// ##   ## 
+	// ##   ## 
+	//#### ####
+	0x77, 0x0E, 0x63, 0x1B, 0xBD, 0xE0,
+
+	// @565 'o' (9x7)
+	//  #####  
+	// ##   ## 
+	//##     ##
+	//##     ##
+	//##     ##
+	// ##   ## 
+	//  #####  
+	0x1F, 0x0C, 0x66, 0x0F, 0x31, 0x87, 0xC0,
+
+	// @572 'p' (9x10)
+	//### ###  
+	// ###  ## 
+	// ##    ##
+	// ##    ##
+	// ##    ##
+	// ###  ## 
+	// ## ###  
+	// ##      
+	// ##      
+	//#####    
+	0x77, 0x0E, 0x63, 0x0F, 0x39, 0x8D, 0xC3, 0x02, 0xF8, 0x00,
+
+	// @582 'q' (9x10)
+	//  ### ###
+	// ##  ### 
+	//##    ## 
+	//##    ## 
+	//##    ## 
+	// ##  ### 
+	//  ### ## 
+	//      ## 
+	//      ## 
+	//    #####
+	0x1D, 0xCC, 0xE6, 0x1B, 0x33, 0x87, 0x60, 0x1A, 0x0F, 0x80,
+
+	// @592 'r' (9x7)
+	//#### ### 
+	//  ###  ##
+	//  ##     
+	//  ##     
+	//  ##     
+	//  ##     
+	//#######  
+	0x7B, 0x87, 0x31, 0x83, 0xBF, 0x80,
+
+	// @598 's' (7x7)
+	// ######
+	//##   ##
+	//####   
+	// ##### 
+	//    ###
+	//##   ##
+	//###### 
+	0x3F, 0x63, 0x78, 0x3E, 0x07, 0x63, 0x7E,
+
+	// @605 't' (8x10)
+	//  ##    
+	//  ##    
+	//  ##    
+	//####### 
+	//  ##    
+	//  ##    
+	//  ##    
+	//  ##    
+	//  ##   #
+	//   #### 
+	0x18, 0x6F, 0xE1, 0x87, 0x18, 0x87, 0x80,
+
+	// @612 'u' (9x7)
+	//###  ### 
+	// ##   ## 
+	// ##   ## 
+	// ##   ## 
+	// ##   ## 
+	// ##  ### 
+	//  ### ###
+	0x73, 0x8C, 0x6E, 0x67, 0x0E, 0xE0,
+
+	// @618 'v' (9x7)
+	//#### ####
+	// ##   ## 
+	// ##   ## 
+	//  ## ##  
+	//  ## ##  
+	//   ###   
+	//   ###   
+	0x7B, 0xCC, 0x68, 0xD9, 0x0E, 0x20,
+
+	// @624 'w' (11x7)
+	//####   ####
+	// ##     ## 
+	// ##  #  ## 
+	// ## ### ## 
+	//  ### ###  
+	//  ### ###  
+	//  ##   ##  
+	0x78, 0xF3, 0x06, 0x32, 0x63, 0x76, 0x1D, 0xC8, 0xC6, 0x00,
+
+	// @634 'x' (9x7)
+	//#### ####
+	//  ## ##  
+	//   ###   
+	//   ###   
+	//   ###   
+	//  ## ##  
+	//#### ####
+	0x7B, 0xC6, 0xC0, 0xE3, 0x1B, 0x1E, 0xF0,
+
+	// @641 'y' (10x10)
+	//####  ####
+	// ##    ## 
+	//  ##  ##  
+	//  ##  ##  
+	//   # ##   
+	//   ####   
+	//    ##    
+	//    ##    
+	//   ##     
+	// #####    
+	0x79, 0xE6, 0x18, 0x66, 0x42, 0xC0, 0x78, 0x06, 0x10, 0xC0, 0x7C, 0x00,
+
+	// @653 'z' (7x7)
+	//#######
+	//#    ##
+	//    ## 
+	//  ###  
+	// ##    
+	//##    #
+	//#######
+	0x7F, 0x43, 0x06, 0x1C, 0x30, 0x61, 0x7F,
+
+	// @660 '{' (4x12)
+	//  ##
+	// ## 
+	// ## 
+	// ## 
+	// ## 
+	// ## 
+	//##  
+	// ## 
+	// ## 
+	// ## 
+	// ## 
+	//  ##
+	0x19, 0xBD, 0x86, 0xE3,
+
+	// @664 '|' (2x12)
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	0x7F, 0xFC,
+
+	// @666 '}' (4x12)
+	//##  
+	// ## 
+	// ## 
+	// ## 
+	// ## 
+	// ## 
+	//  ##
+	// ## 
+	// ## 
+	// ## 
+	// ## 
+	//##  
+	0x61, 0xBC, 0x66, 0xEC,
+
+	// @670 '~' (7x3)
+	// ##    
+	//#  #  #
+	//    ## 
+	0x30, 0x49, 0x06,
+
+	// @673 degree sign (5x5)
+	// ### 
+	//## ##
+	//#   #
+	//## ##
+	// ### 
+	0x39, 0xB4, 0x5B, 0x38,
+};
+
+const sGLYPH Font16P_Glyphs[] =
+{
+	//Offset, Width, Height, Left, Top, Advance
+	{0, 0, 0, 0, 0, 6}, // ' '
+	{0, 2, 10, 1, 1, 3}, // '!'
+	{2, 7, 5, 1, 2, 8}, // '"'
+	{5, 8, 11, 1, 1, 9}, // '#'
+	{12, 7, 13, 1, 0, 8}, // '$'
+	{23, 8, 10, 1, 1, 9}, // '%'
+	{33, 7, 9, 1, 2, 8}, // '&'
+	{41, 3, 5, 1, 2, 4}, // '''
+	{43, 4, 12, 1, 1, 5}, // '('
+	{48, 4, 12, 1, 1, 5}, // ')'
+	{53, 8, 7, 1, 1, 9}, // '*'
+	{59, 7, 7, 1, 3, 8}, // '+'
+	{63, 3, 5, 1, 9, 4}, // ','
+	{66, 7, 1, 1, 6, 8}, // '-'
+	{67, 2, 2, 1, 9, 3}, // '.'
+	{68, 8, 13, 1, 0, 9}, // '/'
+	{77, 7, 10, 1, 1, 8}, // '0'
+	{83, 8, 10, 1, 1, 9}, // '1'
+	{89, 7, 10, 1, 1, 8}, // '2'
+	{99, 8, 10, 1, 1, 9}, // '3'
+	{110, 7, 10, 1, 1, 8}, // '4'
+	{120, 7, 10, 1, 1, 8}, // '5'
+	{128, 7, 10, 1, 1, 8}, // '6'
+	{138, 7, 10, 1, 1, 8}, // '7'
+	{144, 7, 10, 1, 1, 8}, // '8'
+	{150, 7, 10, 1, 1, 8}, // '9'
+	{160, 2, 7, 1, 4, 3}, // ':'
+	{162, 4, 9, 1, 4, 5}, // ';'
+	{166, 9, 9, 1, 2, 10}, // '<'
+	{178, 9, 3, 1, 5, 10}, // '='
+	{182, 9, 9, 1, 2, 10}, // '>'
+	{194, 7, 9, 1, 2, 8}, // '?'
+	{202, 6, 11, 1, 1, 7}, // '@'
+	{211, 10, 9, 1, 2, 11}, // 'A'
+	{221, 8, 9, 1, 2, 9}, // 'B'
+	{228, 9, 9, 1, 2, 10}, // 'C'
+	{237, 9, 9, 1, 2, 10}, // 'D'
+	{244, 8, 9, 1, 2, 9}, // 'E'
+	{253, 9, 9, 1, 2, 10}, // 'F'
+	{262, 9, 9, 1, 2, 10}, // 'G'
+	{273, 9, 9, 1, 2, 10}, // 'H'
+	{280, 8, 9, 1, 2, 9}, // 'I'
+	{285, 9, 9, 1, 2, 10}, // 'J'
+	{291, 9, 9, 1, 2, 10}, // 'K'
+	{303, 9, 9, 1, 2, 10}, // 'L'
+	{309, 11, 9, 1, 2, 12}, // 'M'
+	{323, 9, 9, 1, 2, 10}, // 'N'
+	{335, 9, 9, 1, 2, 10}, // 'O'
+	{342, 8, 9, 1, 2, 9}, // 'P'
+	{349, 9, 11, 1, 2, 10}, // 'Q'
+	{359, 10, 9, 1, 2, 11}, // 'R'
+	{368, 7, 9, 1, 2, 8}, // 'S'
+	{376, 8, 9, 1, 2, 9}, // 'T'
+	{382, 9, 9, 1, 2, 10}, // 'U'
+	{387, 9, 9, 1, 2, 10}, // 'V'
+	{394, 11, 9, 1, 2, 12}, // 'W'
+	{405, 9, 9, 1, 2, 10}, // 'X'
+	{414, 10, 9, 1, 2, 11}, // 'Y'
+	{423, 7, 9, 1, 2, 8}, // 'Z'
+	{432, 4, 12, 1, 1, 5}, // '['
+	{435, 8, 13, 1, 0, 9}, // '\'
+	{444, 4, 12, 1, 1, 5}, // ']'
+	{447, 7, 6, 1, 0, 8}, // '^'
+	{452, 11, 1, 1, 15, 12}, // '_'
+	{454, 3, 3, 1, 0, 4}, // '`'
+	{456, 8, 7, 1, 4, 9}, // 'a'
+	{463, 9, 10, 1, 1, 10}, // 'b'
+	{473, 8, 7, 1, 4, 9}, // 'c'
+	{481, 9, 10, 1, 1, 10}, // 'd'
+	{491, 9, 7, 1, 4, 10}, // 'e'
+	{500, 9, 10, 1, 1, 10}, // 'f'
+	{507, 9, 10, 1, 4, 10}, // 'g'
+	{517, 9, 10, 1, 1, 10}, // 'h'
+	{525, 8, 10, 1, 1, 9}, // 'i'
+	{532, 6, 13, 1, 1, 7}, // 'j'
+	{538, 9, 10, 1, 1, 10}, // 'k'
+	{549, 8, 10, 1, 1, 9}, // 'l'
+	{554, 10, 7, 1, 4, 11}, // 'm'
+	{559, 9, 7, 1, 4, 10}, // 'n'
+	{565, 9, 7, 1, 4, 10}, // 'o'
+	{572, 9, 10, 1, 4, 10}, // 'p'
+	{582, 9, 10, 1, 4, 10}, // 'q'
+	{592, 9, 7, 1, 4, 10}, // 'r'
+	{598, 7, 7, 1, 4, 8}, // 's'
+	{605, 8, 10, 1, 1, 9}, // 't'
+	{612, 9, 7, 1, 4, 10}, // 'u'
+	{618, 9, 7, 1, 4, 10}, // 'v'
+	{624, 11, 7, 1, 4, 12}, // 'w'
+	{634, 9, 7, 1, 4, 10}, // 'x'
+	{641, 10, 10, 1, 4, 11}, // 'y'
+	{653, 7, 7, 1, 4, 8}, // 'z'
+	{660, 4, 12, 1, 1, 5}, // '{'
+	{664, 2, 12, 1, 1, 3}, // '|'
+	{666, 4, 12, 1, 1, 5}, // '}'
+	{670, 7, 3, 1, 5, 8}, // '~'
+	{673, 5, 5, 1, 1, 6}, // degree sign
+	{673, 5, 5, 1, 1, 6}, // U+00B0
+};
+
+const sRANGE Font16P_Ranges[] =
+{
+	//First, Count, Index
+	{0x00B0, 1, 96}, // U+00B0
+};
+
+sFONT Font16P = {
+  Font16P_Table,
+  12, /* Width */
+  16, /* Height */
+  Font16P_Glyphs,
+  0x20, /* First */
+  0x7F, /* Last */
+  FONT_ENCODING_ROWS,
+  0, /* Map: every code from First to Last */
+  '?', /* Fallback */
+  Font16P_Ranges,
+  1, /* RangeCount */
+  0, /* Kerning: none */
+  0, /* KernCount */
+};
@@ -2130,6 +2130,28 @@ const uint8_t Font20_Table[] =
 	0x00, 0x00, //               
 	0x00, 0x00, //               
 	0x00, 0x00, //               
+
+	// @3800 degree sign in place of DEL (14 pixels wide)
+	0x00, 0x00, //               
+	0x00, 0x00, //               
+	0x07, 0x80, //     ####      
+	0x0C, 0xC0, //    ##  ##     
+	0x08, 0x40, //    #    #     
+	0x08, 0x40, //    #    #     
+	0x0C, 0xC0, //    ##  ##     
+	0x07, 0x80, //     ####      
+	0x00, 0x00, //               
+	0x00, 0x00, //               
+	0x00, 0x00, //               
+	0x00, 0x00, //               
+	0x00, 0x00, //               
+	0x00, 0x00, //               
+	0x00, 0x00, //               
+	0x00, 0x00, //               
+	0x00, 0x00, //               
+	0x00, 0x00, //               
+	0x00, 0x00, //               
+	0x00, 0x00, //               
 };
 
 
@@ -2137,6 +2159,16 @@ sFONT Font20 = {
   Font20_Table,
   14, /* Width */
   20, /* Height */
+  0, /* Glyphs: cells of Width from ' ' */
+  0, /* First */
+  0, /* Last */
+  FONT_ENCODING_BITS,
+  0, /* Map */
+  0, /* Fallback */
+  0, /* Ranges */
+  0, /* RangeCount */
+  0, /* Kerning: none */
+  0, /* KernCount */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
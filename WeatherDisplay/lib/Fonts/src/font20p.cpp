@@ -0,0 +1,1515 @@
+/**
+  ******************************************************************************
+  * @file    font20p.cpp
+  * @brief   Proportional version of Font20: every glyph is cut to its ink
+  *          and packed without row padding, see sGLYPH in fonts.h.
+  *          Rows equal to the one above are stored as a single bit
+  *          (FONT_ENCODING_ROWS).
+  *          Generated by tools/fontgen, do not edit:
+  *          fontgen -e ROWS -n Font20P -o font20p.cpp font20.cpp
+  ******************************************************************************
+  */
+
+#include "fonts.h"
+
+const uint8_t Font20P_Table[] =
+{
+	// @0 '!' (3x13)
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	// # 
+	// # 
+	//   
+	//   
+	//###
+	//###
+	0x7F, 0xCA, 0x17, 0x80,
+
+	// @4 '"' (8x6)
+	//###  ###
+	//###  ###
+	//###  ###
+	// #    # 
+	// #    # 
+	// #    # 
+	0x73, 0xE4, 0x2C,
+
+	// @7 '#' (10x16)
+	//  ##  ##  
+	//  ##  ##  
+	//  ##  ##  
+	//  ##  ##  
+	//  ##  ##  
+	//##########
+	//##########
+	//  ##  ##  
+	//  ##  ##  
+	//##########
+	//##########
+	//  ##  ##  
+	//  ##  ##  
+	//  ##  ##  
+	//  ##  ##  
+	//  ##  ##  
+	0x19, 0x9E, 0xFF, 0xE3, 0x32, 0xFF, 0xE3, 0x33, 0xC0,
+
+	// @16 '$' (8x16)
+	//   ##   
+	//   ##   
+	//  ######
+	// #######
+	//##    ##
+	//##      
+	//#####   
+	// ###### 
+	//     ###
+	//##    ##
+	//##    ##
+	//####### 
+	//######  
+	//   ##   
+	//   ##   
+	//   ##   
+	0x0C, 0x47, 0xE7, 0xF6, 0x1B, 0x01, 0xF0, 0x7E, 0x03, 0xB0, 0xEF, 0xE7, 0xE0, 0x63,
+
+	// @30 '%' (9x13)
+	// ###     
+	//#   #    
+	//#   #    
+	//#   #    
+	// ###   ##
+	//     ####
+	//  #####  
+	//####     
+	//##   ### 
+	//    #   #
+	//    #   #
+	//    #   #
+	//     ### 
+	0x38, 0x11, 0x0C, 0xE3, 0x03, 0xC7, 0xC7, 0x81, 0x8E, 0x04, 0x70, 0x38,
+
+	// @42 '&' (9x11)
+	//   ##### 
+	// ####### 
+	// ##      
+	// ##      
+	//  ##     
+	// ####  ##
+	//#########
+	//##  #### 
+	//##   ##  
+	//#########
+	//  #### ##
+	0x0F, 0x8F, 0xE3, 0x02, 0x30, 0x1E, 0x6F, 0xFB, 0x3C, 0xC6, 0x3F, 0xE3, 0xD8,
+
+	// @55 ''' (3x6)
+	//###
+	//###
+	//###
+	// # 
+	// # 
+	// # 
+	0x7C, 0xB0,
+
+	// @57 '(' (4x16)
+	//  ##
+	//  ##
+	// ## 
+	// ## 
+	// ## 
+	//##  
+	//##  
+	//##  
+	//##  
+	//##  
+	//##  
+	// ## 
+	// ## 
+	// ## 
+	//  ##
+	//  ##
+	0x1C, 0xDB, 0x3E, 0x6C, 0x70,
+
+	// @62 ')' (4x16)
+	//##  
+	//##  
+	// ## 
+	// ## 
+	// ## 
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	// ## 
+	// ## 
+	// ## 
+	//##  
+	//##  
+	0x64, 0xD8, 0xFE, 0x6D, 0x90,
+
+	// @67 '*' (8x9)
+	//   ##   
+	//   ##   
+	//   ##   
+	//## ## ##
+	//########
+	//  ####  
+	//  ####  
+	// ###### 
+	// ##  ## 
+	0x0C, 0x6D, 0xB7, 0xF8, 0xF2, 0x7E, 0x33, 0x00,
+
+	// @75 '+' (10x10)
+	//    ##    
+	//    ##    
+	//    ##    
+	//    ##    
+	//##########
+	//##########
+	//    ##    
+	//    ##    
+	//    ##    
+	//    ##    
+	0x06, 0x1D, 0xFF, 0xC1, 0x87,
+
+	// @80 ',' (4x6)
+	// ###
+	// ## 
+	// ## 
+	//##  
+	//##  
+	//#   
+	0x39, 0xAC, 0xA0,
+
+	// @83 '-' (9x2)
+	//#########
+	//#########
+	0x7F, 0xE0,
+
+	// @85 '.' (3x3)
+	//###
+	//###
+	//###
+	0x7C,
+
+	// @86 '/' (8x16)
+	//      ##
+	//      ##
+	//     ## 
+	//     ## 
+	//     ## 
+	//    ##  
+	//    ##  
+	//   ##   
+	//   ##   
+	//  ##    
+	//  ##    
+	// ##     
+	// ##     
+	// ##     
+	//##      
+	//##      
+	0x01, 0xC0, 0xD8, 0x32, 0x18, 0x8C, 0x26, 0x0D, 0x81,
+
+	// @95 '0' (9x13)
+	//  #####  
+	// ####### 
+	// ##   ## 
+	//##     ##
+	//##     ##
+	//##     ##
+	//##     ##
+	//##     ##
+	//##     ##
+	//##     ##
+	// ##   ## 
+	// ####### 
+	//  #####  
+	0x1F, 0x0F, 0xE3, 0x19, 0x83, 0xFC, 0xC6, 0x3F, 0x87, 0xC0,
+
+	// @105 '1' (8x13)
+	//   ##   
+	//#####   
+	//#####   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//########
+	//########
+	0x0C, 0x3E, 0x21, 0x8F, 0xEF, 0xF8,
+
+	// @111 '2' (9x13)
+	//  #####  
+	// ####### 
+	//###   ###
+	//##     ##
+	//       ##
+	//      ## 
+	//     ##  
+	//    ##   
+	//   ##    
+	//  ##     
+	// ##      
+	//#########
+	//#########
+	0x1F, 0x0F, 0xE7, 0x1D, 0x83, 0x00, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0xFF, 0x80,
+
+	// @127 '3' (10x13)
+	//   #####  
+	// ######## 
+	// ##    ###
+	//        ##
+	//       ###
+	//    ##### 
+	//    ##### 
+	//       ###
+	//        ##
+	//        ##
+	//##     ###
+	//######### 
+	// #######  
+	0x0F, 0x87, 0xF8, 0xC3, 0x80, 0x30, 0x0E, 0x0F, 0xA0, 0x1C, 0x01, 0xD8, 0x3B, 0xFE, 0x3F, 0x80,
+
+	// @143 '4' (9x13)
+	//     ### 
+	//    #### 
+	//    #### 
+	//   ## ## 
+	//  ##  ## 
+	//  ##  ## 
+	// ##   ## 
+	//##    ## 
+	//#########
+	//#########
+	//      ## 
+	//    #####
+	//    #####
+	0x03, 0x81, 0xE8, 0x6C, 0x33, 0x4C, 0x66, 0x19, 0xFF, 0x80, 0xC0, 0xFC,
+
+	// @155 '5' (9x13)
+	// ####### 
+	// ####### 
+	// ##      
+	// ##      
+	// ######  
+	// ####### 
+	// ##   ###
+	//       ##
+	//       ##
+	//       ##
+	//##    ###
+	//######## 
+	// ######  
+	0x3F, 0xA6, 0x04, 0xFC, 0x3F, 0x8C, 0x70, 0x0F, 0x61, 0xDF, 0xE3, 0xF0,
+
+	// @167 '6' (9x13)
+	//    #####
+	//  #######
+	// ####    
+	// ##      
+	//###      
+	//## ####  
+	//######## 
+	//###   ###
+	//##     ##
+	//##     ##
+	// ##   ###
+	// ####### 
+	//   ####  
+	0x07, 0xC7, 0xF3, 0xC0, 0xC0, 0x70, 0x1B, 0xC7, 0xF9, 0xC7, 0x60, 0xE6, 0x39, 0xFC, 0x1E, 0x00,
+
+	// @183 '7' (9x13)
+	//#########
+	//#########
+	//##     ##
+	//       ##
+	//      ## 
+	//      ## 
+	//      ## 
+	//     ##  
+	//     ##  
+	//     ##  
+	//    ##   
+	//    ##   
+	//    ##   
+	0x7F, 0xEC, 0x18, 0x06, 0x03, 0x60, 0x66, 0x0C, 0x60,
+
+	// @192 '8' (9x13)
+	//  #####  
+	// ####### 
+	//###   ###
+	//##     ##
+	//###   ###
+	// ####### 
+	// ####### 
+	//###   ###
+	//##     ##
+	//##     ##
+	//###   ###
+	// ####### 
+	//  #####  
+	0x1F, 0x0F, 0xE7, 0x1D, 0x83, 0x71, 0xCF, 0xEB, 0x8E, 0xC1, 0xDC, 0x73, 0xF8, 0x7C,
+
+	// @206 '9' (9x13)
+	//  ####   
+	// ####### 
+	//###   ## 
+	//##     ##
+	//##     ##
+	//###   ###
+	// ########
+	//  #### ##
+	//      ###
+	//      ## 
+	//    #### 
+	//#######  
+	//#####    
+	0x1E, 0x0F, 0xE7, 0x19, 0x83, 0xB8, 0xE7, 0xF8, 0xF6, 0x03, 0x80, 0xC0, 0xF3, 0xF8, 0xF8, 0x00,
+
+	// @222 ':' (3x9)
+	//###
+	//###
+	//###
+	//   
+	//   
+	//   
+	//###
+	//###
+	//###
+	0x7C, 0x37, 0xC0,
+
+	// @225 ';' (5x11)
+	//  ###
+	//  ###
+	//  ###
+	//     
+	//     
+	//     
+	// ### 
+	// ##  
+	//##   
+	//##   
+	//#    
+	0x1F, 0x03, 0x38, 0xC6, 0x28, 0x00,
+
+	// @231 '<' (11x11)
+	//         ##
+	//       ####
+	//     ####  
+	//    ###    
+	//  ###      
+	//####       
+	//  ###      
+	//    ###    
+	//     ####  
+	//       ####
+	//         ##
+	0x00, 0x30, 0x0F, 0x03, 0xC0, 0x70, 0x1C, 0x07, 0x80, 0x1C, 0x00, 0x70, 0x03, 0xC0, 0x0F, 0x00,
+	0x30,
+
+	// @248 '=' (11x6)
+	//###########
+	//###########
+	//           
+	//           
+	//###########
+	//###########
+	0x7F, 0xF8, 0x00, 0x5F, 0xFE,
+
+	// @253 '>' (11x11)
+	//##         
+	//####       
+	//  ####     
+	//    ###    
+	//      ###  
+	//       ####
+	//      ###  
+	//    ###    
+	//  ####     
+	//####       
+	//##         
+	0x60, 0x07, 0x80, 0x1E, 0x00, 0x70, 0x01, 0xC0, 0x0F, 0x01, 0xC0, 0x70, 0x1E, 0x07, 0x80, 0x60,
+	0x00,
+
+	// @270 '?' (8x12)
+	// #####  
+	//####### 
+	//##    ##
+	//##    ##
+	//      ##
+	//    ### 
+	//   ###  
+	//   ##   
+	//        
+	//        
+	//  ###   
+	//  ###   
+	0x3E, 0x3F, 0x98, 0x70, 0x18, 0x38, 0x38, 0x18, 0x00, 0x47, 0x10,
+
+	// @281 '@' (7x14)
+	//   ### 
+	// ##  # 
+	// #    #
+	//#     #
+	//#     #
+	//#   ###
+	//#  #  #
+	//#  #  #
+	//#  #  #
+	//#   ###
+	//#      
+	// #     
+	// #    #
+	//  #### 
+	0x0E, 0x32, 0x21, 0x41, 0xA3, 0xA4, 0xE8, 0xE8, 0x04, 0x04, 0x23, 0xC0,
+
+	// @293 'A' (12x12)
+	//  ######    
+	//  ######    
+	//     ###    
+	//    ## ##   
+	//    ## ##   
+	//   ##  ##   
+	//   ##   ##  
+	//  ########  
+	//  ########  
+	// ##      ## 
+	//####    ####
+	//####    ####
+	0x1F, 0x84, 0x0E, 0x00, 0xD8, 0x86, 0x60, 0x31, 0x83, 0xFC, 0x98, 0x19, 0xE1, 0xF0,
+
+	// @307 'B' (10x12)
+	//#######   
+	//########  
+	// ##    ## 
+	// ##    ## 
+	// ##   ### 
+	// #######  
+	// ######## 
+	// ##    ###
+	// ##     ##
+	// ##     ##
+	//##########
+	//######### 
+	0x7F, 0x0F, 0xF0, 0xC3, 0x4C, 0x71, 0xFC, 0x3F, 0xC6, 0x1C, 0xC1, 0xDF, 0xFB, 0xFE,
+
+	// @321 'C' (10x12)
+	//   #### ##
+	//  ########
+	// ###   ###
+	//###     ##
+	//##        
+	//##        
+	//##        
+	//##        
+	//###     ##
+	// ###   ###
+	//  ####### 
+	//   #####  
+	0x0F, 0x63, 0xFC, 0xE3, 0xB8, 0x36, 0x01, 0xDC, 0x19, 0xC7, 0x1F, 0xC1, 0xF0,
+
+	// @334 'D' (11x12)
+	//########   
+	//#########  
+	// ##    ### 
+	// ##     ###
+	// ##      ##
+	// ##      ##
+	// ##      ##
+	// ##      ##
+	// ##     ###
+	// ##    ### 
+	//#########  
+	//########   
+	0x7F, 0x87, 0xFC, 0x30, 0xE3, 0x07, 0x30, 0x3E, 0x60, 0xE6, 0x1C, 0xFF, 0x8F, 0xF0,
+
+	// @348 'E' (10x12)
+	//##########
+	//##########
+	// ##     ##
+	// ##     ##
+	// ##  ##   
+	// ######   
+	// ######   
+	// ##  ##   
+	// ##     ##
+	// ##     ##
+	//##########
+	//##########
+	0x7F, 0xF3, 0x07, 0x33, 0x07, 0xE2, 0x66, 0x0C, 0x1D, 0xFF, 0xC0,
+
+	// @359 'F' (10x12)
+	//##########
+	//##########
+	// ##     ##
+	// ##     ##
+	// ##  ##   
+	// ######   
+	// ######   
+	// ##  ##   
+	// ##       
+	// ##       
+	//######    
+	//######    
+	0x7F, 0xF3, 0x07, 0x33, 0x07, 0xE2, 0x66, 0x0C, 0x05, 0xF8, 0x40,
+
+	// @370 'G' (11x12)
+	//   #### ## 
+	// ######### 
+	// ##    ### 
+	//##      ## 
+	//##         
+	//##         
+	//##   ######
+	//##   ######
+	//##      ## 
+	// ##     ## 
+	// ######### 
+	//   #####   
+	0x0F, 0x63, 0xFE, 0x30, 0xE6, 0x06, 0x60, 0x0B, 0x1F, 0xD8, 0x18, 0xC1, 0x8F, 0xF8, 0x3E, 0x00,
+
+	// @386 'H' (10x12)
+	//####  ####
+	//####  ####
+	// ##    ## 
+	// ##    ## 
+	// ##    ## 
+	// ######## 
+	// ######## 
+	// ##    ## 
+	// ##    ## 
+	// ##    ## 
+	//####  ####
+	//####  ####
+	0x79, 0xF3, 0x0D, 0x9F, 0xE9, 0x86, 0xDE, 0x7C,
+
+	// @394 'I' (8x12)
+	//########
+	//########
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//########
+	//########
+	0x7F, 0xC3, 0x1F, 0xDF, 0xF0,
+
+	// @399 'J' (11x12)
+	//    #######
+	//    #######
+	//       ##  
+	//       ##  
+	//       ##  
+	//       ##  
+	//##     ##  
+	//##     ##  
+	//##     ##  
+	//##    ###  
+	//########   
+	//  #####    
+	0x07, 0xF8, 0x06, 0x76, 0x0C, 0xD8, 0x71, 0xFE, 0x07, 0xC0,
+
+	// @409 'K' (11x12)
+	//##### #####
+	//##### #####
+	// ##   ###  
+	// ##  ##    
+	// ## ##     
+	// #####     
+	// ### ##    
+	// ##   ##   
+	// ##   ##   
+	// ##    ##  
+	//#####  ####
+	//#####   ###
+	0x7D, 0xF9, 0x8E, 0x19, 0x81, 0xB0, 0x1F, 0x01, 0xD8, 0x18, 0xC4, 0xC3, 0x1F, 0x3D, 0xF1, 0xC0,
+
+	// @425 'L' (10x12)
+	//######    
+	//######    
+	//  ##      
+	//  ##      
+	//  ##      
+	//  ##      
+	//  ##      
+	//  ##    ##
+	//  ##    ##
+	//  ##    ##
+	//##########
+	//##########
+	0x7E, 0x11, 0x81, 0xE3, 0x0F, 0x7F, 0xF0,
+
+	// @432 'M' (12x12)
+	//####    ####
+	//####    ####
+	// ###    ### 
+	// ####  #### 
+	// ## #  # ## 
+	// ## #### ## 
+	// ## #### ## 
+	// ##  ##  ## 
+	// ##  ##  ## 
+	// ##      ## 
+	//#####  #####
+	//#####  #####
+	0x78, 0x7C, 0xE1, 0xC7, 0x9E, 0x34, 0xB1, 0xBD, 0xA6, 0x66, 0x98, 0x19, 0xF3, 0xF0,
+
+	// @446 'N' (10x12)
+	//###  #####
+	//#### #####
+	// ###   ## 
+	// ####  ## 
+	// ####  ## 
+	// ## ## ## 
+	// ## ## ## 
+	// ##  #### 
+	// ##  #### 
+	// ##   ### 
+	//##### ### 
+	//#####  ## 
+	0x73, 0xEF, 0x7C, 0xE3, 0x1E, 0x69, 0xB6, 0x99, 0xE9, 0x8E, 0x7D, 0xCF, 0x98,
+
+	// @459 'O' (10x12)
+	//   ####   
+	//  ######  
+	// ###  ### 
+	//###    ###
+	//##      ##
+	//##      ##
+	//##      ##
+	//##      ##
+	//###    ###
+	// ###  ### 
+	//  ######  
+	//   ####   
+	0x0F, 0x03, 0xF0, 0xE7, 0x38, 0x76, 0x07, 0xDC, 0x39, 0xCE, 0x1F, 0x81, 0xE0,
+
+	// @472 'P' (10x12)
+	//########  
+	//######### 
+	// ##    ###
+	// ##     ##
+	// ##     ##
+	// ##    ###
+	// ######## 
+	// #######  
+	// ##       
+	// ##       
+	//######    
+	//######    
+	0x7F, 0x8F, 0xF8, 0xC3, 0x98, 0x39, 0x87, 0x3F, 0xC7, 0xF0, 0xC0, 0x5F, 0x84,
+
+	// @485 'Q' (10x15)
+	//   ####   
+	//  ######  
+	// ###  ### 
+	//###    ###
+	//##      ##
+	//##      ##
+	//##      ##
+	//##      ##
+	//###    ###
+	// ###  ### 
+	//  ######  
+	//   ####   
+	//   #### ##
+	//  ########
+	//  ##  ### 
+	0x0F, 0x03, 0xF0, 0xE7, 0x38, 0x76, 0x07, 0xDC, 0x39, 0xCE, 0x1F, 0x81, 0xE0, 0x3D, 0x8F, 0xF1,
+	0x9C,
+
+	// @502 'R' (11x12)
+	//########   
+	//#########  
+	// ##    ### 
+	// ##     ## 
+	// ##    ### 
+	// ########  
+	// #######   
+	// ##   ###  
+	// ##    ##  
+	// ##    ### 
+	//#####   ###
+	//#####    ##
+	0x7F, 0x87, 0xFC, 0x30, 0xE3, 0x06, 0x30, 0xE3, 0xFC, 0x3F, 0x83, 0x1C, 0x30, 0xC3, 0x0E, 0x7C,
+	0x77, 0xC3,
+
+	// @520 'S' (10x12)
+	//  ##### ##
+	// #########
+	//###    ###
+	//##      ##
+	//###       
+	// ######   
+	//   ###### 
+	//       ###
+	//##      ##
+	//###    ###
+	//######### 
+	//## #####  
+	0x1F, 0x67, 0xFD, 0xC3, 0xB0, 0x37, 0x00, 0x7E, 0x03, 0xF0, 0x07, 0x60, 0x6E, 0x1D, 0xFF, 0x37,
+	0xC0,
+
+	// @537 'T' (10x12)
+	//##########
+	//##########
+	//##  ##  ##
+	//##  ##  ##
+	//##  ##  ##
+	//    ##    
+	//    ##    
+	//    ##    
+	//    ##    
+	//    ##    
+	//  ######  
+	//  ######  
+	0x7F, 0xF6, 0x67, 0x83, 0x0F, 0x1F, 0x90,
+
+	// @544 'U' (10x12)
+	//####  ####
+	//####  ####
+	// ##    ## 
+	// ##    ## 
+	// ##    ## 
+	// ##    ## 
+	// ##    ## 
+	// ##    ## 
+	// ##    ## 
+	// ###  ### 
+	//  ######  
+	//   ####   
+	0x79, 0xF3, 0x0D, 0xF9, 0xCE, 0x1F, 0x81, 0xE0,
+
+	// @552 'V' (11x12)
+	//####   ####
+	//####   ####
+	// ##     ## 
+	// ##     ## 
+	//  ##   ##  
+	//  ##   ##  
+	//   ## ##   
+	//   ## ##   
+	//   ## ##   
+	//    ###    
+	//    ###    
+	//    ###    
+	0x78, 0xF9, 0x83, 0x46, 0x32, 0x1B, 0x18, 0x38, 0x60,
+
+	// @561 'W' (13x12)
+	//#####   #####
+	//#####   #####
+	// ##       ## 
+	// ##  ###  ## 
+	// ##  ###  ## 
+	// ##  ###  ## 
+	// ## ## ## ## 
+	//  # ## ## #  
+	//  ###   ###  
+	//  ###   ###  
+	//  ###   ###  
+	//  ##     ##  
+	0x7C, 0x7E, 0x60, 0x31, 0x9C, 0xD9, 0xB6, 0xC2, 0xDA, 0x0E, 0x39, 0x8C, 0x18,
+
+	// @574 'X' (11x12)
+	//####   ####
+	//####   ####
+	// ##     ## 
+	//  ##   ##  
+	//   ## ##   
+	//    ###    
+	//    ###    
+	//   ## ##   
+	//  ##   ##  
+	// ##     ## 
+	//####   ####
+	//####   ####
+	0x78, 0xF9, 0x83, 0x0C, 0x60, 0x6C, 0x03, 0x84, 0x36, 0x06, 0x30, 0xC1, 0x9E, 0x3E,
+
+	// @588 'Y' (10x12)
+	//####  ####
+	//####  ####
+	// ##    ## 
+	//  ##  ##  
+	//   ####   
+	//   ####   
+	//    ##    
+	//    ##    
+	//    ##    
+	//    ##    
+	//  ######  
+	//  ######  
+	0x79, 0xF3, 0x0C, 0x33, 0x03, 0xC4, 0x18, 0x71, 0xF9,
+
+	// @597 'Z' (8x12)
+	//########
+	//########
+	//##    ##
+	//##   ## 
+	//    ##  
+	//   ##   
+	//   ##   
+	//  ##    
+	// ##   ##
+	//##    ##
+	//########
+	//########
+	0x7F, 0xD8, 0x6C, 0x60, 0x60, 0x62, 0x30, 0x31, 0xB0, 0xDF, 0xF0,
+
+	// @608 '[' (4x16)
+	//####
+	//####
+	//##  
+	//##  
+	//##  
+	//##  
+	//##  
+	//##  
+	//##  
+	//##  
+	//##  
+	//##  
+	//##  
+	//##  
+	//####
+	//####
+	0x7D, 0x9F, 0xFD, 0xF0,
+
+	// @612 '\' (8x16)
+	//##      
+	//##      
+	// ##     
+	// ##     
+	// ##     
+	//  ##    
+	//  ##    
+	//   ##   
+	//   ##   
+	//    ##  
+	//    ##  
+	//     ## 
+	//     ## 
+	//     ## 
+	//      ##
+	//      ##
+	0x60, 0x4C, 0x18, 0xC2, 0x18, 0x83, 0x20, 0x6C, 0x07,
+
+	// @621 ']' (4x16)
+	//####
+	//####
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	//  ##
+	//####
+	//####
+	0x7C, 0x7F, 0xFD, 0xF0,
+
+	// @625 '^' (9x6)
+	//    #    
+	//   ###   
+	//  ## ##  
+	// ##   ## 
+	//##     ##
+	//#       #
+	0x04, 0x03, 0x81, 0xB0, 0xC6, 0x60, 0xD0, 0x10,
+
+	// @633 '_' (14x2)
+	//##############
+	//##############
+	0x7F, 0xFF,
+
+	// @635 '`' (4x3)
+	//#   
+	// ## 
+	//   #
+	0x41, 0x82,
+
+	// @637 'a' (10x9)
+	//  ######  
+	// ######## 
+	//       ## 
+	//  ####### 
+	// ######## 
+	//###    ## 
+	//##    ### 
+	//##########
+	// ##### ###
+	0x1F, 0x87, 0xF8, 0x03, 0x0F, 0xE3, 0xFC, 0xE1, 0x98, 0x73, 0xFF, 0x3E, 0xE0,
+
+	// @650 'b' (11x13)
+	//###        
+	//###        
+	// ##        
+	// ##        
+	// ## ####   
+	// ######### 
+	// ###    ## 
+	// ##      ##
+	// ##      ##
+	// ##      ##
+	// ###    ## 
+	//########## 
+	//### ####   
+	0x70, 0x09, 0x80, 0x4D, 0xE0, 0xFF, 0x8E, 0x18, 0xC0, 0xF3, 0x86, 0x7F, 0xE7, 0x78,
+
+	// @664 'c' (10x9)
+	//   #### ##
+	// #########
+	// ##     ##
+	//##      ##
+	//##        
+	//##        
+	//###     ##
+	// #########
+	//  ######  
+	0x0F, 0x67, 0xFC, 0xC1, 0xB0, 0x36, 0x01, 0x70, 0x67, 0xFC, 0x7E, 0x00,
+
+	// @676 'd' (11x13)
+	//       ### 
+	//       ### 
+	//        ## 
+	//        ## 
+	//   #### ## 
+	// ######### 
+	// ##    ### 
+	//##      ## 
+	//##      ## 
+	//##      ## 
+	//###    ### 
+	// ##########
+	//   #### ###
+	0x00, 0xE8, 0x03, 0x43, 0xD8, 0xFF, 0x8C, 0x39, 0x81, 0xB7, 0x0E, 0x3F, 0xF0, 0xF7,
+
+	// @690 'e' (10x9)
+	//   ####   
+	// ######## 
+	// ##    ## 
+	//##########
+	//##########
+	//##        
+	// ##     ##
+	// #########
+	//   #####  
+	0x0F, 0x07, 0xF8, 0xC3, 0x3F, 0xFB, 0x00, 0x30, 0x67, 0xFC, 0x3E, 0x00,
+
+	// @702 'f' (9x13)
+	//   ######
+	//  #######
+	//  ##     
+	//  ##     
+	//######## 
+	//######## 
+	//  ##     
+	//  ##     
+	//  ##     
+	//  ##     
+	//  ##     
+	//######## 
+	//######## 
+	0x0F, 0xC7, 0xF1, 0x82, 0xFF, 0x46, 0x0F, 0x7F, 0xA0,
+
+	// @711 'g' (11x13)
+	//   #### ###
+	// ##########
+	// ##    ### 
+	//##      ## 
+	//##      ## 
+	//##      ## 
+	// ##    ### 
+	// ######### 
+	//   #### ## 
+	//        ## 
+	//       ### 
+	//  #######  
+	//  ######   
+	0x0F, 0x73, 0xFF, 0x30, 0xE6, 0x06, 0xCC, 0x38, 0xFF, 0x83, 0xD8, 0x01, 0x80, 0x38, 0x7F, 0x07,
+	0xE0,
+
+	// @728 'h' (10x13)
+	//###       
+	//###       
+	// ##       
+	// ##       
+	// ## ####  
+	// ######## 
+	// ###   ## 
+	// ##    ## 
+	// ##    ## 
+	// ##    ## 
+	// ##    ## 
+	//####  ####
+	//####  ####
+	0x70, 0x13, 0x01, 0x37, 0x87, 0xF8, 0xE3, 0x18, 0x6E, 0xF3, 0xE0,
+
+	// @739 'i' (8x13)
+	//   ##   
+	//   ##   
+	//        
+	//        
+	//#####   
+	//#####   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//########
+	//########
+	0x0C, 0x40, 0x17, 0xC4, 0x31, 0xEF, 0xF8,
+
+	// @746 'j' (8x17)
+	//    ##  
+	//    ##  
+	//        
+	//        
+	// #######
+	// #######
+	//      ##
+	//      ##
+	//      ##
+	//      ##
+	//      ##
+	//      ##
+	//      ##
+	//      ##
+	//     ###
+	//####### 
+	//######  
+	0x06, 0x40, 0x13, 0xFC, 0x07, 0xFC, 0x0E, 0xFE, 0x7E, 0x00,
+
+	// @756 'k' (10x13)
+	//###       
+	//###       
+	// ##       
+	// ##       
+	// ## ##### 
+	// ## ##### 
+	// ## ##    
+	// ####     
+	// ####     
+	// ## ##    
+	// ##  ##   
+	//###  #####
+	//###  #####
+	0x70, 0x13, 0x01, 0x37, 0xD3, 0x60, 0x78, 0x26, 0xC0, 0xCC, 0x39, 0xF8,
+
+	// @768 'l' (8x13)
+	//#####   
+	//#####   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//   ##   
+	//########
+	//########
+	0x7C, 0x43, 0x1F, 0xEF, 0xF8,
+
+	// @773 'm' (12x9)
+	//###### ###  
+	//########### 
+	// ##  ##  ## 
+	// ##  ##  ## 
+	// ##  ##  ## 
+	// ##  ##  ## 
+	// ##  ##  ## 
+	//#### ### ###
+	//#### ### ###
+	0x7E, 0xE3, 0xFF, 0x8C, 0xCD, 0xEF, 0x77, 0x80,
+
+	// @781 'n' (10x9)
+	//### ####  
+	//######### 
+	// ###   ## 
+	// ##    ## 
+	// ##    ## 
+	// ##    ## 
+	// ##    ## 
+	//####  ####
+	//####  ####
+	0x77, 0x8F, 0xF8, 0xE3, 0x18, 0x6E, 0xF3, 0xE0,
+
+	// @789 'o' (10x9)
+	//   ####   
+	// ######## 
+	// ##    ## 
+	//##      ##
+	//##      ##
+	//##      ##
+	// ##    ## 
+	// ######## 
+	//   ####   
+	0x0F, 0x07, 0xF8, 0xC3, 0x30, 0x3C, 0xC3, 0x1F, 0xE0, 0xF0,
+
+	// @799 'p' (11x13)
+	//### ####   
+	//########## 
+	// ###    ## 
+	// ##      ##
+	// ##      ##
+	// ##      ##
+	// ###    ## 
+	// ######### 
+	// ## ####   
+	// ##        
+	// ##        
+	//#####      
+	//#####      
+	0x77, 0x87, 0xFE, 0x38, 0x63, 0x03, 0xCE, 0x18, 0xFF, 0x8D, 0xE0, 0xC0, 0x2F, 0x81,
+
+	// @813 'q' (11x13)
+	//   #### ###
+	// ##########
+	// ##    ### 
+	//##      ## 
+	//##      ## 
+	//##      ## 
+	// ##    ### 
+	// ######### 
+	//   #### ## 
+	//        ## 
+	//        ## 
+	//      #####
+	//      #####
+	0x0F, 0x73, 0xFF, 0x30, 0xE6, 0x06, 0xCC, 0x38, 0xFF, 0x83, 0xD8, 0x01, 0xA0, 0x3F,
+
+	// @827 'r' (10x9)
+	//####  ### 
+	//#### #####
+	//  ####  ##
+	//  ###     
+	//  ##      
+	//  ##      
+	//  ##      
+	//########  
+	//########  
+	0x79, 0xCF, 0x7C, 0x79, 0x8E, 0x01, 0x81, 0xBF, 0xC8,
+
+	// @836 's' (8x9)
+	//  ######
+	//########
+	//##    ##
+	//####    
+	// ###### 
+	//    ####
+	//##    ##
+	//########
+	//######  
+	0x1F, 0xBF, 0xD8, 0x6F, 0x03, 0xF0, 0x3D, 0x86, 0xFF, 0x7E, 0x00,
+
+	// @847 't' (10x12)
+	//  ##      
+	//  ##      
+	//  ##      
+	//######### 
+	//######### 
+	//  ##      
+	//  ##      
+	//  ##      
+	//  ##      
+	//  ##    ##
+	//  ########
+	//   #####  
+	0x18, 0x1B, 0xFE, 0x8C, 0x0E, 0x30, 0xC7, 0xF8, 0x7C,
+
+	// @856 'u' (10x9)
+	//###   ### 
+	//###   ### 
+	// ##    ## 
+	// ##    ## 
+	// ##    ## 
+	// ##    ## 
+	// ##   ### 
+	// #########
+	//  #### ###
+	0x71, 0xD3, 0x0D, 0xCC, 0x71, 0xFF, 0x1E, 0xE0,
+
+	// @864 'v' (11x9)
+	//####   ####
+	//####   ####
+	// ##     ## 
+	//  ##   ##  
+	//  ##   ##  
+	//   ## ##   
+	//   ## ##   
+	//    ###    
+	//    ###    
+	0x78, 0xF9, 0x83, 0x0C, 0x64, 0x36, 0x20, 0xE1,
+
+	// @872 'w' (11x9)
+	//####   ####
+	//####   ####
+	// ##  #  ## 
+	// ##  #  ## 
+	// ## ###### 
+	//  ### ###  
+	//  ### ###  
+	//  ##   ##  
+	//  ##   ##  
+	0x78, 0xF9, 0x93, 0x4D, 0xF8, 0x77, 0x23, 0x19,
+
+	// @880 'x' (10x9)
+	//####  ####
+	//####  ####
+	//  ##  ##  
+	//   ####   
+	//    ##    
+	//   ####   
+	//  ##  ##  
+	//####  ####
+	//####  ####
+	0x79, 0xF1, 0x98, 0x1E, 0x01, 0x80, 0x78, 0x19, 0x8F, 0x3E,
+
+	// @890 'y' (11x13)
+	//####   ####
+	//####   ####
+	// ##     ## 
+	//  ##   ##  
+	//  ##   ##  
+	//   ## ##   
+	//   #####   
+	//    ###    
+	//    ##     
+	//    ##     
+	//   ##      
+	//#######    
+	//#######    
+	0x78, 0xF9, 0x83, 0x0C, 0x64, 0x36, 0x03, 0xE0, 0x1C, 0x01, 0x82, 0x18, 0x0F, 0xE1,
+
+	// @904 'z' (8x9)
+	//########
+	//########
+	//##   ## 
+	//    ##  
+	//   ##   
+	//  ##    
+	// ##   ##
+	//########
+	//########
+	0x7F, 0xD8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC6, 0xFF, 0x80,
+
+	// @913 '{' (6x16)
+	//   ###
+	//  ####
+	//  ##  
+	//  ##  
+	//  ##  
+	//  ##  
+	//  ##  
+	// ###  
+	//###   
+	// ###  
+	//  ##  
+	//  ##  
+	//  ##  
+	//  ##  
+	//  ####
+	//   ###
+	0x0E, 0x3C, 0x67, 0x9C, 0x70, 0x70, 0x67, 0x1E, 0x1C,
+
+	// @922 '|' (2x16)
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	0x7F, 0xFF, 0xC0,
+
+	// @925 '}' (6x16)
+	//###   
+	//####  
+	//  ##  
+	//  ##  
+	//  ##  
+	//  ##  
+	//  ##  
+	//  ### 
+	//   ###
+	//  ### 
+	//  ##  
+	//  ##  
+	//  ##  
+	//  ##  
+	//####  
+	//###   
+	0x70, 0xF0, 0x67, 0x8E, 0x0E, 0x38, 0x67, 0x78, 0xE0,
+
+	// @934 '~' (10x4)
+	//  ###     
+	//######  ##
+	//##  ######
+	//     #### 
+	0x1C, 0x0F, 0xCD, 0x9F, 0x81, 0xE0,
+
+	// @940 degree sign (6x6)
+	// #### 
+	//##  ##
+	//#    #
+	//#    #
+	//##  ##
+	// #### 
+	0x3C, 0xCD, 0x0D, 0x99, 0xE0,
+};
+
+const sGLYPH Font20P_Glyphs[] =
+{
+	//Offset, Width, Height, Left, Top, Advance
+	{0, 0, 0, 0, 0, 7}, // ' '
+	{0, 3, 13, 1, 1, 5}, // '!'
+	{4, 8, 6, 1, 2, 10}, // '"'
+	{7, 10, 16, 1, 0, 12}, // '#'
+	{16, 8, 16, 1, 0, 10}, // '$'
+	{30, 9, 13, 1, 1, 11}, // '%'
+	{42, 9, 11, 1, 3, 11}, // '&'
+	{55, 3, 6, 1, 2, 5}, // '''
+	{57, 4, 16, 1, 1, 6}, // '('
+	{62, 4, 16, 1, 1, 6}, // ')'
+	{67, 8, 9, 1, 1, 10}, // '*'
+	{75, 10, 10, 1, 3, 12}, // '+'
+	{80, 4, 6, 1, 11, 6}, // ','
+	{83, 9, 2, 1, 7, 11}, // '-'
+	{85, 3, 3, 1, 11, 5}, // '.'
+	{86, 8, 16, 1, 0, 10}, // '/'
+	{95, 9, 13, 1, 1, 11}, // '0'
+	{105, 8, 13, 1, 1, 10}, // '1'
+	{111, 9, 13, 1, 1, 11}, // '2'
+	{127, 10, 13, 1, 1, 12}, // '3'
+	{143, 9, 13, 1, 1, 11}, // '4'
+	{155, 9, 13, 1, 1, 11}, // '5'
+	{167, 9, 13, 1, 1, 11}, // '6'
+	{183, 9, 13, 1, 1, 11}, // '7'
+	{192, 9, 13, 1, 1, 11}, // '8'
+	{206, 9, 13, 1, 1, 11}, // '9'
+	{222, 3, 9, 1, 5, 5}, // ':'
+	{225, 5, 11, 1, 5, 7}, // ';'
+	{231, 11, 11, 1, 3, 13}, // '<'
+	{248, 11, 6, 1, 5, 13}, // '='
+	{253, 11, 11, 1, 3, 13}, // '>'
+	{270, 8, 12, 1, 2, 10}, // '?'
+	{281, 7, 14, 1, 1, 9}, // '@'
+	{293, 12, 12, 1, 2, 14}, // 'A'
+	{307, 10, 12, 1, 2, 12}, // 'B'
+	{321, 10, 12, 1, 2, 12}, // 'C'
+	{334, 11, 12, 1, 2, 13}, // 'D'
+	{348, 10, 12, 1, 2, 12}, // 'E'
+	{359, 10, 12, 1, 2, 12}, // 'F'
+	{370, 11, 12, 1, 2, 13}, // 'G'
+	{386, 10, 12, 1, 2, 12}, // 'H'
+	{394, 8, 12, 1, 2, 10}, // 'I'
+	{399, 11, 12, 1, 2, 13}, // 'J'
+	{409, 11, 12, 1, 2, 13}, // 'K'
+	{425, 10, 12, 1, 2, 12}, // 'L'
+	{432, 12, 12, 1, 2, 14}, // 'M'
+	{446, 10, 12, 1, 2, 12}, // 'N'
+	{459, 10, 12, 1, 2, 12}, // 'O'
+	{472, 10, 12, 1, 2, 12}, // 'P'
+	{485, 10, 15, 1, 2, 12}, // 'Q'
+	{502, 11, 12, 1, 2, 13}, // 'R'
+	{520, 10, 12, 1, 2, 12}, // 'S'
+	{537, 10, 12, 1, 2, 12}, // 'T'
+	{544, 10, 12, 1, 2, 12}, // 'U'
+	{552, 11, 12, 1, 2, 13}, // 'V'
+	{561, 13, 12, 1, 2, 15}, // 'W'
+	{574, 11, 12, 1, 2, 13}, // 'X'
+	{588, 10, 12, 1, 2, 12}, // 'Y'
+	{597, 8, 12, 1, 2, 10}, // 'Z'
+	{608, 4, 16, 1, 1, 6}, // '['
+	{612, 8, 16, 1, 0, 10}, // '\'
+	{621, 4, 16, 1, 1, 6}, // ']'
+	{625, 9, 6, 1, 1, 11}, // '^'
+	{633, 14, 2, 1, 18, 16}, // '_'
+	{635, 4, 3, 1, 1, 6}, // '`'
+	{637, 10, 9, 1, 5, 12}, // 'a'
+	{650, 11, 13, 1, 1, 13}, // 'b'
+	{664, 10, 9, 1, 5, 12}, // 'c'
+	{676, 11, 13, 1, 1, 13}, // 'd'
+	{690, 10, 9, 1, 5, 12}, // 'e'
+	{702, 9, 13, 1, 1, 11}, // 'f'
+	{711, 11, 13, 1, 5, 13}, // 'g'
+	{728, 10, 13, 1, 1, 12}, // 'h'
+	{739, 8, 13, 1, 1, 10}, // 'i'
+	{746, 8, 17, 1, 1, 10}, // 'j'
+	{756, 10, 13, 1, 1, 12}, // 'k'
+	{768, 8, 13, 1, 1, 10}, // 'l'
+	{773, 12, 9, 1, 5, 14}, // 'm'
+	{781, 10, 9, 1, 5, 12}, // 'n'
+	{789, 10, 9, 1, 5, 12}, // 'o'
+	{799, 11, 13, 1, 5, 13}, // 'p'
+	{813, 11, 13, 1, 5, 13}, // 'q'
+	{827, 10, 9, 1, 5, 12}, // 'r'
+	{836, 8, 9, 1, 5, 10}, // 's'
+	{847, 10, 12, 1, 2, 12}, // 't'
+	{856, 10, 9, 1, 5, 12}, // 'u'
+	{864, 11, 9, 1, 5, 13}, // 'v'
+	{872, 11, 9, 1, 5, 13}, // 'w'
+	{880, 10, 9, 1, 5, 12}, // 'x'
+	{890, 11, 13, 1, 5, 13}, // 'y'
+	{904, 8, 9, 1, 5, 10}, // 'z'
+	{913, 6, 16, 1, 1, 8}, // '{'
+	{922, 2, 16, 1, 1, 4}, // '|'
+	{925, 6, 16, 1, 1, 8}, // '}'
+	{934, 10, 4, 1, 6, 12}, // '~'
+	{940, 6, 6, 1, 2, 8}, // degree sign
+	{940, 6, 6, 1, 2, 8}, // U+00B0
+};
+
+const sRANGE Font20P_Ranges[] =
+{
+	//First, Count, Index
+	{0x00B0, 1, 96}, // U+00B0
+};
+
+sFONT Font20P = {
+  Font20P_Table,
+  16, /* Width */
+  20, /* Height */
+  Font20P_Glyphs,
+  0x20, /* First */
+  0x7F, /* Last */
+  FONT_ENCODING_ROWS,
+  0, /* Map: every code from First to Last */
+  '?', /* Fallback */
+  Font20P_Ranges,
+  1, /* RangeCount */
+  0, /* Kerning: none */
+  0, /* KernCount */
+};
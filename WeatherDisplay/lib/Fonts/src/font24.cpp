@@ -2509,12 +2509,48 @@ const uint8_t Font24_Table [] =
 	0x00, 0x00, 0x00, //                  
 	0x00, 0x00, 0x00, //                  
 	0x00, 0x00, 0x00, //                  
+
+	// @6840 degree sign in place of DEL (17 pixels wide)
+	0x00, 0x00, 0x00, //                  
+	0x00, 0x00, 0x00, //                  
+	0x03, 0xE0, 0x00, //      #####       
+	0x07, 0xF0, 0x00, //     #######      
+	0x07, 0x70, 0x00, //     ### ###      
+	0x06, 0x30, 0x00, //     ##   ##      
+	0x07, 0x70, 0x00, //     ### ###      
+	0x07, 0xF0, 0x00, //     #######      
+	0x03, 0xE0, 0x00, //      #####       
+	0x00, 0x00, 0x00, //                  
+	0x00, 0x00, 0x00, //                  
+	0x00, 0x00, 0x00, //                  
+	0x00, 0x00, 0x00, //                  
+	0x00, 0x00, 0x00, //                  
+	0x00, 0x00, 0x00, //                  
+	0x00, 0x00, 0x00, //                  
+	0x00, 0x00, 0x00, //                  
+	0x00, 0x00, 0x00, //                  
+	0x00, 0x00, 0x00, //                  
+	0x00, 0x00, 0x00, //                  
+	0x00, 0x00, 0x00, //                  
+	0x00, 0x00, 0x00, //                  
+	0x00, 0x00, 0x00, //                  
+	0x00, 0x00, 0x00, //                  
 };
 
 sFONT Font24 = {
   Font24_Table,
   17, /* Width */
   24, /* Height */
+  0, /* Glyphs: cells of Width from ' ' */
+  0, /* First */
+  0, /* Last */
+  FONT_ENCODING_BITS,
+  0, /* Map */
+  0, /* Fallback */
+  0, /* Ranges */
+  0, /* RangeCount */
+  0, /* Kerning: none */
+  0, /* KernCount */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
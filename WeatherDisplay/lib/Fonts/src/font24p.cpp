@@ -0,0 +1,1730 @@
+/**
+  ******************************************************************************
+  * @file    font24p.cpp
+  * @brief   Proportional version of Font24: every glyph is cut to its ink
+  *          and packed without row padding, see sGLYPH in fonts.h.
+  *          Rows equal to the one above are stored as a single bit
+  *          (FONT_ENCODING_ROWS).
+  *          Generated by tools/fontgen, do not edit:
+  *          fontgen -e ROWS -n Font24P -o font24p.cpp font24.cpp
+  ******************************************************************************
+  */
+
+#include "fonts.h"
+
+const uint8_t Font24P_Table[] =
+{
+	// @0 '!' (3x15)
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	// # 
+	// # 
+	//   
+	//   
+	//###
+	//###
+	0x7F, 0xF2, 0x85, 0xE0,
+
+	// @4 '"' (8x7)
+	//###  ###
+	//###  ###
+	//###  ###
+	// #    # 
+	// #    # 
+	// #    # 
+	// #    # 
+	0x73, 0xE4, 0x2E,
+
+	// @7 '#' (11x16)
+	//   ##  ##  
+	//   ##  ##  
+	//   ##  ##  
+	//   ##  ##  
+	//   ##  ##  
+	//###########
+	//###########
+	//   ##  ##  
+	//  ##  ##   
+	//###########
+	//###########
+	//  ##  ##   
+	//  ##  ##   
+	//  ##  ##   
+	//  ##  ##   
+	//  ##  ##   
+	0x0C, 0xCF, 0x7F, 0xF8, 0x66, 0x0C, 0xC3, 0xFF, 0xC6, 0x63, 0xC0,
+
+	// @18 '$' (9x19)
+	//    ##   
+	//    ##   
+	//  #### ##
+	// ########
+	//##    ###
+	//##    ###
+	//###      
+	// #####   
+	//  ###### 
+	//     ####
+	//##     ##
+	//###    ##
+	//###   ###
+	//######## 
+	//## ####  
+	//    ##   
+	//    ##   
+	//    ##   
+	//    ##   
+	0x06, 0x23, 0xD9, 0xFE, 0xC3, 0xDC, 0x03, 0xE0, 0x7E, 0x03, 0xD8, 0x37, 0x0D, 0xC7, 0x7F, 0x9B,
+	0xC0, 0x63, 0x80,
+
+	// @37 '%' (10x15)
+	//  ####    
+	// ######   
+	//###  ###  
+	//##    ##  
+	//##    ##  
+	//###  ###  
+	// #########
+	//  ######  
+	//######### 
+	//  ###  ###
+	//  ##    ##
+	//  ##    ##
+	//  ###  ###
+	//   ###### 
+	//    ####  
+	0x1E, 0x07, 0xE1, 0xCE, 0x30, 0xCB, 0x9C, 0x3F, 0xE3, 0xF1, 0xFF, 0x0E, 0x71, 0x87, 0x1C, 0xE1,
+	0xF8, 0x1E, 0x00,
+
+	// @56 '&' (11x13)
+	//   ######  
+	//  #######  
+	// ##   ##   
+	// ##        
+	// ##        
+	//  ##       
+	//  ###      
+	// #####  ###
+	//### #######
+	//##   ####  
+	//##    ###  
+	// ##########
+	//  ##### ###
+	0x0F, 0xC1, 0xFC, 0x31, 0x83, 0x00, 0x8C, 0x00, 0xE0, 0x1F, 0x3B, 0xBF, 0xB1, 0xE3, 0x0E, 0x1F,
+	0xF8, 0xFB, 0x80,
+
+	// @75 ''' (3x7)
+	//###
+	//###
+	//###
+	// # 
+	// # 
+	// # 
+	// # 
+	0x7C, 0xB8,
+
+	// @77 '(' (6x18)
+	//    ##
+	//   ###
+	//  ### 
+	// #### 
+	// ###  
+	// ###  
+	//###   
+	//###   
+	//###   
+	//###   
+	//###   
+	//###   
+	// ###  
+	// ###  
+	//  ### 
+	//  ### 
+	//   ###
+	//    ##
+	0x06, 0x1C, 0x71, 0xE3, 0x97, 0x1F, 0x39, 0x1D, 0x0E, 0x0C,
+
+	// @87 ')' (6x18)
+	//##    
+	//###   
+	// ###  
+	// ###  
+	//  ### 
+	//  ### 
+	//   ###
+	//   ###
+	//   ###
+	//   ###
+	//   ###
+	//   ###
+	//  ### 
+	//  ### 
+	// #### 
+	// ###  
+	//###   
+	//##    
+	0x60, 0xE0, 0xE4, 0x74, 0x3F, 0xC7, 0x4F, 0x1C, 0x70, 0xC0,
+
+	// @97 '*' (10x10)
+	//    ##    
+	//    ##    
+	//    ##    
+	//### ## ###
+	//##########
+	//  ######  
+	//   ####   
+	//   ####   
+	//  ##  ##  
+	//  ##  ##  
+	0x06, 0x1B, 0xB7, 0x7F, 0xE3, 0xF0, 0x3C, 0x46, 0x64,
+
+	// @106 '+' (12x12)
+	//     ##     
+	//     ##     
+	//     ##     
+	//     ##     
+	//     ##     
+	//############
+	//############
+	//     ##     
+	//     ##     
+	//     ##     
+	//     ##     
+	//     ##     
+	0x03, 0x07, 0xBF, 0xFE, 0x06, 0x0F,
+
+	// @112 ',' (5x7)
+	//  ###
+	//  ## 
+	// ### 
+	// ##  
+	// ##  
+	//##   
+	//##   
+	0x1C, 0x63, 0x8C, 0xB1,
+
+	// @116 '-' (10x2)
+	//##########
+	//##########
+	0x7F, 0xF0,
+
+	// @118 '.' (4x3)
+	//####
+	//####
+	//####
+	0x7E,
+
+	// @119 '/' (10x20)
+	//        ##
+	//        ##
+	//       ###
+	//       ## 
+	//      ### 
+	//      ##  
+	//      ##  
+	//     ##   
+	//     ##   
+	//    ##    
+	//    ##    
+	//   ##     
+	//   ##     
+	//  ##      
+	//  ##      
+	// ###      
+	// ##       
+	//###       
+	//##        
+	//##        
+	0x00, 0x70, 0x0E, 0x01, 0x80, 0x70, 0x0C, 0x81, 0x88, 0x30, 0x86, 0x08, 0xC0, 0x9C, 0x03, 0x00,
+	0xE0, 0x18, 0x04,
+
+	// @138 '0' (10x15)
+	//   ####   
+	//  ######  
+	// ##    ## 
+	// ##    ## 
+	//##      ##
+	//##      ##
+	//##      ##
+	//##      ##
+	//##      ##
+	//##      ##
+	//##      ##
+	// ##    ## 
+	// ##    ## 
+	//  ######  
+	//   ####   
+	0x0F, 0x03, 0xF0, 0xC3, 0x58, 0x1F, 0xE6, 0x1A, 0x3F, 0x03, 0xC0,
+
+	// @149 '1' (10x15)
+	//     #    
+	//  ####    
+	//######    
+	//### ##    
+	//    ##    
+	//    ##    
+	//    ##    
+	//    ##    
+	//    ##    
+	//    ##    
+	//    ##    
+	//    ##    
+	//    ##    
+	//##########
+	//##########
+	0x02, 0x03, 0xC1, 0xF8, 0x3B, 0x00, 0x61, 0xFE, 0xFF, 0xE0,
+
+	// @159 '2' (11x15)
+	//   #####   
+	// ######### 
+	//###     ## 
+	//##       ##
+	//##       ##
+	//         ##
+	//        ## 
+	//       ##  
+	//     ###   
+	//    ###    
+	//   ##      
+	//  ##       
+	// ##        
+	//###########
+	//###########
+	0x0F, 0x83, 0xFE, 0x70, 0x66, 0x03, 0x80, 0x18, 0x03, 0x00, 0x60, 0x1C, 0x03, 0x80, 0x60, 0x0C,
+	0x01, 0x80, 0x3F, 0xFC,
+
+	// @179 '3' (10x15)
+	//   ####   
+	// #######  
+	// ##   ### 
+	//       ## 
+	//       ## 
+	//      ##  
+	//   ####   
+	//   #####  
+	//      ### 
+	//        ##
+	//        ##
+	//        ##
+	//##     ###
+	//######### 
+	// ######   
+	0x0F, 0x07, 0xF0, 0xC7, 0x00, 0x68, 0x0C, 0x0F, 0x01, 0xF0, 0x07, 0x00, 0x3D, 0x83, 0xBF, 0xE3,
+	0xF0,
+
+	// @196 '4' (11x15)
+	//      ###  
+	//     ####  
+	//     ####  
+	//    ## ##  
+	//   ##  ##  
+	//   ##  ##  
+	//  ##   ##  
+	//  ##   ##  
+	// ##    ##  
+	//##     ##  
+	//###########
+	//###########
+	//       ##  
+	//    #######
+	//    #######
+	0x01, 0xC0, 0x3C, 0x83, 0x60, 0x66, 0x46, 0x32, 0x61, 0x8C, 0x18, 0xFF, 0xF0, 0x0C, 0x07, 0xF8,
+
+	// @212 '5' (11x15)
+	// ######### 
+	// ######### 
+	// ##        
+	// ##        
+	// ##        
+	// ## ####   
+	// ######### 
+	// ###    ## 
+	//         ##
+	//         ##
+	//         ##
+	//         ##
+	//##      ## 
+	//########## 
+	//  ######   
+	0x3F, 0xE9, 0x80, 0x66, 0xF0, 0x7F, 0xC7, 0x0C, 0x00, 0x7D, 0x81, 0x9F, 0xF8, 0x7E, 0x00,
+
+	// @227 '6' (10x15)
+	//     #####
+	//   #######
+	//  ###     
+	// ###      
+	// ##       
+	//##        
+	//## ####   
+	//######### 
+	//###    ## 
+	//##      ##
+	//##      ##
+	//##      ##
+	// ##    ###
+	// ######## 
+	//   #####  
+	0x03, 0xE1, 0xFC, 0x70, 0x1C, 0x03, 0x00, 0xC0, 0x1B, 0xC3, 0xFE, 0x70, 0xCC, 0x0F, 0x30, 0xE7,
+	0xF8, 0x3E, 0x00,
+
+	// @246 '7' (10x15)
+	//##########
+	//##########
+	//##      ##
+	//##     ###
+	//       ## 
+	//       ## 
+	//      ### 
+	//      ##  
+	//      ##  
+	//     ###  
+	//     ##   
+	//     ##   
+	//    ###   
+	//    ##    
+	//    ##    
+	0x7F, 0xF6, 0x06, 0xC1, 0xC0, 0x34, 0x07, 0x00, 0xC8, 0x1C, 0x03, 0x10, 0x70, 0x0C, 0x20,
+
+	// @261 '8' (10x15)
+	//  ######  
+	// ######## 
+	//###    ###
+	//##      ##
+	//##      ##
+	// ##    ## 
+	//  ######  
+	//  ######  
+	// ##    ## 
+	//##      ##
+	//##      ##
+	//##      ##
+	//###    ###
+	// ######## 
+	//  ######  
+	0x1F, 0x87, 0xF9, 0xC3, 0xB0, 0x39, 0x86, 0x1F, 0x93, 0x0C, 0xC0, 0xF7, 0x0E, 0x7F, 0x87, 0xE0,
+
+	// @277 '9' (10x15)
+	//  #####   
+	// ######## 
+	//###    ## 
+	//##      ##
+	//##      ##
+	//##      ##
+	// ##    ###
+	// #########
+	//   #### ##
+	//        ##
+	//       ## 
+	//      ### 
+	//     ###  
+	//#######   
+	//#####     
+	0x1F, 0x07, 0xF9, 0xC3, 0x30, 0x3C, 0xC3, 0x9F, 0xF0, 0xF6, 0x00, 0xC0, 0x30, 0x0E, 0x03, 0x8F,
+	0xE1, 0xF0, 0x00,
+
+	// @296 ':' (4x11)
+	//####
+	//####
+	//####
+	//    
+	//    
+	//    
+	//    
+	//    
+	//####
+	//####
+	//####
+	0x7E, 0x0F, 0x7E,
+
+	// @299 ';' (6x13)
+	//  ####
+	//  ####
+	//  ####
+	//      
+	//      
+	//      
+	//      
+	//  ### 
+	// ###  
+	// ##   
+	// ##   
+	//##    
+	//#     
+	0x1F, 0x80, 0xE3, 0x8E, 0x18, 0xB0, 0x40,
+
+	// @306 '<' (14x13)
+	//           ###
+	//          ####
+	//        ####  
+	//      ####    
+	//    ####      
+	//  ####        
+	//####          
+	//  ####        
+	//    ####      
+	//      ####    
+	//        ####  
+	//          ####
+	//           ###
+	0x00, 0x0E, 0x00, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0x0F, 0x00, 0x07,
+	0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0xE0,
+
+	// @331 '=' (13x6)
+	//#############
+	//#############
+	//             
+	//             
+	//#############
+	//#############
+	0x7F, 0xFE, 0x00, 0x05, 0xFF, 0xF8,
+
+	// @337 '>' (14x13)
+	//###           
+	//####          
+	//  ####        
+	//    ####      
+	//      ####    
+	//        ####  
+	//          ####
+	//        ####  
+	//      ####    
+	//    ####      
+	//  ####        
+	//####          
+	//###           
+	0x70, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x3C, 0x01,
+	0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x07, 0x00, 0x00,
+
+	// @362 '?' (9x14)
+	//  #####  
+	// ####### 
+	//##    ###
+	//##     ##
+	//##     ##
+	//      ###
+	//     ### 
+	//   ####  
+	//   ###   
+	//   ##    
+	//         
+	//         
+	//  ###    
+	//  ###    
+	0x1F, 0x0F, 0xE6, 0x1D, 0x83, 0x80, 0xE0, 0x70, 0x78, 0x1C, 0x06, 0x00, 0x04, 0x70, 0x80,
+
+	// @377 '@' (10x17)
+	//   #####  
+	//  ####### 
+	// ###   ###
+	// ##     ##
+	//##    ####
+	//##   #####
+	//##  ### ##
+	//##  ##  ##
+	//##  ##  ##
+	//##  ##  ##
+	//##   #####
+	//##    ####
+	//##        
+	// ##       
+	// ###    ##
+	//  ########
+	//   #####  
+	0x0F, 0x83, 0xF8, 0xE3, 0x98, 0x36, 0x1E, 0xC7, 0xD9, 0xDB, 0x33, 0xD8, 0xFB, 0x0F, 0x60, 0x06,
+	0x00, 0xE1, 0x8F, 0xF0, 0xF8,
+
+	// @398 'A' (16x14)
+	//   ######       
+	//   #######      
+	//       ###      
+	//      ## ##     
+	//      ## ##     
+	//     ##   ##    
+	//     ##   ##    
+	//    ##    ##    
+	//    #########   
+	//   ##########   
+	//   ##       ##  
+	//  ##        ##  
+	//######   #######
+	//######   #######
+	0x0F, 0xC0, 0x07, 0xF0, 0x00, 0x38, 0x00, 0x36, 0x08, 0x18, 0xC2, 0x0C, 0x30, 0x07, 0xFC, 0x07,
+	0xFE, 0x03, 0x01, 0x83, 0x00, 0xC7, 0xE3, 0xFC,
+
+	// @422 'B' (13x14)
+	//##########   
+	//###########  
+	//  ##     ### 
+	//  ##      ## 
+	//  ##      ## 
+	//  ##     ### 
+	//  #########  
+	//  ########## 
+	//  ##      ###
+	//  ##       ##
+	//  ##       ##
+	//  ##       ##
+	//############ 
+	//###########  
+	0x7F, 0xE1, 0xFF, 0xC1, 0x83, 0x86, 0x06, 0x8C, 0x1C, 0x3F, 0xE0, 0xFF, 0xC3, 0x03, 0x8C, 0x07,
+	0xBF, 0xFC, 0xFF, 0xE0,
+
+	// @442 'C' (12x14)
+	//    ##### ##
+	//  ##########
+	// ###     ###
+	// ##       ##
+	//##        ##
+	//##          
+	//##          
+	//##          
+	//##          
+	//##          
+	// ##       ##
+	// ###     ###
+	//  ######### 
+	//    ######  
+	0x07, 0xD8, 0xFF, 0xCE, 0x0E, 0x60, 0x36, 0x01, 0xB0, 0x03, 0xCC, 0x06, 0x70, 0x71, 0xFF, 0x03,
+	0xF0,
+
+	// @459 'D' (13x14)
+	//#########    
+	//###########  
+	//  ##     ### 
+	//  ##      ## 
+	//  ##       ##
+	//  ##       ##
+	//  ##       ##
+	//  ##       ##
+	//  ##       ##
+	//  ##       ##
+	//  ##      ## 
+	//  ##     ### 
+	//###########  
+	//##########   
+	0x7F, 0xC1, 0xFF, 0xC1, 0x83, 0x86, 0x06, 0x18, 0x0F, 0xE3, 0x03, 0x0C, 0x1C, 0xFF, 0xE3, 0xFF,
+	0x00,
+
+	// @476 'E' (12x14)
+	//############
+	//############
+	//  ##      ##
+	//  ##      ##
+	//  ##  ##  ##
+	//  ##  ##    
+	//  ######    
+	//  ######    
+	//  ##  ##    
+	//  ##  ##  ##
+	//  ##      ##
+	//  ##      ##
+	//############
+	//############
+	0x7F, 0xFC, 0x60, 0x71, 0x99, 0x8C, 0xC0, 0x7E, 0x11, 0x98, 0x0C, 0xCC, 0x60, 0x77, 0xFF, 0xC0,
+
+	// @492 'F' (12x14)
+	//############
+	//############
+	//  ##      ##
+	//  ##      ##
+	//  ##  ##  ##
+	//  ##  ##    
+	//  ######    
+	//  ######    
+	//  ##  ##    
+	//  ##  ##    
+	//  ##        
+	//  ##        
+	//########    
+	//########    
+	0x7F, 0xFC, 0x60, 0x71, 0x99, 0x8C, 0xC0, 0x7E, 0x11, 0x98, 0x46, 0x01, 0x7F, 0x84,
+
+	// @506 'G' (13x14)
+	//    ##### ## 
+	//  ########## 
+	// ###     ### 
+	// ##       ## 
+	//##        ## 
+	//##           
+	//##           
+	//##    #######
+	//##    #######
+	//##        ## 
+	//###       ## 
+	// ###     ### 
+	//  ########## 
+	//    ######   
+	0x07, 0xD8, 0x7F, 0xE3, 0x83, 0x8C, 0x06, 0x60, 0x19, 0x80, 0x0B, 0x0F, 0xF6, 0x01, 0x9C, 0x06,
+	0x38, 0x38, 0x7F, 0xE0, 0x7E, 0x00,
+
+	// @528 'H' (14x14)
+	//######  ######
+	//######  ######
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##########  
+	//  ##########  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//######  ######
+	//######  ######
+	0x7E, 0x7F, 0x18, 0x19, 0xC7, 0xFE, 0x46, 0x06, 0x77, 0xE7, 0xF0,
+
+	// @539 'I' (10x14)
+	//##########
+	//##########
+	//    ##    
+	//    ##    
+	//    ##    
+	//    ##    
+	//    ##    
+	//    ##    
+	//    ##    
+	//    ##    
+	//    ##    
+	//    ##    
+	//##########
+	//##########
+	0x7F, 0xF0, 0x61, 0xFF, 0x7F, 0xF0,
+
+	// @545 'J' (13x14)
+	//   ##########
+	//   ##########
+	//        ##   
+	//        ##   
+	//        ##   
+	//        ##   
+	//        ##   
+	//##      ##   
+	//##      ##   
+	//##      ##   
+	//##      ##   
+	//##     ##    
+	//#########    
+	//  #####      
+	0x0F, 0xFE, 0x00, 0xC7, 0xB0, 0x31, 0xD8, 0x30, 0x7F, 0xC0, 0x7C, 0x00,
+
+	// @557 'K' (15x14)
+	//#######  ##### 
+	//#######  ##### 
+	//  ##     ##    
+	//  ##    ##     
+	//  ##   ##      
+	//  ##  ##       
+	//  ## ###       
+	//  #######      
+	//  ###  ###     
+	//  ##    ###    
+	//  ##     ##    
+	//  ##     ###   
+	//#######   #####
+	//#######   #####
+	0x7F, 0x3E, 0x8C, 0x18, 0x0C, 0x30, 0x0C, 0x60, 0x0C, 0xC0, 0x0D, 0xC0, 0x0F, 0xE0, 0x0E, 0x70,
+	0x0C, 0x38, 0x0C, 0x18, 0x0C, 0x1C, 0x3F, 0x8F, 0xC0,
+
+	// @582 'L' (13x14)
+	//########     
+	//########     
+	//   ##        
+	//   ##        
+	//   ##        
+	//   ##        
+	//   ##        
+	//   ##        
+	//   ##      ##
+	//   ##      ##
+	//   ##      ##
+	//   ##      ##
+	//#############
+	//#############
+	0x7F, 0x82, 0x18, 0x07, 0xC3, 0x03, 0xEF, 0xFF, 0xC0,
+
+	// @591 'M' (16x14)
+	//####        ####
+	//#####      #####
+	//  ###      ###  
+	//  ####    ####  
+	//  ####    ####  
+	//  ## ##  ## ##  
+	//  ## ##  ## ##  
+	//  ##  ####  ##  
+	//  ##  ####  ##  
+	//  ##   ##   ##  
+	//  ##        ##  
+	//  ##        ##  
+	//#######  #######
+	//#######  #######
+	0x78, 0x07, 0xBE, 0x07, 0xC7, 0x03, 0x83, 0xC3, 0xC8, 0xD9, 0xB2, 0x33, 0xCC, 0x8C, 0x63, 0x06,
+	0x01, 0x97, 0xF3, 0xFC,
+
+	// @611 'N' (14x14)
+	//####   #######
+	//####   #######
+	//  ###     ##  
+	//  ####    ##  
+	//  #####   ##  
+	//  ## ##   ##  
+	//  ## ###  ##  
+	//  ##  ### ##  
+	//  ##   ## ##  
+	//  ##   #####  
+	//  ##    ####  
+	//  ##     ###  
+	//#######   ##  
+	//#######   ##  
+	0x78, 0xFF, 0x1C, 0x18, 0x3C, 0x30, 0x7C, 0x60, 0xD8, 0xC1, 0xB9, 0x83, 0x3B, 0x06, 0x36, 0x0C,
+	0x7C, 0x18, 0x78, 0x30, 0x71, 0xFC, 0x64,
+
+	// @634 'O' (12x14)
+	//    ####    
+	//  ########  
+	// ###    ### 
+	// ##      ## 
+	//###      ###
+	//##        ##
+	//##        ##
+	//##        ##
+	//##        ##
+	//###      ###
+	// ##      ## 
+	// ###    ### 
+	//  ########  
+	//    ####    
+	0x07, 0x80, 0xFF, 0x0E, 0x1C, 0x60, 0x67, 0x03, 0xB0, 0x0F, 0xB8, 0x1C, 0xC0, 0xC7, 0x0E, 0x1F,
+	0xE0, 0x3C, 0x00,
+
+	// @653 'P' (12x14)
+	//##########  
+	//########### 
+	//  ##     ###
+	//  ##      ##
+	//  ##      ##
+	//  ##      ##
+	//  ##     ## 
+	//  ######### 
+	//  #######   
+	//  ##        
+	//  ##        
+	//  ##        
+	//########    
+	//########    
+	0x7F, 0xE3, 0xFF, 0x86, 0x0E, 0x30, 0x3C, 0x60, 0xC3, 0xFE, 0x1F, 0xC0, 0xC0, 0x37, 0xF8, 0x40,
+
+	// @669 'Q' (12x17)
+	//    ####    
+	//  ########  
+	// ###    ### 
+	// ##      ## 
+	//###      ###
+	//##        ##
+	//##        ##
+	//##        ##
+	//##        ##
+	//###      ###
+	// ##      ## 
+	// ###    ### 
+	//  ########  
+	//   #####    
+	//   #####  ##
+	//  ##########
+	//  ##    ### 
+	0x07, 0x80, 0xFF, 0x0E, 0x1C, 0x60, 0x67, 0x03, 0xB0, 0x0F, 0xB8, 0x1C, 0xC0, 0xC7, 0x0E, 0x1F,
+	0xE0, 0x7C, 0x03, 0xE6, 0x3F, 0xF1, 0x87, 0x00,
+
+	// @693 'R' (14x14)
+	//##########    
+	//###########   
+	//  ##     ###  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##     ###  
+	//  #########   
+	//  #######     
+	//  ##   ###    
+	//  ##    ###   
+	//  ##     ##   
+	//  ##     ###  
+	//#######   ####
+	//#######    ###
+	0x7F, 0xE0, 0xFF, 0xE0, 0x60, 0xE0, 0xC0, 0xC8, 0xC1, 0xC1, 0xFF, 0x03, 0xF8, 0x06, 0x38, 0x0C,
+	0x38, 0x18, 0x30, 0x30, 0x71, 0xFC, 0x7B, 0xF8, 0x70,
+
+	// @718 'S' (10x14)
+	//  ##### ##
+	// #########
+	//###    ###
+	//##      ##
+	//##      ##
+	//####      
+	// ######   
+	//   ###### 
+	//      ####
+	//##      ##
+	//##      ##
+	//###    ###
+	//######### 
+	//## #####  
+	0x1F, 0x67, 0xFD, 0xC3, 0xB0, 0x3B, 0xC0, 0x3F, 0x01, 0xF8, 0x07, 0xB0, 0x3B, 0x87, 0x7F, 0xCD,
+	0xF0,
+
+	// @735 'T' (12x14)
+	//############
+	//############
+	//##   ##   ##
+	//##   ##   ##
+	//##   ##   ##
+	//##   ##   ##
+	//     ##     
+	//     ##     
+	//     ##     
+	//     ##     
+	//     ##     
+	//     ##     
+	//  ########  
+	//  ########  
+	0x7F, 0xFD, 0x8C, 0x7C, 0x0C, 0x1F, 0x1F, 0xE4,
+
+	// @743 'U' (14x14)
+	//######  ######
+	//######  ######
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//   ##    ##   
+	//   ########   
+	//     ####     
+	0x7E, 0x7F, 0x18, 0x19, 0xFE, 0x18, 0x60, 0x3F, 0xC0, 0x1E, 0x00,
+
+	// @754 'V' (15x14)
+	//####### #######
+	//####### #######
+	//  ##       ##  
+	//   ##     ##   
+	//   ##     ##   
+	//   ##     ##   
+	//    ##   ##    
+	//    ##   ##    
+	//     ## ##     
+	//     ## ##     
+	//     ## ##     
+	//      ###      
+	//      ###      
+	//       #       
+	0x7F, 0x7F, 0x8C, 0x06, 0x06, 0x0C, 0x60, 0xC6, 0x10, 0x36, 0x0C, 0x07, 0x02, 0x01, 0x00,
+
+	// @769 'W' (17x14)
+	//#######   #######
+	//#######   #######
+	//  ##         ##  
+	//  ##         ##  
+	//  ##    #    ##  
+	//   ##  ###  ##   
+	//   ##  ###  ##   
+	//   ## ## ## ##   
+	//   ## ## ## ##   
+	//   ####  #####   
+	//    ###   ###    
+	//    ###   ###    
+	//    ##     ##    
+	//    ##     ##    
+	0x7F, 0x1F, 0xE3, 0x00, 0x64, 0x61, 0x0C, 0x0C, 0xE6, 0x21, 0xB6, 0xC4, 0x3C, 0xF8, 0x07, 0x1C,
+	0x20, 0xC1, 0x84,
+
+	// @788 'X' (14x14)
+	//######  ######
+	//######  ######
+	//  ##      ##  
+	//   ##    ##   
+	//    ##  ##    
+	//     ####     
+	//      ##      
+	//      ##      
+	//     ####     
+	//    ##  ##    
+	//   ##    ##   
+	//  ##      ##  
+	//######  ######
+	//######  ######
+	0x7E, 0x7F, 0x18, 0x18, 0x18, 0x60, 0x19, 0x80, 0x1E, 0x00, 0x18, 0x10, 0x3C, 0x00, 0xCC, 0x03,
+	0x0C, 0x0C, 0x0C, 0x7E, 0x7F,
+
+	// @809 'Y' (14x14)
+	//#####   ######
+	//#####   ######
+	//  ##      ##  
+	//   ##    ##   
+	//    ##  ##    
+	//    ##  ##    
+	//     ####     
+	//      ##      
+	//      ##      
+	//      ##      
+	//      ##      
+	//      ##      
+	//   ########   
+	//   ########   
+	0x7C, 0x7F, 0x18, 0x18, 0x18, 0x60, 0x19, 0x84, 0x0F, 0x00, 0x0C, 0x0F, 0x0F, 0xF1,
+
+	// @823 'Z' (11x14)
+	// ##########
+	// ##########
+	// ##      ##
+	// ##     ## 
+	// ##    ##  
+	// ##   ##   
+	//     ##    
+	//    ##     
+	//   ##    ##
+	//  ##     ##
+	// ##      ##
+	//##       ##
+	//###########
+	//###########
+	0x3F, 0xF9, 0x81, 0x98, 0x31, 0x86, 0x18, 0xC0, 0x18, 0x03, 0x00, 0x61, 0x8C, 0x19, 0x81, 0xB0,
+	0x1B, 0xFF, 0xC0,
+
+	// @842 '[' (5x18)
+	//#####
+	//#####
+	//##   
+	//##   
+	//##   
+	//##   
+	//##   
+	//##   
+	//##   
+	//##   
+	//##   
+	//##   
+	//##   
+	//##   
+	//##   
+	//##   
+	//#####
+	//#####
+	0x7E, 0xC7, 0xFF, 0xDF, 0x80,
+
+	// @847 '\' (10x20)
+	//##        
+	//##        
+	//###       
+	// ##       
+	// ###      
+	//  ##      
+	//  ##      
+	//   ##     
+	//   ##     
+	//    ##    
+	//    ##    
+	//     ##   
+	//     ##   
+	//      ##  
+	//      ##  
+	//      ### 
+	//       ## 
+	//       ###
+	//        ##
+	//        ##
+	0x60, 0x17, 0x00, 0x60, 0x0E, 0x00, 0xC0, 0x86, 0x08, 0x30, 0x81, 0x88, 0x0C, 0x80, 0xE0, 0x0C,
+	0x01, 0xC0, 0x1C,
+
+	// @866 ']' (5x18)
+	//#####
+	//#####
+	//   ##
+	//   ##
+	//   ##
+	//   ##
+	//   ##
+	//   ##
+	//   ##
+	//   ##
+	//   ##
+	//   ##
+	//   ##
+	//   ##
+	//   ##
+	//   ##
+	//#####
+	//#####
+	0x7E, 0x1F, 0xFF, 0xDF, 0x80,
+
+	// @871 '^' (11x8)
+	//     #     
+	//    ###    
+	//   #####   
+	//  ### ###  
+	//  ##   ##  
+	// ##     ## 
+	//##       ##
+	//#         #
+	0x02, 0x00, 0x70, 0x0F, 0x81, 0xDC, 0x18, 0xC3, 0x06, 0x60, 0x34, 0x01,
+
+	// @883 '_' (16x2)
+	//################
+	//################
+	0x7F, 0xFF, 0xC0,
+
+	// @886 '`' (5x4)
+	//##   
+	//###  
+	//  ###
+	//   ##
+	0x61, 0xC1, 0xC3,
+
+	// @889 'a' (12x11)
+	//  ######    
+	// ########   
+	//        ##  
+	//        ##  
+	//   #######  
+	// #########  
+	//###     ##  
+	//##      ##  
+	//##     ###  
+	// ###########
+	//  ##### ####
+	0x1F, 0x81, 0xFE, 0x00, 0x19, 0x0F, 0xE1, 0xFF, 0x1C, 0x18, 0xC0, 0xC6, 0x0E, 0x1F, 0xFC, 0x7D,
+	0xE0,
+
+	// @906 'b' (13x15)
+	//####         
+	//####         
+	//  ##         
+	//  ##         
+	//  ## #####   
+	//  ########## 
+	//  ###     ## 
+	//  ##       ##
+	//  ##       ##
+	//  ##       ##
+	//  ##       ##
+	//  ##       ##
+	//  ###     ## 
+	//############ 
+	//#### #####   
+	0x78, 0x02, 0x30, 0x04, 0x6F, 0x81, 0xFF, 0x87, 0x06, 0x18, 0x0F, 0xC7, 0x06, 0x7F, 0xF9, 0xEF,
+	0x80,
+
+	// @923 'c' (12x11)
+	//    ##### ##
+	//  ##########
+	// ###     ###
+	//###       ##
+	//##        ##
+	//##          
+	//##          
+	//###       ##
+	// ###     ###
+	//  ######### 
+	//    ######  
+	0x07, 0xD8, 0xFF, 0xCE, 0x0E, 0xE0, 0x36, 0x01, 0xB0, 0x02, 0xE0, 0x33, 0x83, 0x8F, 0xF8, 0x1F,
+	0x80,
+
+	// @940 'd' (13x15)
+	//       ####  
+	//       ####  
+	//         ##  
+	//         ##  
+	//   ##### ##  
+	// ##########  
+	// ##     ###  
+	//##       ##  
+	//##       ##  
+	//##       ##  
+	//##       ##  
+	//##       ##  
+	// ##     ###  
+	// ############
+	//   ##### ####
+	0x00, 0xF2, 0x00, 0x64, 0x3E, 0xC3, 0xFF, 0x0C, 0x1C, 0x60, 0x33, 0xCC, 0x1C, 0x3F, 0xFC, 0x3E,
+	0xF0,
+
+	// @957 'e' (12x11)
+	//   ######   
+	// ########## 
+	// ##      ## 
+	//##        ##
+	//############
+	//############
+	//##          
+	//##          
+	// ##       ##
+	// ###########
+	//   #######  
+	0x0F, 0xC1, 0xFF, 0x8C, 0x0C, 0xC0, 0x37, 0xFF, 0xD8, 0x01, 0x30, 0x19, 0xFF, 0xC3, 0xF8,
+
+	// @972 'f' (12x15)
+	//     #######
+	//    ########
+	//   ##       
+	//   ##       
+	//########### 
+	//########### 
+	//   ##       
+	//   ##       
+	//   ##       
+	//   ##       
+	//   ##       
+	//   ##       
+	//   ##       
+	//##########  
+	//##########  
+	0x03, 0xF8, 0x3F, 0xC3, 0x01, 0x7F, 0xF4, 0x30, 0x1F, 0xBF, 0xF2,
+
+	// @983 'g' (13x16)
+	//   ##### ####
+	// ############
+	// ##     ###  
+	//##       ##  
+	//##       ##  
+	//##       ##  
+	//##       ##  
+	//##       ##  
+	// ##     ###  
+	// ##########  
+	//   ##### ##  
+	//         ##  
+	//         ##  
+	//        ###  
+	//  ########   
+	//  ######     
+	0x0F, 0xBC, 0xFF, 0xF3, 0x07, 0x18, 0x0C, 0xF3, 0x07, 0x0F, 0xFC, 0x0F, 0xB0, 0x00, 0xC8, 0x03,
+	0x83, 0xFC, 0x0F, 0xC0,
+
+	// @1003 'h' (14x15)
+	//####          
+	//####          
+	//  ##          
+	//  ##          
+	//  ## #####    
+	//  #########   
+	//  ###    ###  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//######  ######
+	//######  ######
+	0x78, 0x01, 0x18, 0x01, 0x1B, 0xE0, 0x3F, 0xE0, 0x70, 0xE0, 0xC0, 0xCF, 0xBF, 0x3F, 0x80,
+
+	// @1018 'i' (12x15)
+	//     ##     
+	//     ##     
+	//            
+	//            
+	// ######     
+	// ######     
+	//     ##     
+	//     ##     
+	//     ##     
+	//     ##     
+	//     ##     
+	//     ##     
+	//     ##     
+	//############
+	//############
+	0x03, 0x04, 0x00, 0x13, 0xF0, 0x40, 0xC1, 0xFB, 0xFF, 0xE0,
+
+	// @1028 'j' (9x20)
+	//     ##  
+	//     ##  
+	//         
+	//         
+	//#########
+	//#########
+	//       ##
+	//       ##
+	//       ##
+	//       ##
+	//       ##
+	//       ##
+	//       ##
+	//       ##
+	//       ##
+	//       ##
+	//       ##
+	//      ###
+	//######## 
+	//######   
+	0x03, 0x20, 0x05, 0xFF, 0x80, 0x7F, 0xF8, 0x0E, 0xFF, 0x3F, 0x00,
+
+	// @1039 'k' (12x15)
+	//####        
+	//####        
+	//  ##        
+	//  ##        
+	//  ##  ##### 
+	//  ##  ##### 
+	//  ##  ##    
+	//  ## ##     
+	//  #####     
+	//  ####      
+	//  #####     
+	//  ## ###    
+	//  ##  ###   
+	//####   #####
+	//####   #####
+	0x78, 0x04, 0x60, 0x11, 0x9F, 0x46, 0x60, 0x36, 0x01, 0xF0, 0x0F, 0x00, 0x7C, 0x03, 0x70, 0x19,
+	0xC3, 0xC7, 0xE0,
+
+	// @1058 'l' (12x15)
+	// ######     
+	// ######     
+	//     ##     
+	//     ##     
+	//     ##     
+	//     ##     
+	//     ##     
+	//     ##     
+	//     ##     
+	//     ##     
+	//     ##     
+	//     ##     
+	//     ##     
+	//############
+	//############
+	0x3F, 0x04, 0x0C, 0x1F, 0xFB, 0xFF, 0xE0,
+
+	// @1065 'm' (16x11)
+	//#### ### ####   
+	//##############  
+	//  ###  ###  ##  
+	//  ##   ##   ##  
+	//  ##   ##   ##  
+	//  ##   ##   ##  
+	//  ##   ##   ##  
+	//  ##   ##   ##  
+	//  ##   ##   ##  
+	//###### #### ####
+	//###### #### ####
+	0x7B, 0xBC, 0x3F, 0xFF, 0x07, 0x39, 0x83, 0x18, 0xCF, 0xBF, 0x7B, 0xE0,
+
+	// @1077 'n' (14x11)
+	//#### #####    
+	//###########   
+	//  ###    ###  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//######  ######
+	//######  ######
+	0x7B, 0xE0, 0xFF, 0xE0, 0x70, 0xE0, 0xC0, 0xCF, 0xBF, 0x3F, 0x80,
+
+	// @1088 'o' (12x11)
+	//    ####    
+	//  ########  
+	// ###    ### 
+	//###      ###
+	//##        ##
+	//##        ##
+	//##        ##
+	//###      ###
+	// ###    ### 
+	//  ########  
+	//    ####    
+	0x07, 0x80, 0xFF, 0x0E, 0x1C, 0xE0, 0x76, 0x01, 0xEE, 0x07, 0x38, 0x70, 0xFF, 0x01, 0xE0,
+
+	// @1103 'p' (13x16)
+	//#### #####   
+	//############ 
+	//  ###     ## 
+	//  ##       ##
+	//  ##       ##
+	//  ##       ##
+	//  ##       ##
+	//  ##       ##
+	//  ###     ## 
+	//  ########## 
+	//  ## #####   
+	//  ##         
+	//  ##         
+	//  ##         
+	//#######      
+	//#######      
+	0x7B, 0xE1, 0xFF, 0xE1, 0xC1, 0x86, 0x03, 0xF1, 0xC1, 0x87, 0xFE, 0x1B, 0xE0, 0x60, 0x0D, 0xFC,
+	0x08,
+
+	// @1120 'q' (13x16)
+	//   ##### ####
+	// ############
+	// ##     ###  
+	//##       ##  
+	//##       ##  
+	//##       ##  
+	//##       ##  
+	//##       ##  
+	// ##     ###  
+	// ##########  
+	//   ##### ##  
+	//         ##  
+	//         ##  
+	//         ##  
+	//      #######
+	//      #######
+	0x0F, 0xBC, 0xFF, 0xF3, 0x07, 0x18, 0x0C, 0xF3, 0x07, 0x0F, 0xFC, 0x0F, 0xB0, 0x00, 0xCC, 0x07,
+	0xF8,
+
+	// @1137 'r' (12x11)
+	//#####  #### 
+	//##### ######
+	//   #####  ##
+	//   ###      
+	//   ##       
+	//   ##       
+	//   ##       
+	//   ##       
+	//   ##       
+	//##########  
+	//##########  
+	0x7C, 0xF3, 0xEF, 0xC3, 0xE6, 0x1C, 0x00, 0xC0, 0x7B, 0xFF, 0x20,
+
+	// @1148 's' (10x11)
+	//  ########
+	// #########
+	//##      ##
+	//##      ##
+	//######    
+	// ######## 
+	//     #####
+	//##      ##
+	//##     ###
+	//######### 
+	//########  
+	0x1F, 0xE7, 0xFD, 0x81, 0xDF, 0x81, 0xFE, 0x03, 0xEC, 0x0D, 0x83, 0xBF, 0xE7, 0xF8,
+
+	// @1162 't' (12x15)
+	//  ##        
+	//  ##        
+	//  ##        
+	//  ##        
+	//##########  
+	//##########  
+	//  ##        
+	//  ##        
+	//  ##        
+	//  ##        
+	//  ##        
+	//  ##        
+	//  ##     ###
+	//   #########
+	//    ######  
+	0x18, 0x07, 0x7F, 0xE4, 0x60, 0x1F, 0x18, 0x38, 0x7F, 0xC1, 0xF8,
+
+	// @1173 'u' (14x11)
+	//####    ####  
+	//####    ####  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##      ##  
+	//  ##     ###  
+	//   ###########
+	//    ##### ####
+	0x78, 0x79, 0x18, 0x19, 0xF1, 0x83, 0x81, 0xFF, 0xC1, 0xF7, 0x80,
+
+	// @1184 'v' (14x11)
+	//#####    #####
+	//#####    #####
+	//  ##      ##  
+	//  ##      ##  
+	//   ##    ##   
+	//   ##    ##   
+	//    ##  ##    
+	//    ##  ##    
+	//    ######    
+	//     ####     
+	//     ####     
+	0x7C, 0x3F, 0x18, 0x19, 0x0C, 0x31, 0x06, 0x61, 0x07, 0xE0, 0x07, 0x82,
+
+	// @1196 'w' (13x11)
+	//####     ####
+	//####     ####
+	// ##   #   ## 
+	// ##  ###  ## 
+	// ##  ###  ## 
+	//  ## # # ##  
+	//  #### ####  
+	//  #### ####  
+	//  ###   ##   
+	//   ##   ##   
+	//   ##   ##   
+	0x78, 0x3E, 0x62, 0x31, 0x9C, 0xD1, 0xAB, 0x07, 0xBC, 0x8E, 0x30, 0x18, 0xC4,
+
+	// @1209 'x' (12x11)
+	//#####  #####
+	//#####  #####
+	//  ##    ##  
+	//   ##  ##   
+	//    ####    
+	//     ##     
+	//    ####    
+	//   ##  ##   
+	//  ##    ##  
+	//#####  #####
+	//#####  #####
+	0x7C, 0xFC, 0x61, 0x81, 0x98, 0x07, 0x80, 0x18, 0x01, 0xE0, 0x19, 0x81, 0x86, 0x3E, 0x7E,
+
+	// @1224 'y' (15x16)
+	//######    #####
+	//######    #####
+	//  ##       ##  
+	//   ##     ##   
+	//   ##     ##   
+	//    ##   ##    
+	//    ##   ##    
+	//     ## ##     
+	//     #####     
+	//      ###      
+	//       ##      
+	//      ##       
+	//      ##       
+	//     ##        
+	// ########      
+	// ########      
+	0x7E, 0x1F, 0x8C, 0x06, 0x06, 0x0C, 0x41, 0x8C, 0x20, 0x6C, 0x00, 0x7C, 0x00, 0x38, 0x00, 0x18,
+	0x00, 0x30, 0x10, 0x30, 0x03, 0xFC, 0x08,
+
+	// @1247 'z' (10x11)
+	//##########
+	//##########
+	//##     ## 
+	//##    ##  
+	//     ##   
+	//    ##    
+	//   ##     
+	//  ##    ##
+	// ##     ##
+	//##########
+	//##########
+	0x7F, 0xF6, 0x0C, 0xC3, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x0C, 0xC1, 0xBF, 0xF8,
+
+	// @1260 '{' (6x18)
+	//   ###
+	//  ####
+	//  ##  
+	//  ##  
+	//  ##  
+	//  ##  
+	//  ##  
+	//  ##  
+	// ###  
+	//###   
+	// ###  
+	//  ##  
+	//  ##  
+	//  ##  
+	//  ##  
+	//  ##  
+	//  ####
+	//   ###
+	0x0E, 0x3C, 0x67, 0xCE, 0x38, 0x38, 0x33, 0xC7, 0x87,
+
+	// @1269 '|' (2x18)
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	//##
+	0x7F, 0xFF, 0xF0,
+
+	// @1272 '}' (6x18)
+	//###   
+	//####  
+	//  ##  
+	//  ##  
+	//  ##  
+	//  ##  
+	//  ##  
+	//  ##  
+	//  ### 
+	//   ###
+	//  ### 
+	//  ##  
+	//  ##  
+	//  ##  
+	//  ##  
+	//  ##  
+	//####  
+	//###   
+	0x70, 0xF0, 0x67, 0xC7, 0x07, 0x1C, 0x33, 0xDE, 0x38,
+
+	// @1281 '~' (11x5)
+	//  ###      
+	// #####   ##
+	//### ### ###
+	//##   ##### 
+	//      ###  
+	0x1C, 0x03, 0xE3, 0x77, 0x76, 0x3E, 0x01, 0xC0,
+
+	// @1289 degree sign (7x7)
+	// ##### 
+	//#######
+	//### ###
+	//##   ##
+	//### ###
+	//#######
+	// ##### 
+	0x3E, 0x7F, 0x77, 0x63, 0x77, 0x7F, 0x3E,
+};
+
+const sGLYPH Font24P_Glyphs[] =
+{
+	//Offset, Width, Height, Left, Top, Advance
+	{0, 0, 0, 0, 0, 8}, // ' '
+	{0, 3, 15, 1, 2, 5}, // '!'
+	{4, 8, 7, 1, 3, 10}, // '"'
+	{7, 11, 16, 1, 2, 13}, // '#'
+	{18, 9, 19, 1, 1, 11}, // '$'
+	{37, 10, 15, 1, 2, 12}, // '%'
+	{56, 11, 13, 1, 4, 13}, // '&'
+	{75, 3, 7, 1, 3, 5}, // '''
+	{77, 6, 18, 1, 2, 8}, // '('
+	{87, 6, 18, 1, 2, 8}, // ')'
+	{97, 10, 10, 1, 2, 12}, // '*'
+	{106, 12, 12, 1, 4, 14}, // '+'
+	{112, 5, 7, 1, 14, 7}, // ','
+	{116, 10, 2, 1, 9, 12}, // '-'
+	{118, 4, 3, 1, 14, 6}, // '.'
+	{119, 10, 20, 1, 0, 12}, // '/'
+	{138, 10, 15, 1, 2, 12}, // '0'
+	{149, 10, 15, 1, 2, 12}, // '1'
+	{159, 11, 15, 1, 2, 13}, // '2'
+	{179, 10, 15, 1, 2, 12}, // '3'
+	{196, 11, 15, 1, 2, 13}, // '4'
+	{212, 11, 15, 1, 2, 13}, // '5'
+	{227, 10, 15, 1, 2, 12}, // '6'
+	{246, 10, 15, 1, 2, 12}, // '7'
+	{261, 10, 15, 1, 2, 12}, // '8'
+	{277, 10, 15, 1, 2, 12}, // '9'
+	{296, 4, 11, 1, 6, 6}, // ':'
+	{299, 6, 13, 1, 6, 8}, // ';'
+	{306, 14, 13, 1, 4, 16}, // '<'
+	{331, 13, 6, 1, 7, 15}, // '='
+	{337, 14, 13, 1, 4, 16}, // '>'
+	{362, 9, 14, 1, 3, 11}, // '?'
+	{377, 10, 17, 1, 2, 12}, // '@'
+	{398, 16, 14, 1, 3, 18}, // 'A'
+	{422, 13, 14, 1, 3, 15}, // 'B'
+	{442, 12, 14, 1, 3, 14}, // 'C'
+	{459, 13, 14, 1, 3, 15}, // 'D'
+	{476, 12, 14, 1, 3, 14}, // 'E'
+	{492, 12, 14, 1, 3, 14}, // 'F'
+	{506, 13, 14, 1, 3, 15}, // 'G'
+	{528, 14, 14, 1, 3, 16}, // 'H'
+	{539, 10, 14, 1, 3, 12}, // 'I'
+	{545, 13, 14, 1, 3, 15}, // 'J'
+	{557, 15, 14, 1, 3, 17}, // 'K'
+	{582, 13, 14, 1, 3, 15}, // 'L'
+	{591, 16, 14, 1, 3, 18}, // 'M'
+	{611, 14, 14, 1, 3, 16}, // 'N'
+	{634, 12, 14, 1, 3, 14}, // 'O'
+	{653, 12, 14, 1, 3, 14}, // 'P'
+	{669, 12, 17, 1, 3, 14}, // 'Q'
+	{693, 14, 14, 1, 3, 16}, // 'R'
+	{718, 10, 14, 1, 3, 12}, // 'S'
+	{735, 12, 14, 1, 3, 14}, // 'T'
+	{743, 14, 14, 1, 3, 16}, // 'U'
+	{754, 15, 14, 1, 3, 17}, // 'V'
+	{769, 17, 14, 1, 3, 19}, // 'W'
+	{788, 14, 14, 1, 3, 16}, // 'X'
+	{809, 14, 14, 1, 3, 16}, // 'Y'
+	{823, 11, 14, 1, 3, 13}, // 'Z'
+	{842, 5, 18, 1, 2, 7}, // '['
+	{847, 10, 20, 1, 0, 12}, // '\'
+	{866, 5, 18, 1, 2, 7}, // ']'
+	{871, 11, 8, 1, 1, 13}, // '^'
+	{883, 16, 2, 1, 22, 18}, // '_'
+	{886, 5, 4, 1, 1, 7}, // '`'
+	{889, 12, 11, 1, 6, 14}, // 'a'
+	{906, 13, 15, 1, 2, 15}, // 'b'
+	{923, 12, 11, 1, 6, 14}, // 'c'
+	{940, 13, 15, 1, 2, 15}, // 'd'
+	{957, 12, 11, 1, 6, 14}, // 'e'
+	{972, 12, 15, 1, 2, 14}, // 'f'
+	{983, 13, 16, 1, 6, 15}, // 'g'
+	{1003, 14, 15, 1, 2, 16}, // 'h'
+	{1018, 12, 15, 1, 2, 14}, // 'i'
+	{1028, 9, 20, 1, 2, 11}, // 'j'
+	{1039, 12, 15, 1, 2, 14}, // 'k'
+	{1058, 12, 15, 1, 2, 14}, // 'l'
+	{1065, 16, 11, 1, 6, 18}, // 'm'
+	{1077, 14, 11, 1, 6, 16}, // 'n'
+	{1088, 12, 11, 1, 6, 14}, // 'o'
+	{1103, 13, 16, 1, 6, 15}, // 'p'
+	{1120, 13, 16, 1, 6, 15}, // 'q'
+	{1137, 12, 11, 1, 6, 14}, // 'r'
+	{1148, 10, 11, 1, 6, 12}, // 's'
+	{1162, 12, 15, 1, 2, 14}, // 't'
+	{1173, 14, 11, 1, 6, 16}, // 'u'
+	{1184, 14, 11, 1, 6, 16}, // 'v'
+	{1196, 13, 11, 1, 6, 15}, // 'w'
+	{1209, 12, 11, 1, 6, 14}, // 'x'
+	{1224, 15, 16, 1, 6, 17}, // 'y'
+	{1247, 10, 11, 1, 6, 12}, // 'z'
+	{1260, 6, 18, 1, 2, 8}, // '{'
+	{1269, 2, 18, 1, 2, 4}, // '|'
+	{1272, 6, 18, 1, 2, 8}, // '}'
+	{1281, 11, 5, 1, 8, 13}, // '~'
+	{1289, 7, 7, 1, 2, 9}, // degree sign
+	{1289, 7, 7, 1, 2, 9}, // U+00B0
+};
+
+const sRANGE Font24P_Ranges[] =
+{
+	//First, Count, Index
+	{0x00B0, 1, 96}, // U+00B0
+};
+
+sFONT Font24P = {
+  Font24P_Table,
+  19, /* Width */
+  24, /* Height */
+  Font24P_Glyphs,
+  0x20, /* First */
+  0x7F, /* Last */
+  FONT_ENCODING_ROWS,
+  0, /* Map: every code from First to Last */
+  '?', /* Fallback */
+  Font24P_Ranges,
+  1, /* RangeCount */
+  0, /* Kerning: none */
+  0, /* KernCount */
+};
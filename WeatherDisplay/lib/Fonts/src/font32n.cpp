@@ -0,0 +1,441 @@
+/**
+  ******************************************************************************
+  * @file    font32n.cpp
+  * @brief   Proportional version of Font32: every glyph is cut to its ink
+  *          and packed without row padding, see sGLYPH in fonts.h.
+  *          Rows equal to the one above are stored as a single bit
+  *          (FONT_ENCODING_ROWS).
+  *          Generated by tools/fontgen, do not edit:
+  *          fontgen -e ROWS -c 32,37,43,45-46,48-57,63,67,70,127,176=127 -n Font32N -o font32n.cpp font32.cpp
+  ******************************************************************************
+  */
+
+#include "fonts.h"
+
+const uint8_t Font32N_Table[] =
+{
+	// @0 '%' (12x20)
+	// #####   ###
+	//#######  ###
+	//### ### ### 
+	//### ### ### 
+	//##########  
+	// ##### ###  
+	//      ###   
+	//      ###   
+	//     ###    
+	//     ###    
+	//    ###     
+	//    ###     
+	//   ###      
+	//   ###      
+	//  ### ##### 
+	//  ##########
+	// ### ### ###
+	// ### ### ###
+	//###  #######
+	//###   ##### 
+	0x3E, 0x3B, 0xF9, 0xDD, 0xDD, 0x7F, 0xE1, 0xF7, 0x00, 0x71, 0x03, 0x84, 0x1C, 0x10, 0xE0, 0x47,
+	0x7C, 0x3F, 0xF3, 0xBB, 0xDC, 0xFE, 0xE3, 0xE0,
+
+	// @24 '+' (13x12)
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//#############
+	//#############
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	0x03, 0x83, 0xDF, 0xFF, 0x81, 0xC1, 0xE0,
+
+	// @31 '-' (13x2)
+	//#############
+	//#############
+	0x7F, 0xFE,
+
+	// @33 '.' (3x4)
+	//###
+	//###
+	//###
+	//###
+	0x7E,
+
+	// @34 '0' (13x20)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###      ####
+	//###     #####
+	//###    ######
+	//###   ### ###
+	//###  ###  ###
+	//### ###   ###
+	//######    ###
+	//#####     ###
+	//####      ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####     ####
+	// ########### 
+	//  #########  
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0xB8, 0x1E, 0xE0, 0xFB, 0x87, 0xEE, 0x3B, 0xB9, 0xCE,
+	0xEE, 0x3B, 0xF0, 0xEF, 0x83, 0xBC, 0x0E, 0xE0, 0x3E, 0xF0, 0x79, 0xFF, 0xC3, 0xFE, 0x00,
+
+	// @65 '1' (9x20)
+	//   ###   
+	//  ####   
+	// #####   
+	//######   
+	//######   
+	//   ###   
+	//   ###   
+	//   ###   
+	//   ###   
+	//   ###   
+	//   ###   
+	//   ###   
+	//   ###   
+	//   ###   
+	//   ###   
+	//   ###   
+	//   ###   
+	//   ###   
+	//#########
+	//#########
+	0x0E, 0x07, 0x83, 0xE1, 0xF8, 0x87, 0x1F, 0xFE, 0xFF, 0xC0,
+
+	// @75 '2' (13x20)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//          ###
+	//         ### 
+	//        ###  
+	//       ###   
+	//      ###    
+	//     ###     
+	//    ###      
+	//   ###       
+	//  ###        
+	// ###         
+	//###          
+	//#############
+	//#############
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0xE0, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38,
+	0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x03, 0xFF, 0xF0,
+
+	// @104 '3' (13x20)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//          ###
+	//          ###
+	//          ###
+	//         ####
+	//   ######### 
+	//   ######### 
+	//         ####
+	//          ###
+	//          ###
+	//          ###
+	//###       ###
+	//###       ###
+	//####     ####
+	// ########### 
+	//  #########  
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0x80, 0x0F, 0x80, 0x1E, 0x1F, 0xF4, 0x00, 0xF0, 0x01,
+	0xF7, 0x01, 0xEF, 0x07, 0x9F, 0xFC, 0x3F, 0xE0,
+
+	// @128 '4' (13x20)
+	//          ###
+	//         ####
+	//        #####
+	//       ######
+	//      ### ###
+	//     ###  ###
+	//    ###   ###
+	//   ###    ###
+	//  ###     ###
+	// ###      ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//#############
+	//#############
+	//          ###
+	//          ###
+	//          ###
+	//          ###
+	//          ###
+	0x00, 0x1C, 0x00, 0xF0, 0x07, 0xC0, 0x3F, 0x01, 0xDC, 0x0E, 0x70, 0x71, 0xC3, 0x87, 0x1C, 0x1C,
+	0xE0, 0x77, 0x01, 0xF7, 0xFF, 0xE0, 0x03, 0xF8,
+
+	// @152 '5' (13x20)
+	//#############
+	//#############
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###########  
+	//############ 
+	//         ####
+	//          ###
+	//          ###
+	//          ###
+	//          ###
+	//          ###
+	//###       ###
+	//####      ###
+	// ########### 
+	//  #########  
+	0x7F, 0xFE, 0xE0, 0x07, 0xDF, 0xFC, 0x7F, 0xF8, 0x00, 0xF0, 0x01, 0xFD, 0xC0, 0x77, 0x81, 0xCF,
+	0xFE, 0x1F, 0xF0,
+
+	// @171 '6' (13x20)
+	//  ########## 
+	// ########### 
+	//####         
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###########  
+	//############ 
+	//###      ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####     ####
+	// ########### 
+	//  #########  
+	0x1F, 0xF8, 0xFF, 0xE7, 0x80, 0x1C, 0x00, 0xF7, 0xFF, 0x1F, 0xFE, 0x70, 0x3D, 0xC0, 0x7F, 0xBC,
+	0x1E, 0x7F, 0xF0, 0xFF, 0x80,
+
+	// @192 '7' (13x20)
+	//#############
+	//#############
+	//###       ###
+	//###       ###
+	//###       ###
+	//###      ### 
+	//         ### 
+	//        ###  
+	//        ###  
+	//       ###   
+	//       ###   
+	//      ###    
+	//      ###    
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	0x7F, 0xFE, 0xE0, 0x3E, 0xE0, 0x70, 0x01, 0xC0, 0x0E, 0x40, 0x38, 0x80, 0xE1, 0x03, 0x83, 0xF0,
+
+	// @208 '8' (13x20)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####     ####
+	// ########### 
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####     ####
+	// ########### 
+	//  #########  
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0xF7, 0x83, 0xCF, 0xFE, 0xBC, 0x1E, 0xE0, 0x3F, 0xBC,
+	0x1E, 0x7F, 0xF0, 0xFF, 0x80,
+
+	// @229 '9' (13x20)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####      ###
+	// ############
+	//  ###########
+	//          ###
+	//          ###
+	//          ###
+	//          ###
+	//          ###
+	//         ####
+	// ########### 
+	// ##########  
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0xFB, 0xC0, 0xE7, 0xFF, 0x8F, 0xFE, 0x00, 0x3F, 0x80,
+	0x1E, 0x7F, 0xF1, 0xFF, 0x80,
+
+	// @250 '?' (13x20)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//         ### 
+	//        ###  
+	//       ###   
+	//      ###    
+	//     ###     
+	//     ###     
+	//     ###     
+	//             
+	//             
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70,
+	0x60, 0x00, 0x40, 0xE0, 0xE0,
+
+	// @271 'C' (13x20)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###       ###
+	//###       ###
+	//####     ####
+	// ########### 
+	//  #########  
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0xB8, 0x01, 0xFF, 0x70, 0x1E, 0xF0, 0x79, 0xFF, 0xC3,
+	0xFE, 0x00,
+
+	// @289 'F' (13x20)
+	//#############
+	//#############
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//##########   
+	//##########   
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	0x7F, 0xFE, 0xE0, 0x07, 0xEF, 0xFC, 0x5C, 0x00, 0xFF,
+
+	// @298 degree sign (11x10)
+	//   #####   
+	//  #######  
+	// ###   ### 
+	// ##     ## 
+	//###     ###
+	//###     ###
+	// ##     ## 
+	// ###   ### 
+	//  #######  
+	//   #####   
+	0x0F, 0x81, 0xFC, 0x38, 0xE3, 0x06, 0x70, 0x79, 0x83, 0x1C, 0x70, 0xFE, 0x07, 0xC0,
+};
+
+const sGLYPH Font32N_Glyphs[] =
+{
+	//Offset, Width, Height, Left, Top, Advance
+	{0, 0, 0, 0, 0, 8}, // ' '
+	{0, 12, 20, 2, 7, 15}, // '%'
+	{24, 13, 12, 2, 11, 16}, // '+'
+	{31, 13, 2, 2, 16, 16}, // '-'
+	{33, 3, 4, 2, 23, 6}, // '.'
+	{34, 13, 20, 2, 7, 16}, // '0'
+	{65, 9, 20, 2, 7, 12}, // '1'
+	{75, 13, 20, 2, 7, 16}, // '2'
+	{104, 13, 20, 2, 7, 16}, // '3'
+	{128, 13, 20, 2, 7, 16}, // '4'
+	{152, 13, 20, 2, 7, 16}, // '5'
+	{171, 13, 20, 2, 7, 16}, // '6'
+	{192, 13, 20, 2, 7, 16}, // '7'
+	{208, 13, 20, 2, 7, 16}, // '8'
+	{229, 13, 20, 2, 7, 16}, // '9'
+	{250, 13, 20, 2, 7, 16}, // '?'
+	{271, 13, 20, 2, 7, 16}, // 'C'
+	{289, 13, 20, 2, 7, 16}, // 'F'
+	{298, 11, 10, 2, 3, 14}, // degree sign
+	{298, 11, 10, 2, 3, 14}, // U+00B0
+};
+
+const uint32_t Font32N_Map[] =
+{
+	0x83FF6821, 0x00000048, 0x80000000,
+};
+
+const sRANGE Font32N_Ranges[] =
+{
+	//First, Count, Index
+	{0x00B0, 1, 19}, // U+00B0
+};
+
+sFONT Font32N = {
+  Font32N_Table,
+  16, /* Width */
+  32, /* Height */
+  Font32N_Glyphs,
+  0x20, /* First */
+  0x7F, /* Last */
+  FONT_ENCODING_ROWS,
+  Font32N_Map,
+  '?', /* Fallback */
+  Font32N_Ranges,
+  1, /* RangeCount */
+  0, /* Kerning: none */
+  0, /* KernCount */
+};
@@ -0,0 +1,2108 @@
+/**
+  ******************************************************************************
+  * @file    font32p.cpp
+  * @brief   Proportional version of Font32: every glyph is cut to its ink
+  *          and packed without row padding, see sGLYPH in fonts.h.
+  *          Rows equal to the one above are stored as a single bit
+  *          (FONT_ENCODING_ROWS).
+  *          Generated by tools/fontgen, do not edit:
+  *          fontgen -e ROWS -n Font32P -o font32p.cpp font32.cpp
+  ******************************************************************************
+  */
+
+#include "fonts.h"
+
+const uint8_t Font32P_Table[] =
+{
+	// @0 '!' (3x20)
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//   
+	//   
+	//   
+	//###
+	//###
+	//###
+	//###
+	0x7F, 0xFF, 0x0D, 0xF8,
+
+	// @4 '"' (9x6)
+	//###   ###
+	//###   ###
+	//###   ###
+	//###   ###
+	//###   ###
+	//###   ###
+	0x71, 0xFE,
+
+	// @6 '#' (13x20)
+	//  ###   ###  
+	//  ###   ###  
+	//  ###   ###  
+	//  ###   ###  
+	//  ###   ###  
+	//#############
+	//#############
+	//  ###   ###  
+	//  ###   ###  
+	//  ###   ###  
+	//  ###   ###  
+	//  ###   ###  
+	//  ###   ###  
+	//#############
+	//#############
+	//  ###   ###  
+	//  ###   ###  
+	//  ###   ###  
+	//  ###   ###  
+	//  ###   ###  
+	0x1C, 0x73, 0xDF, 0xFF, 0x8E, 0x39, 0xF7, 0xFF, 0xE3, 0x8E, 0x78,
+
+	// @17 '$' (13x24)
+	//     ###     
+	//     ###     
+	//     ###     
+	//  #########  
+	// ########### 
+	//#### ### ####
+	//###  ###  ###
+	//###  ###     
+	//###  ###     
+	//###  ###     
+	//#### ###     
+	// ##########  
+	//  ########## 
+	//     ### ####
+	//     ###  ###
+	//     ###  ###
+	//     ###  ###
+	//###  ###  ###
+	//#### ### ####
+	// ########### 
+	//  #########  
+	//     ###     
+	//     ###     
+	//     ###     
+	0x03, 0x83, 0x1F, 0xF0, 0xFF, 0xE7, 0xBB, 0xDC, 0xE7, 0x73, 0x83, 0x7B, 0x80, 0xFF, 0xC1, 0xFF,
+	0x80, 0xEF, 0x03, 0x9F, 0x73, 0x9D, 0xEE, 0xF3, 0xFF, 0x87, 0xFC, 0x03, 0x83,
+
+	// @46 '%' (12x20)
+	// #####   ###
+	//#######  ###
+	//### ### ### 
+	//### ### ### 
+	//##########  
+	// ##### ###  
+	//      ###   
+	//      ###   
+	//     ###    
+	//     ###    
+	//    ###     
+	//    ###     
+	//   ###      
+	//   ###      
+	//  ### ##### 
+	//  ##########
+	// ### ### ###
+	// ### ### ###
+	//###  #######
+	//###   ##### 
+	0x3E, 0x3B, 0xF9, 0xDD, 0xDD, 0x7F, 0xE1, 0xF7, 0x00, 0x71, 0x03, 0x84, 0x1C, 0x10, 0xE0, 0x47,
+	0x7C, 0x3F, 0xF3, 0xBB, 0xDC, 0xFE, 0xE3, 0xE0,
+
+	// @70 '&' (14x20)
+	//   ######     
+	//  ########    
+	// ###    ###   
+	// ###    ###   
+	// ###    ###   
+	// ###    ###   
+	// ###    ###   
+	//  ###  ###    
+	//   ######     
+	//   #####      
+	//  #######  ###
+	// ###   ### ###
+	//###     ##### 
+	//###      ###  
+	//###      ###  
+	//###      ###  
+	//###      ###  
+	//####    ##### 
+	// ######### ###
+	//  #######  ###
+	0x0F, 0xC0, 0x3F, 0xC0, 0xE1, 0xC7, 0x8E, 0x70, 0x0F, 0xC0, 0x1F, 0x00, 0x7F, 0x39, 0xC7, 0x77,
+	0x07, 0xCE, 0x07, 0x3B, 0xC3, 0xE3, 0xFE, 0xE3, 0xF9, 0xC0,
+
+	// @96 ''' (3x6)
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	0x7F, 0x80,
+
+	// @98 '(' (7x20)
+	//    ###
+	//   ### 
+	//  ###  
+	// ###   
+	// ###   
+	//###    
+	//###    
+	//###    
+	//###    
+	//###    
+	//###    
+	//###    
+	//###    
+	//###    
+	//###    
+	// ###   
+	// ###   
+	//  ###  
+	//   ### 
+	//    ###
+	0x07, 0x0E, 0x1C, 0x38, 0xB8, 0x7F, 0xCE, 0x23, 0x81, 0xC0, 0xE0,
+
+	// @109 ')' (7x20)
+	//###    
+	// ###   
+	//  ###  
+	//   ### 
+	//   ### 
+	//    ###
+	//    ###
+	//    ###
+	//    ###
+	//    ###
+	//    ###
+	//    ###
+	//    ###
+	//    ###
+	//    ###
+	//   ### 
+	//   ### 
+	//  ###  
+	// ###   
+	//###    
+	0x70, 0x38, 0x1C, 0x0E, 0x83, 0xFF, 0xC3, 0xA3, 0x87, 0x0E, 0x00,
+
+	// @120 '*' (13x12)
+	// ###     ### 
+	//  ###   ###  
+	//   ### ###   
+	//    #####    
+	//     ###     
+	//#############
+	//#############
+	//     ###     
+	//    #####    
+	//   ### ###   
+	//  ###   ###  
+	// ###     ### 
+	0x38, 0x38, 0x71, 0xC0, 0xEE, 0x01, 0xF0, 0x03, 0x81, 0xFF, 0xF8, 0x1C, 0x00, 0xF8, 0x07, 0x70,
+	0x38, 0xE1, 0xC1, 0xC0,
+
+	// @140 '+' (13x12)
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//#############
+	//#############
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	0x03, 0x83, 0xDF, 0xFF, 0x81, 0xC1, 0xE0,
+
+	// @147 ',' (5x6)
+	//  ###
+	//  ###
+	//  ###
+	//  ###
+	// ### 
+	//###  
+	0x1F, 0x9C, 0xE0,
+
+	// @150 '-' (13x2)
+	//#############
+	//#############
+	0x7F, 0xFE,
+
+	// @152 '.' (3x4)
+	//###
+	//###
+	//###
+	//###
+	0x7E,
+
+	// @153 '/' (12x20)
+	//         ###
+	//         ###
+	//        ### 
+	//        ### 
+	//       ###  
+	//       ###  
+	//      ###   
+	//      ###   
+	//     ###    
+	//     ###    
+	//    ###     
+	//    ###     
+	//   ###      
+	//   ###      
+	//  ###       
+	//  ###       
+	// ###        
+	// ###        
+	//###         
+	//###         
+	0x00, 0x3C, 0x01, 0xD0, 0x0E, 0x40, 0x71, 0x03, 0x84, 0x1C, 0x10, 0xE0, 0x47, 0x01, 0x38, 0x05,
+	0xC0, 0x10,
+
+	// @171 '0' (13x20)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###      ####
+	//###     #####
+	//###    ######
+	//###   ### ###
+	//###  ###  ###
+	//### ###   ###
+	//######    ###
+	//#####     ###
+	//####      ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####     ####
+	// ########### 
+	//  #########  
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0xB8, 0x1E, 0xE0, 0xFB, 0x87, 0xEE, 0x3B, 0xB9, 0xCE,
+	0xEE, 0x3B, 0xF0, 0xEF, 0x83, 0xBC, 0x0E, 0xE0, 0x3E, 0xF0, 0x79, 0xFF, 0xC3, 0xFE, 0x00,
+
+	// @202 '1' (9x20)
+	//   ###   
+	//  ####   
+	// #####   
+	//######   
+	//######   
+	//   ###   
+	//   ###   
+	//   ###   
+	//   ###   
+	//   ###   
+	//   ###   
+	//   ###   
+	//   ###   
+	//   ###   
+	//   ###   
+	//   ###   
+	//   ###   
+	//   ###   
+	//#########
+	//#########
+	0x0E, 0x07, 0x83, 0xE1, 0xF8, 0x87, 0x1F, 0xFE, 0xFF, 0xC0,
+
+	// @212 '2' (13x20)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//          ###
+	//         ### 
+	//        ###  
+	//       ###   
+	//      ###    
+	//     ###     
+	//    ###      
+	//   ###       
+	//  ###        
+	// ###         
+	//###          
+	//#############
+	//#############
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0xE0, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38,
+	0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x03, 0xFF, 0xF0,
+
+	// @241 '3' (13x20)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//          ###
+	//          ###
+	//          ###
+	//         ####
+	//   ######### 
+	//   ######### 
+	//         ####
+	//          ###
+	//          ###
+	//          ###
+	//###       ###
+	//###       ###
+	//####     ####
+	// ########### 
+	//  #########  
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0x80, 0x0F, 0x80, 0x1E, 0x1F, 0xF4, 0x00, 0xF0, 0x01,
+	0xF7, 0x01, 0xEF, 0x07, 0x9F, 0xFC, 0x3F, 0xE0,
+
+	// @265 '4' (13x20)
+	//          ###
+	//         ####
+	//        #####
+	//       ######
+	//      ### ###
+	//     ###  ###
+	//    ###   ###
+	//   ###    ###
+	//  ###     ###
+	// ###      ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//#############
+	//#############
+	//          ###
+	//          ###
+	//          ###
+	//          ###
+	//          ###
+	0x00, 0x1C, 0x00, 0xF0, 0x07, 0xC0, 0x3F, 0x01, 0xDC, 0x0E, 0x70, 0x71, 0xC3, 0x87, 0x1C, 0x1C,
+	0xE0, 0x77, 0x01, 0xF7, 0xFF, 0xE0, 0x03, 0xF8,
+
+	// @289 '5' (13x20)
+	//#############
+	//#############
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###########  
+	//############ 
+	//         ####
+	//          ###
+	//          ###
+	//          ###
+	//          ###
+	//          ###
+	//###       ###
+	//####      ###
+	// ########### 
+	//  #########  
+	0x7F, 0xFE, 0xE0, 0x07, 0xDF, 0xFC, 0x7F, 0xF8, 0x00, 0xF0, 0x01, 0xFD, 0xC0, 0x77, 0x81, 0xCF,
+	0xFE, 0x1F, 0xF0,
+
+	// @308 '6' (13x20)
+	//  ########## 
+	// ########### 
+	//####         
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###########  
+	//############ 
+	//###      ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####     ####
+	// ########### 
+	//  #########  
+	0x1F, 0xF8, 0xFF, 0xE7, 0x80, 0x1C, 0x00, 0xF7, 0xFF, 0x1F, 0xFE, 0x70, 0x3D, 0xC0, 0x7F, 0xBC,
+	0x1E, 0x7F, 0xF0, 0xFF, 0x80,
+
+	// @329 '7' (13x20)
+	//#############
+	//#############
+	//###       ###
+	//###       ###
+	//###       ###
+	//###      ### 
+	//         ### 
+	//        ###  
+	//        ###  
+	//       ###   
+	//       ###   
+	//      ###    
+	//      ###    
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	0x7F, 0xFE, 0xE0, 0x3E, 0xE0, 0x70, 0x01, 0xC0, 0x0E, 0x40, 0x38, 0x80, 0xE1, 0x03, 0x83, 0xF0,
+
+	// @345 '8' (13x20)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####     ####
+	// ########### 
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####     ####
+	// ########### 
+	//  #########  
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0xF7, 0x83, 0xCF, 0xFE, 0xBC, 0x1E, 0xE0, 0x3F, 0xBC,
+	0x1E, 0x7F, 0xF0, 0xFF, 0x80,
+
+	// @366 '9' (13x20)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####      ###
+	// ############
+	//  ###########
+	//          ###
+	//          ###
+	//          ###
+	//          ###
+	//          ###
+	//         ####
+	// ########### 
+	// ##########  
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0xFB, 0xC0, 0xE7, 0xFF, 0x8F, 0xFE, 0x00, 0x3F, 0x80,
+	0x1E, 0x7F, 0xF1, 0xFF, 0x80,
+
+	// @387 ':' (3x14)
+	//###
+	//###
+	//###
+	//###
+	//   
+	//   
+	//   
+	//   
+	//   
+	//   
+	//###
+	//###
+	//###
+	//###
+	0x7E, 0x1F, 0x7E,
+
+	// @390 ';' (5x16)
+	//  ###
+	//  ###
+	//  ###
+	//  ###
+	//     
+	//     
+	//     
+	//     
+	//     
+	//     
+	//  ###
+	//  ###
+	//  ###
+	//  ###
+	// ### 
+	//###  
+	0x1F, 0x81, 0xF1, 0xF9, 0xCE, 0x00,
+
+	// @396 '<' (12x20)
+	//         ###
+	//        ### 
+	//       ###  
+	//      ###   
+	//     ###    
+	//    ###     
+	//   ###      
+	//  ###       
+	// ###        
+	//###         
+	//###         
+	// ###        
+	//  ###       
+	//   ###      
+	//    ###     
+	//     ###    
+	//      ###   
+	//       ###  
+	//        ### 
+	//         ###
+	0x00, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80,
+	0x27, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07,
+
+	// @427 '=' (13x8)
+	//#############
+	//#############
+	//             
+	//             
+	//             
+	//             
+	//#############
+	//#############
+	0x7F, 0xFE, 0x00, 0x07, 0x7F, 0xFE,
+
+	// @433 '>' (12x20)
+	//###         
+	// ###        
+	//  ###       
+	//   ###      
+	//    ###     
+	//     ###    
+	//      ###   
+	//       ###  
+	//        ### 
+	//         ###
+	//         ###
+	//        ### 
+	//       ###  
+	//      ###   
+	//     ###    
+	//    ###     
+	//   ###      
+	//  ###       
+	// ###        
+	//###         
+	0x70, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01,
+	0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00,
+
+	// @464 '?' (13x20)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//         ### 
+	//        ###  
+	//       ###   
+	//      ###    
+	//     ###     
+	//     ###     
+	//     ###     
+	//             
+	//             
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70,
+	0x60, 0x00, 0x40, 0xE0, 0xE0,
+
+	// @485 '@' (14x20)
+	//  ##########  
+	// ############ 
+	//####       ###
+	//###         ##
+	//###   ########
+	//###  #########
+	//### ####   ###
+	//### ###    ###
+	//### ###    ###
+	//### ###    ###
+	//### ###    ###
+	//### ###    ###
+	//### ###    ###
+	//### ####  ####
+	//###  #########
+	//###   ##### ##
+	//###           
+	//####          
+	// #############
+	//  ############
+	0x1F, 0xF8, 0x7F, 0xF9, 0xE0, 0x3B, 0x80, 0x37, 0x1F, 0xEE, 0x7F, 0xDD, 0xE3, 0xBB, 0x87, 0xFB,
+	0xBC, 0xF7, 0x3F, 0xEE, 0x3E, 0xDC, 0x00, 0x3C, 0x00, 0x3F, 0xFE, 0x3F, 0xFC,
+
+	// @514 'A' (13x20)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//#############
+	//#############
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0xFD, 0xFF, 0xFB, 0x80, 0xFF, 0xC0,
+
+	// @527 'B' (13x20)
+	//###########  
+	//############ 
+	//###      ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###      ### 
+	//###########  
+	//###########  
+	//###      ### 
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###      ####
+	//############ 
+	//###########  
+	0x7F, 0xF1, 0xFF, 0xE7, 0x03, 0xDC, 0x07, 0xEE, 0x07, 0x3F, 0xF9, 0x70, 0x39, 0xC0, 0x7F, 0xB8,
+	0x1E, 0xFF, 0xF3, 0xFF, 0x80,
+
+	// @548 'C' (13x20)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###       ###
+	//###       ###
+	//####     ####
+	// ########### 
+	//  #########  
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0xB8, 0x01, 0xFF, 0x70, 0x1E, 0xF0, 0x79, 0xFF, 0xC3,
+	0xFE, 0x00,
+
+	// @566 'D' (13x20)
+	//#########    
+	//###########  
+	//###     #### 
+	//###      ### 
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###      ### 
+	//###     #### 
+	//###########  
+	//#########    
+	0x7F, 0xC1, 0xFF, 0xC7, 0x07, 0x9C, 0x0E, 0x70, 0x1F, 0xFF, 0xB8, 0x1C, 0xE0, 0xF3, 0xFF, 0x8F,
+	0xF8, 0x00,
+
+	// @584 'E' (13x20)
+	//#############
+	//#############
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//##########   
+	//##########   
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//#############
+	//#############
+	0x7F, 0xFE, 0xE0, 0x07, 0xEF, 0xFC, 0x5C, 0x00, 0xFD, 0xFF, 0xF8,
+
+	// @595 'F' (13x20)
+	//#############
+	//#############
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//##########   
+	//##########   
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	0x7F, 0xFE, 0xE0, 0x07, 0xEF, 0xFC, 0x5C, 0x00, 0xFF,
+
+	// @604 'G' (13x20)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###          
+	//###          
+	//###          
+	//###          
+	//###   #######
+	//###   #######
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####     ####
+	// ########### 
+	//  #########  
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0xB8, 0x01, 0xDC, 0x7F, 0xB8, 0x0F, 0xF7, 0x83, 0xCF,
+	0xFE, 0x1F, 0xF0,
+
+	// @623 'H' (13x20)
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//#############
+	//#############
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	0x70, 0x1F, 0xFD, 0xFF, 0xFB, 0x80, 0xFF, 0xE0,
+
+	// @631 'I' (7x20)
+	//#######
+	//#######
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//#######
+	//#######
+	0x7F, 0x8E, 0x7F, 0xFF, 0x7F, 0x80,
+
+	// @637 'J' (14x20)
+	//       #######
+	//       #######
+	//         ###  
+	//         ###  
+	//         ###  
+	//         ###  
+	//         ###  
+	//         ###  
+	//         ###  
+	//         ###  
+	//         ###  
+	//         ###  
+	//         ###  
+	//         ###  
+	//###      ###  
+	//###      ###  
+	//###      ###  
+	//####    ####  
+	// ##########   
+	//  ########    
+	0x00, 0xFF, 0x00, 0x39, 0xFF, 0xDC, 0x0E, 0x6F, 0x0F, 0x0F, 0xFC, 0x0F, 0xF0,
+
+	// @650 'K' (13x20)
+	//###        ##
+	//###       ###
+	//###      ### 
+	//###     ###  
+	//###    ###   
+	//###   ###    
+	//###  ###     
+	//### ###      
+	//######       
+	//#####        
+	//#####        
+	//######       
+	//### ###      
+	//###  ###     
+	//###   ###    
+	//###    ###   
+	//###     ###  
+	//###      ### 
+	//###       ###
+	//###        ##
+	0x70, 0x0D, 0xC0, 0x77, 0x03, 0x9C, 0x1C, 0x70, 0xE1, 0xC7, 0x07, 0x38, 0x1D, 0xC0, 0x7E, 0x01,
+	0xF0, 0x0B, 0xF0, 0x0E, 0xE0, 0x39, 0xC0, 0xE3, 0x83, 0x87, 0x0E, 0x0E, 0x38, 0x1C, 0xE0, 0x3B,
+	0x80, 0x60,
+
+	// @684 'L' (13x20)
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//#############
+	//#############
+	0x70, 0x03, 0xFF, 0xFE, 0xFF, 0xFC,
+
+	// @690 'M' (14x20)
+	//###        ###
+	//###        ###
+	//####      ####
+	//#####    #####
+	//######  ######
+	//######  ######
+	//### ###### ###
+	//###  ####  ###
+	//###  ####  ###
+	//###   ##   ###
+	//###        ###
+	//###        ###
+	//###        ###
+	//###        ###
+	//###        ###
+	//###        ###
+	//###        ###
+	//###        ###
+	//###        ###
+	//###        ###
+	0x70, 0x0F, 0x78, 0x1E, 0xF8, 0x7D, 0xF9, 0xFD, 0xDF, 0xBB, 0x9E, 0x7B, 0x8C, 0x77, 0x00, 0xFF,
+	0xF0,
+
+	// @707 'N' (13x20)
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####      ###
+	//#####     ###
+	//######    ###
+	//### ###   ###
+	//###  ###  ###
+	//###   ### ###
+	//###    ######
+	//###     #####
+	//###      ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	0x70, 0x1F, 0xDE, 0x07, 0x7C, 0x1D, 0xF8, 0x77, 0x71, 0xDC, 0xE7, 0x71, 0xDD, 0xC3, 0xF7, 0x07,
+	0xDC, 0x0F, 0x70, 0x1F, 0xE0,
+
+	// @728 'O' (13x20)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####     ####
+	// ########### 
+	//  #########  
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0xFF, 0xFB, 0xC1, 0xE7, 0xFF, 0x0F, 0xF8,
+
+	// @742 'P' (13x20)
+	//###########  
+	//############ 
+	//###      ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###      ####
+	//############ 
+	//###########  
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	0x7F, 0xF1, 0xFF, 0xE7, 0x03, 0xDC, 0x07, 0xFB, 0x81, 0xEF, 0xFF, 0x3F, 0xF8, 0xE0, 0x07, 0xF0,
+
+	// @758 'Q' (13x22)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###  ###  ###
+	//####  #######
+	// ########### 
+	//  #########  
+	//         ### 
+	//          ###
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0xFF, 0xF7, 0x39, 0xDE, 0x7F, 0x3F, 0xF8, 0x7F, 0xC0,
+	0x03, 0x80, 0x07,
+
+	// @777 'R' (13x20)
+	//###########  
+	//############ 
+	//###      ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###      ####
+	//############ 
+	//###########  
+	//######       
+	//### ###      
+	//###  ###     
+	//###   ###    
+	//###    ###   
+	//###     ###  
+	//###      ### 
+	//###       ###
+	0x7F, 0xF1, 0xFF, 0xE7, 0x03, 0xDC, 0x07, 0xFB, 0x81, 0xEF, 0xFF, 0x3F, 0xF8, 0xFC, 0x03, 0xB8,
+	0x0E, 0x70, 0x38, 0xE0, 0xE1, 0xC3, 0x83, 0x8E, 0x07, 0x38, 0x0E,
+
+	// @804 'S' (13x20)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###          
+	//###          
+	//###          
+	//####         
+	// ##########  
+	//  ########## 
+	//         ####
+	//          ###
+	//          ###
+	//          ###
+	//###       ###
+	//###       ###
+	//####     ####
+	// ########### 
+	//  #########  
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0xB8, 0x01, 0xBC, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x07,
+	0x80, 0x0F, 0xB8, 0x0F, 0x78, 0x3C, 0xFF, 0xE1, 0xFF, 0x00,
+
+	// @830 'T' (13x20)
+	//#############
+	//#############
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	0x7F, 0xFE, 0x07, 0x07, 0xFF, 0xFC,
+
+	// @836 'U' (13x20)
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####     ####
+	// ########### 
+	//  #########  
+	0x70, 0x1F, 0xFF, 0xFD, 0xE0, 0xF3, 0xFF, 0x87, 0xFC,
+
+	// @845 'V' (13x20)
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	// ###     ### 
+	// ###     ### 
+	// ###     ### 
+	// ###     ### 
+	// ###     ### 
+	//  ###   ###  
+	//  ###   ###  
+	//  ###   ###  
+	//  ###   ###  
+	//   ### ###   
+	//   ### ###   
+	//   ### ###   
+	//    #####    
+	//    #####    
+	//    #####    
+	0x70, 0x1F, 0xCE, 0x0E, 0xF1, 0xC7, 0x38, 0x77, 0x18, 0x3E, 0x18,
+
+	// @856 'W' (14x20)
+	//###        ###
+	//###        ###
+	//###        ###
+	//###        ###
+	//###        ###
+	//###        ###
+	//###        ###
+	//###        ###
+	//###        ###
+	//###        ###
+	//###   ##   ###
+	//###  ####  ###
+	//###  ####  ###
+	//### ###### ###
+	//######  ######
+	//######  ######
+	//#####    #####
+	//####      ####
+	//###        ###
+	//###        ###
+	0x70, 0x0F, 0xFF, 0x71, 0x8E, 0xE7, 0x9E, 0xEF, 0xDD, 0xF9, 0xFD, 0xF0, 0xFB, 0xC0, 0xF7, 0x00,
+	0xF0,
+
+	// @873 'X' (13x20)
+	//###       ###
+	//###       ###
+	// ###     ### 
+	// ###     ### 
+	//  ###   ###  
+	//  ###   ###  
+	//   ### ###   
+	//   ### ###   
+	//    #####    
+	//    #####    
+	//    #####    
+	//    #####    
+	//   ### ###   
+	//   ### ###   
+	//  ###   ###  
+	//  ###   ###  
+	// ###     ### 
+	// ###     ### 
+	//###       ###
+	//###       ###
+	0x70, 0x1E, 0x70, 0x74, 0x71, 0xC8, 0x77, 0x10, 0x7C, 0x38, 0x77, 0x11, 0xC7, 0x27, 0x07, 0x5C,
+	0x07, 0x80,
+
+	// @891 'Y' (13x20)
+	//###       ###
+	//###       ###
+	//###       ###
+	// ###     ### 
+	// ###     ### 
+	//  ###   ###  
+	//  ###   ###  
+	//   ### ###   
+	//   ### ###   
+	//    #####    
+	//    #####    
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	//     ###     
+	0x70, 0x1F, 0x38, 0x3A, 0x38, 0xE4, 0x3B, 0x88, 0x3E, 0x10, 0x38, 0x3F, 0xC0,
+
+	// @904 'Z' (13x20)
+	//#############
+	//#############
+	//          ###
+	//          ###
+	//          ###
+	//         ### 
+	//        ###  
+	//       ###   
+	//      ###    
+	//     ###     
+	//    ###      
+	//   ###       
+	//  ###        
+	// ###         
+	//###          
+	//###          
+	//###          
+	//###          
+	//#############
+	//#############
+	0x7F, 0xFE, 0x00, 0x3E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0,
+	0x0E, 0x00, 0x70, 0x03, 0x80, 0x1D, 0xFF, 0xF8,
+
+	// @928 '[' (8x20)
+	//########
+	//########
+	//###     
+	//###     
+	//###     
+	//###     
+	//###     
+	//###     
+	//###     
+	//###     
+	//###     
+	//###     
+	//###     
+	//###     
+	//###     
+	//###     
+	//###     
+	//###     
+	//########
+	//########
+	0x7F, 0xDC, 0x1F, 0xFF, 0xDF, 0xF0,
+
+	// @934 '\' (12x20)
+	//###         
+	//###         
+	// ###        
+	// ###        
+	//  ###       
+	//  ###       
+	//   ###      
+	//   ###      
+	//    ###     
+	//    ###     
+	//     ###    
+	//     ###    
+	//      ###   
+	//      ###   
+	//       ###  
+	//       ###  
+	//        ### 
+	//        ### 
+	//         ###
+	//         ###
+	0x70, 0x04, 0xE0, 0x11, 0xC0, 0x43, 0x81, 0x07, 0x04, 0x0E, 0x10, 0x1C, 0x40, 0x39, 0x00, 0x74,
+	0x00, 0xF0,
+
+	// @952 ']' (8x20)
+	//########
+	//########
+	//     ###
+	//     ###
+	//     ###
+	//     ###
+	//     ###
+	//     ###
+	//     ###
+	//     ###
+	//     ###
+	//     ###
+	//     ###
+	//     ###
+	//     ###
+	//     ###
+	//     ###
+	//     ###
+	//########
+	//########
+	0x7F, 0xC0, 0xFF, 0xFF, 0xDF, 0xF0,
+
+	// @958 '^' (13x6)
+	//     ###     
+	//    #####    
+	//   ### ###   
+	//  ###   ###  
+	// ###     ### 
+	//###       ###
+	0x03, 0x80, 0x1F, 0x00, 0xEE, 0x07, 0x1C, 0x38, 0x39, 0xC0, 0x70,
+
+	// @969 '_' (13x2)
+	//#############
+	//#############
+	0x7F, 0xFE,
+
+	// @971 '`' (6x4)
+	//###   
+	// ###  
+	//  ### 
+	//   ###
+	0x70, 0x70, 0x70, 0x70,
+
+	// @975 'a' (13x14)
+	// ##########  
+	// ########### 
+	//         ####
+	//          ###
+	//          ###
+	//  ###########
+	// ############
+	//####      ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####      ###
+	// ############
+	//  ###########
+	0x3F, 0xF0, 0xFF, 0xE0, 0x03, 0xC0, 0x07, 0x8F, 0xFE, 0x7F, 0xFB, 0xC0, 0xEE, 0x03, 0xEF, 0x03,
+	0x9F, 0xFE, 0x3F, 0xF8,
+
+	// @995 'b' (13x20)
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###########  
+	//############ 
+	//###      ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###      ####
+	//############ 
+	//###########  
+	0x70, 0x03, 0xEF, 0xFE, 0x3F, 0xFC, 0xE0, 0x7B, 0x80, 0xFF, 0xDC, 0x0F, 0x7F, 0xF9, 0xFF, 0xC0,
+
+	// @1011 'c' (13x14)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###       ###
+	//####     ####
+	// ########### 
+	//  #########  
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0x70, 0x03, 0xEE, 0x03, 0xBC, 0x1E, 0x7F, 0xF0, 0xFF,
+	0x80,
+
+	// @1028 'd' (13x20)
+	//          ###
+	//          ###
+	//          ###
+	//          ###
+	//          ###
+	//          ###
+	//  ###########
+	// ############
+	//####      ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####      ###
+	// ############
+	//  ###########
+	0x00, 0x1F, 0xE3, 0xFF, 0x9F, 0xFE, 0xF0, 0x3B, 0x80, 0xFF, 0xDE, 0x07, 0x3F, 0xFC, 0x7F, 0xF0,
+
+	// @1044 'e' (13x14)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//#############
+	//#############
+	//###          
+	//###          
+	//###          
+	//####      ###
+	// ############
+	//  ########## 
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0xDF, 0xFF, 0xB8, 0x01, 0xBC, 0x0E, 0x7F, 0xF8, 0xFF,
+	0xC0,
+
+	// @1061 'f' (13x20)
+	//      #######
+	//     ########
+	//    ####     
+	//    ###      
+	//    ###      
+	//    ###      
+	//###########  
+	//###########  
+	//    ###      
+	//    ###      
+	//    ###      
+	//    ###      
+	//    ###      
+	//    ###      
+	//    ###      
+	//    ###      
+	//    ###      
+	//    ###      
+	//    ###      
+	//    ###      
+	0x01, 0xFC, 0x0F, 0xF0, 0x78, 0x01, 0xC0, 0xDF, 0xFC, 0x83, 0x81, 0xFF, 0xC0,
+
+	// @1074 'g' (13x19)
+	//  ###########
+	// ############
+	//####      ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####      ###
+	// ############
+	//  ###########
+	//          ###
+	//          ###
+	//          ###
+	// ########### 
+	// ##########  
+	0x1F, 0xFC, 0xFF, 0xF7, 0x81, 0xDC, 0x07, 0xFE, 0xF0, 0x39, 0xFF, 0xE3, 0xFF, 0x80, 0x0F, 0x9F,
+	0xFC, 0x7F, 0xE0,
+
+	// @1093 'h' (13x20)
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###########  
+	//############ 
+	//###      ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	0x70, 0x03, 0xEF, 0xFE, 0x3F, 0xFC, 0xE0, 0x7B, 0x80, 0xFF, 0xF8,
+
+	// @1104 'i' (7x20)
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//       
+	//       
+	//#####  
+	//#####  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//#######
+	//#######
+	0x1C, 0xE0, 0x17, 0xC8, 0xE7, 0xFD, 0xFE,
+
+	// @1111 'j' (11x25)
+	//        ###
+	//        ###
+	//        ###
+	//        ###
+	//           
+	//           
+	//      #####
+	//      #####
+	//        ###
+	//        ###
+	//        ###
+	//        ###
+	//        ###
+	//        ###
+	//        ###
+	//        ###
+	//        ###
+	//        ###
+	//        ###
+	//        ###
+	//###     ###
+	//###     ###
+	//####   ####
+	// ######### 
+	//  #######  
+	0x00, 0x7E, 0x00, 0x10, 0x1F, 0x80, 0x3F, 0xFF, 0x70, 0x7B, 0xC7, 0x9F, 0xF0, 0xFE, 0x00,
+
+	// @1126 'k' (12x20)
+	//###         
+	//###         
+	//###         
+	//###         
+	//###         
+	//###         
+	//###      ###
+	//###     ### 
+	//###    ###  
+	//###   ###   
+	//###  ###    
+	//### ###     
+	//######      
+	//######      
+	//### ###     
+	//###  ###    
+	//###   ###   
+	//###    ###  
+	//###     ### 
+	//###      ###
+	0x70, 0x07, 0xDC, 0x0E, 0xE0, 0xE7, 0x0E, 0x38, 0xE1, 0xCE, 0x0E, 0xE0, 0x7E, 0x05, 0xDC, 0x0E,
+	0x70, 0x71, 0xC3, 0x87, 0x1C, 0x1C, 0xE0, 0x70,
+
+	// @1150 'l' (7x20)
+	//#####  
+	//#####  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//  ###  
+	//#######
+	//#######
+	0x7C, 0x8E, 0x7F, 0xFF, 0x7F, 0x80,
+
+	// @1156 'm' (13x14)
+	//###########  
+	//############ 
+	//###  ### ####
+	//###  ###  ###
+	//###  ###  ###
+	//###  ###  ###
+	//###  ###  ###
+	//###  ###  ###
+	//###  ###  ###
+	//###  ###  ###
+	//###  ###  ###
+	//###  ###  ###
+	//###  ###  ###
+	//###  ###  ###
+	0x7F, 0xF1, 0xFF, 0xE7, 0x3B, 0xDC, 0xE7, 0xFF, 0xC0,
+
+	// @1165 'n' (13x14)
+	//###########  
+	//############ 
+	//###      ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	0x7F, 0xF1, 0xFF, 0xE7, 0x03, 0xDC, 0x07, 0xFF, 0xC0,
+
+	// @1174 'o' (13x14)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####     ####
+	// ########### 
+	//  #########  
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x07, 0xFE, 0xF0, 0x79, 0xFF, 0xC3, 0xFE, 0x00,
+
+	// @1188 'p' (13x19)
+	//###########  
+	//############ 
+	//###      ####
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###      ####
+	//############ 
+	//###########  
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	0x7F, 0xF1, 0xFF, 0xE7, 0x03, 0xDC, 0x07, 0xFE, 0xE0, 0x7B, 0xFF, 0xCF, 0xFE, 0x38, 0x01, 0xE0,
+
+	// @1204 'q' (13x19)
+	//  ###########
+	// ############
+	//####      ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####      ###
+	// ############
+	//  ###########
+	//          ###
+	//          ###
+	//          ###
+	//          ###
+	//          ###
+	0x1F, 0xFC, 0xFF, 0xF7, 0x81, 0xDC, 0x07, 0xFE, 0xF0, 0x39, 0xFF, 0xE3, 0xFF, 0x80, 0x0F, 0xE0,
+
+	// @1220 'r' (13x14)
+	//###  ########
+	//### #########
+	//######       
+	//#####        
+	//####         
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	//###          
+	0x73, 0xFD, 0xDF, 0xF7, 0xE0, 0x1F, 0x00, 0x78, 0x01, 0xC0, 0x0F, 0xF0,
+
+	// @1232 's' (13x14)
+	//  #########  
+	// ########### 
+	//####     ####
+	//###          
+	//###          
+	//####         
+	// ##########  
+	//  ########## 
+	//         ####
+	//          ###
+	//          ###
+	//####     ####
+	// ########### 
+	//  #########  
+	0x1F, 0xF0, 0xFF, 0xE7, 0x83, 0xDC, 0x00, 0xBC, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x07, 0x80, 0x0F,
+	0x78, 0x3C, 0xFF, 0xE1, 0xFF, 0x00,
+
+	// @1254 't' (13x20)
+	//    ###      
+	//    ###      
+	//    ###      
+	//    ###      
+	//    ###      
+	//    ###      
+	//###########  
+	//###########  
+	//    ###      
+	//    ###      
+	//    ###      
+	//    ###      
+	//    ###      
+	//    ###      
+	//    ###      
+	//    ###      
+	//    ###      
+	//    ####     
+	//     ########
+	//      #######
+	0x07, 0x03, 0xEF, 0xFE, 0x41, 0xC0, 0xFF, 0x07, 0x80, 0x0F, 0xF0, 0x1F, 0xC0,
+
+	// @1267 'u' (13x14)
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####      ###
+	// ############
+	//  ###########
+	0x70, 0x1F, 0xFF, 0x78, 0x1C, 0xFF, 0xF1, 0xFF, 0xC0,
+
+	// @1276 'v' (13x14)
+	//###       ###
+	//###       ###
+	//###       ###
+	// ###     ### 
+	// ###     ### 
+	// ###     ### 
+	//  ###   ###  
+	//  ###   ###  
+	//  ###   ###  
+	//   ### ###   
+	//   ### ###   
+	//    #####    
+	//    #####    
+	//    #####    
+	0x70, 0x1F, 0x38, 0x3B, 0x1C, 0x73, 0x0E, 0xE2, 0x0F, 0x86,
+
+	// @1286 'w' (13x14)
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###  ###  ###
+	//###  ###  ###
+	//###  ###  ###
+	//###  ###  ###
+	//###  ###  ###
+	//###  ###  ###
+	//###  ###  ###
+	//#### ### ####
+	// ########### 
+	//  #########  
+	0x70, 0x1F, 0xB9, 0xCF, 0xFB, 0xDD, 0xE7, 0xFF, 0x0F, 0xF8,
+
+	// @1296 'x' (13x14)
+	//###       ###
+	//###       ###
+	//###       ###
+	// ###     ### 
+	//  ###   ###  
+	//   ### ###   
+	//    #####    
+	//    #####    
+	//   ### ###   
+	//  ###   ###  
+	// ###     ### 
+	//###       ###
+	//###       ###
+	//###       ###
+	0x70, 0x1F, 0x38, 0x38, 0x71, 0xC0, 0xEE, 0x01, 0xF0, 0x87, 0x70, 0x38, 0xE1, 0xC1, 0xCE, 0x03,
+	0xE0,
+
+	// @1313 'y' (13x19)
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//###       ###
+	//####      ###
+	// ############
+	//  ###########
+	//          ###
+	//          ###
+	//         ####
+	// ########### 
+	// ##########  
+	0x70, 0x1F, 0xFF, 0x78, 0x1C, 0xFF, 0xF1, 0xFF, 0xC0, 0x07, 0x80, 0x1E, 0x7F, 0xF1, 0xFF, 0x80,
+
+	// @1329 'z' (13x14)
+	//#############
+	//#############
+	//         ### 
+	//        ###  
+	//       ###   
+	//      ###    
+	//     ###     
+	//    ###      
+	//   ###       
+	//  ###        
+	// ###         
+	//###          
+	//#############
+	//#############
+	0x7F, 0xFE, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00,
+	0x70, 0x03, 0x80, 0x0F, 0xFF, 0xC0,
+
+	// @1351 '{' (10x20)
+	//     #####
+	//    ######
+	//   ####   
+	//   ###    
+	//   ###    
+	//   ###    
+	//   ###    
+	//   ###    
+	//   ###    
+	//#####     
+	//#####     
+	//   ###    
+	//   ###    
+	//   ###    
+	//   ###    
+	//   ###    
+	//   ###    
+	//   ####   
+	//    ######
+	//     #####
+	0x03, 0xE0, 0xFC, 0x3C, 0x07, 0x0F, 0xBE, 0x08, 0x70, 0xF8, 0x78, 0x07, 0xE0, 0x7C,
+
+	// @1365 '|' (3x20)
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	//###
+	0x7F, 0xFF, 0xFE,
+
+	// @1368 '}' (10x20)
+	//#####     
+	//######    
+	//   ####   
+	//    ###   
+	//    ###   
+	//    ###   
+	//    ###   
+	//    ###   
+	//    ###   
+	//     #####
+	//     #####
+	//    ###   
+	//    ###   
+	//    ###   
+	//    ###   
+	//    ###   
+	//    ###   
+	//   ####   
+	//######    
+	//#####     
+	0x7C, 0x0F, 0xC0, 0x3C, 0x03, 0x8F, 0x81, 0xF8, 0x38, 0xF8, 0x78, 0x7E, 0x0F, 0x80,
+
+	// @1382 '~' (13x6)
+	//  ####    ###
+	// ######   ###
+	//### ####  ###
+	//###  #### ###
+	//###   ###### 
+	//###    ####  
+	0x1E, 0x1C, 0xFC, 0x77, 0x79, 0xDC, 0xF7, 0x71, 0xF9, 0xC3, 0xC0,
+
+	// @1393 degree sign (11x10)
+	//   #####   
+	//  #######  
+	// ###   ### 
+	// ##     ## 
+	//###     ###
+	//###     ###
+	// ##     ## 
+	// ###   ### 
+	//  #######  
+	//   #####   
+	0x0F, 0x81, 0xFC, 0x38, 0xE3, 0x06, 0x70, 0x79, 0x83, 0x1C, 0x70, 0xFE, 0x07, 0xC0,
+};
+
+const sGLYPH Font32P_Glyphs[] =
+{
+	//Offset, Width, Height, Left, Top, Advance
+	{0, 0, 0, 0, 0, 8}, // ' '
+	{0, 3, 20, 2, 7, 6}, // '!'
+	{4, 9, 6, 2, 5, 12}, // '"'
+	{6, 13, 20, 2, 7, 16}, // '#'
+	{17, 13, 24, 2, 5, 16}, // '$'
+	{46, 12, 20, 2, 7, 15}, // '%'
+	{70, 14, 20, 2, 7, 17}, // '&'
+	{96, 3, 6, 2, 5, 6}, // '''
+	{98, 7, 20, 2, 7, 10}, // '('
+	{109, 7, 20, 2, 7, 10}, // ')'
+	{120, 13, 12, 2, 11, 16}, // '*'
+	{140, 13, 12, 2, 11, 16}, // '+'
+	{147, 5, 6, 2, 23, 8}, // ','
+	{150, 13, 2, 2, 16, 16}, // '-'
+	{152, 3, 4, 2, 23, 6}, // '.'
+	{153, 12, 20, 2, 7, 15}, // '/'
+	{171, 13, 20, 2, 7, 16}, // '0'
+	{202, 9, 20, 2, 7, 12}, // '1'
+	{212, 13, 20, 2, 7, 16}, // '2'
+	{241, 13, 20, 2, 7, 16}, // '3'
+	{265, 13, 20, 2, 7, 16}, // '4'
+	{289, 13, 20, 2, 7, 16}, // '5'
+	{308, 13, 20, 2, 7, 16}, // '6'
+	{329, 13, 20, 2, 7, 16}, // '7'
+	{345, 13, 20, 2, 7, 16}, // '8'
+	{366, 13, 20, 2, 7, 16}, // '9'
+	{387, 3, 14, 2, 13, 6}, // ':'
+	{390, 5, 16, 2, 13, 8}, // ';'
+	{396, 12, 20, 2, 7, 15}, // '<'
+	{427, 13, 8, 2, 13, 16}, // '='
+	{433, 12, 20, 2, 7, 15}, // '>'
+	{464, 13, 20, 2, 7, 16}, // '?'
+	{485, 14, 20, 2, 7, 17}, // '@'
+	{514, 13, 20, 2, 7, 16}, // 'A'
+	{527, 13, 20, 2, 7, 16}, // 'B'
+	{548, 13, 20, 2, 7, 16}, // 'C'
+	{566, 13, 20, 2, 7, 16}, // 'D'
+	{584, 13, 20, 2, 7, 16}, // 'E'
+	{595, 13, 20, 2, 7, 16}, // 'F'
+	{604, 13, 20, 2, 7, 16}, // 'G'
+	{623, 13, 20, 2, 7, 16}, // 'H'
+	{631, 7, 20, 2, 7, 10}, // 'I'
+	{637, 14, 20, 2, 7, 17}, // 'J'
+	{650, 13, 20, 2, 7, 16}, // 'K'
+	{684, 13, 20, 2, 7, 16}, // 'L'
+	{690, 14, 20, 2, 7, 17}, // 'M'
+	{707, 13, 20, 2, 7, 16}, // 'N'
+	{728, 13, 20, 2, 7, 16}, // 'O'
+	{742, 13, 20, 2, 7, 16}, // 'P'
+	{758, 13, 22, 2, 7, 16}, // 'Q'
+	{777, 13, 20, 2, 7, 16}, // 'R'
+	{804, 13, 20, 2, 7, 16}, // 'S'
+	{830, 13, 20, 2, 7, 16}, // 'T'
+	{836, 13, 20, 2, 7, 16}, // 'U'
+	{845, 13, 20, 2, 7, 16}, // 'V'
+	{856, 14, 20, 2, 7, 17}, // 'W'
+	{873, 13, 20, 2, 7, 16}, // 'X'
+	{891, 13, 20, 2, 7, 16}, // 'Y'
+	{904, 13, 20, 2, 7, 16}, // 'Z'
+	{928, 8, 20, 2, 7, 11}, // '['
+	{934, 12, 20, 2, 7, 15}, // '\'
+	{952, 8, 20, 2, 7, 11}, // ']'
+	{958, 13, 6, 2, 5, 16}, // '^'
+	{969, 13, 2, 2, 28, 16}, // '_'
+	{971, 6, 4, 2, 2, 9}, // '`'
+	{975, 13, 14, 2, 13, 16}, // 'a'
+	{995, 13, 20, 2, 7, 16}, // 'b'
+	{1011, 13, 14, 2, 13, 16}, // 'c'
+	{1028, 13, 20, 2, 7, 16}, // 'd'
+	{1044, 13, 14, 2, 13, 16}, // 'e'
+	{1061, 13, 20, 2, 7, 16}, // 'f'
+	{1074, 13, 19, 2, 13, 16}, // 'g'
+	{1093, 13, 20, 2, 7, 16}, // 'h'
+	{1104, 7, 20, 2, 7, 10}, // 'i'
+	{1111, 11, 25, 2, 7, 14}, // 'j'
+	{1126, 12, 20, 2, 7, 15}, // 'k'
+	{1150, 7, 20, 2, 7, 10}, // 'l'
+	{1156, 13, 14, 2, 13, 16}, // 'm'
+	{1165, 13, 14, 2, 13, 16}, // 'n'
+	{1174, 13, 14, 2, 13, 16}, // 'o'
+	{1188, 13, 19, 2, 13, 16}, // 'p'
+	{1204, 13, 19, 2, 13, 16}, // 'q'
+	{1220, 13, 14, 2, 13, 16}, // 'r'
+	{1232, 13, 14, 2, 13, 16}, // 's'
+	{1254, 13, 20, 2, 7, 16}, // 't'
+	{1267, 13, 14, 2, 13, 16}, // 'u'
+	{1276, 13, 14, 2, 13, 16}, // 'v'
+	{1286, 13, 14, 2, 13, 16}, // 'w'
+	{1296, 13, 14, 2, 13, 16}, // 'x'
+	{1313, 13, 19, 2, 13, 16}, // 'y'
+	{1329, 13, 14, 2, 13, 16}, // 'z'
+	{1351, 10, 20, 2, 7, 13}, // '{'
+	{1365, 3, 20, 2, 7, 6}, // '|'
+	{1368, 10, 20, 2, 7, 13}, // '}'
+	{1382, 13, 6, 2, 5, 16}, // '~'
+	{1393, 11, 10, 2, 3, 14}, // degree sign
+	{1393, 11, 10, 2, 3, 14}, // U+00B0
+};
+
+const sRANGE Font32P_Ranges[] =
+{
+	//First, Count, Index
+	{0x00B0, 1, 96}, // U+00B0
+};
+
+sFONT Font32P = {
+  Font32P_Table,
+  17, /* Width */
+  32, /* Height */
+  Font32P_Glyphs,
+  0x20, /* First */
+  0x7F, /* Last */
+  FONT_ENCODING_ROWS,
+  0, /* Map: every code from First to Last */
+  '?', /* Fallback */
+  Font32P_Ranges,
+  1, /* RangeCount */
+  0, /* Kerning: none */
+  0, /* KernCount */
+};
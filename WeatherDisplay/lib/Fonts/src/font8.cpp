@@ -993,12 +993,32 @@ const uint8_t Font8_Table[] =
 	0x00, //      
 	0x00, //      
 	0x00, //      
+
+	// @760 degree sign in place of DEL (5 pixels wide)
+	0x00, //      
+	0x70, // ###  
+	0x50, // # #  
+	0x70, // ###  
+	0x00, //      
+	0x00, //      
+	0x00, //      
+	0x00, //      
 };
 
 sFONT Font8 = {
   Font8_Table,
   5, /* Width */
   8, /* Height */
+  0, /* Glyphs: cells of Width from ' ' */
+  0, /* First */
+  0, /* Last */
+  FONT_ENCODING_BITS,
+  0, /* Map */
+  0, /* Fallback */
+  0, /* Ranges */
+  0, /* RangeCount */
+  0, /* Kerning: none */
+  0, /* KernCount */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,929 @@
+/**
+  ******************************************************************************
+  * @file    font8p.cpp
+  * @brief   Proportional version of Font8: every glyph is cut to its ink
+  *          and packed without row padding, see sGLYPH in fonts.h.
+  *          Generated by tools/fontgen, do not edit:
+  *          fontgen -n Font8P -o font8p.cpp font8.cpp
+  ******************************************************************************
+  */
+
+#include "fonts.h"
+
+const uint8_t Font8P_Table[] =
+{
+	// @0 '!' (1x6)
+	//#
+	//#
+	//#
+	//#
+	// 
+	//#
+	0xF4,
+
+	// @1 '"' (3x2)
+	//# #
+	//# #
+	0xB4,
+
+	// @2 '#' (5x7)
+	//  # #
+	// # # 
+	//#####
+	// # # 
+	//#####
+	// # # 
+	//# #  
+	0x2A, 0xBE, 0xAF, 0xAA, 0x80,
+
+	// @7 '$' (3x7)
+	// # 
+	// ##
+	//## 
+	// ##
+	//  #
+	//## 
+	// # 
+	0x4F, 0x33, 0x90,
+
+	// @10 '%' (4x6)
+	// #  
+	// #  
+	//  ##
+	//##  
+	//  # 
+	//  # 
+	0x44, 0x3C, 0x22,
+
+	// @13 '&' (4x5)
+	// ###
+	// #  
+	//##  
+	//# # 
+	//####
+	0x74, 0xCA, 0xF0,
+
+	// @16 ''' (1x3)
+	//#
+	//#
+	//#
+	0xE0,
+
+	// @17 '(' (2x7)
+	// #
+	//# 
+	//# 
+	//# 
+	//# 
+	//# 
+	// #
+	0x6A, 0xA4,
+
+	// @19 ')' (2x7)
+	//# 
+	// #
+	// #
+	// #
+	// #
+	// #
+	//# 
+	0x95, 0x58,
+
+	// @21 '*' (3x4)
+	// # 
+	//###
+	// # 
+	//# #
+	0x5D, 0x50,
+
+	// @23 '+' (5x5)
+	//  #  
+	//  #  
+	//#####
+	//  #  
+	//  #  
+	0x21, 0x3E, 0x42, 0x00,
+
+	// @27 ',' (2x3)
+	// #
+	//# 
+	//# 
+	0x68,
+
+	// @28 '-' (3x1)
+	//###
+	0xE0,
+
+	// @29 '.' (1x1)
+	//#
+	0x80,
+
+	// @30 '/' (4x7)
+	//   #
+	//  # 
+	//  # 
+	//  # 
+	// #  
+	// #  
+	//#   
+	0x12, 0x22, 0x44, 0x80,
+
+	// @34 '0' (3x6)
+	// # 
+	//# #
+	//# #
+	//# #
+	//# #
+	// # 
+	0x56, 0xDA, 0x80,
+
+	// @37 '1' (5x6)
+	// ##  
+	//  #  
+	//  #  
+	//  #  
+	//  #  
+	//#####
+	0x61, 0x08, 0x42, 0x7C,
+
+	// @41 '2' (3x6)
+	// # 
+	//# #
+	// # 
+	// # 
+	//#  
+	//###
+	0x55, 0x29, 0xC0,
+
+	// @44 '3' (3x6)
+	// # 
+	//# #
+	//  #
+	// # 
+	//  #
+	//## 
+	0x54, 0xA3, 0x80,
+
+	// @47 '4' (4x6)
+	//  # 
+	// ## 
+	//# # 
+	//####
+	//  # 
+	// ###
+	0x26, 0xAF, 0x27,
+
+	// @50 '5' (3x6)
+	//###
+	//#  
+	//## 
+	//  #
+	//# #
+	// # 
+	0xF3, 0x1A, 0x80,
+
+	// @53 '6' (3x6)
+	// ##
+	//#  
+	//## 
+	//# #
+	//# #
+	//## 
+	0x73, 0x5B, 0x80,
+
+	// @56 '7' (3x6)
+	//###
+	//# #
+	//  #
+	// # 
+	// # 
+	// # 
+	0xF4, 0xA4, 0x80,
+
+	// @59 '8' (3x6)
+	// # 
+	//# #
+	// # 
+	//# #
+	//# #
+	// # 
+	0x55, 0x5A, 0x80,
+
+	// @62 '9' (3x6)
+	// ##
+	//# #
+	//# #
+	// ##
+	//  #
+	//## 
+	0x76, 0xB3, 0x80,
+
+	// @65 ':' (1x4)
+	//#
+	// 
+	// 
+	//#
+	0x90,
+
+	// @66 ';' (2x4)
+	// #
+	//  
+	// #
+	//# 
+	0x46,
+
+	// @67 '<' (4x5)
+	//   #
+	//  # 
+	//##  
+	//  # 
+	//   #
+	0x12, 0xC2, 0x10,
+
+	// @70 '=' (3x3)
+	//###
+	//   
+	//###
+	0xE3, 0x80,
+
+	// @72 '>' (4x5)
+	//#   
+	// #  
+	//  ##
+	// #  
+	//#   
+	0x84, 0x34, 0x80,
+
+	// @75 '?' (3x6)
+	// # 
+	//# #
+	//  #
+	// # 
+	//   
+	// # 
+	0x54, 0xA0, 0x80,
+
+	// @78 '@' (4x7)
+	// ## 
+	//#  #
+	//#  #
+	//# ##
+	//#  #
+	//#   
+	// ###
+	0x69, 0x9B, 0x98, 0x70,
+
+	// @82 'A' (5x6)
+	// ##  
+	//  #  
+	// # # 
+	// ### 
+	//#   #
+	//## ##
+	0x61, 0x14, 0xE8, 0xEC,
+
+	// @86 'B' (5x6)
+	//#### 
+	// #  #
+	// ### 
+	// #  #
+	// #  #
+	//#### 
+	0xF2, 0x5C, 0x94, 0xF8,
+
+	// @90 'C' (3x6)
+	//###
+	//# #
+	//#  
+	//#  
+	//#  
+	// ##
+	0xF6, 0x48, 0xC0,
+
+	// @93 'D' (5x6)
+	//#### 
+	// #  #
+	// #  #
+	// #  #
+	// #  #
+	//#### 
+	0xF2, 0x52, 0x94, 0xF8,
+
+	// @97 'E' (5x6)
+	//#####
+	// #  #
+	// ##  
+	// #   
+	// #  #
+	//#####
+	0xFA, 0x58, 0x84, 0xFC,
+
+	// @101 'F' (5x6)
+	//#####
+	// #  #
+	// ##  
+	// #   
+	// #   
+	//###  
+	0xFA, 0x58, 0x84, 0x70,
+
+	// @105 'G' (4x6)
+	//### 
+	//#   
+	//#   
+	//# ##
+	//# # 
+	// ## 
+	0xE8, 0x8B, 0xA6,
+
+	// @108 'H' (5x6)
+	//### #
+	// #  #
+	// ####
+	// #  #
+	// #  #
+	//### #
+	0xEA, 0x5E, 0x94, 0xF4,
+
+	// @112 'I' (3x6)
+	//###
+	// # 
+	// # 
+	// # 
+	// # 
+	//###
+	0xE9, 0x25, 0xC0,
+
+	// @115 'J' (4x6)
+	// ###
+	//  # 
+	//  # 
+	//# # 
+	//# # 
+	// #  
+	0x72, 0x2A, 0xA4,
+
+	// @118 'K' (5x6)
+	//## ##
+	// # # 
+	// ##  
+	// ### 
+	// # # 
+	//## ##
+	0xDA, 0x98, 0xE5, 0x6C,
+
+	// @122 'L' (5x6)
+	//###  
+	// #   
+	// #   
+	// #   
+	// #  #
+	//#####
+	0xE2, 0x10, 0x84, 0xFC,
+
+	// @126 'M' (5x6)
+	//## ##
+	//## ##
+	//## ##
+	//# # #
+	//#   #
+	//## ##
+	0xDE, 0xF7, 0x58, 0xEC,
+
+	// @130 'N' (5x6)
+	//## ##
+	// ## #
+	// ## #
+	// # ##
+	// # ##
+	//### #
+	0xDB, 0x5A, 0xB5, 0xF4,
+
+	// @134 'O' (4x6)
+	// ## 
+	//#  #
+	//#  #
+	//#  #
+	//#  #
+	// ## 
+	0x69, 0x99, 0x96,
+
+	// @137 'P' (5x6)
+	//#### 
+	// #  #
+	// #  #
+	// ### 
+	// #   
+	//###  
+	0xF2, 0x52, 0xE4, 0x70,
+
+	// @141 'Q' (4x7)
+	// ## 
+	//#  #
+	//#  #
+	//#  #
+	//#  #
+	// ## 
+	//  ##
+	0x69, 0x99, 0x96, 0x30,
+
+	// @145 'R' (5x6)
+	//#### 
+	// #  #
+	// #  #
+	// ### 
+	// #  #
+	//### #
+	0xF2, 0x52, 0xE4, 0xF4,
+
+	// @149 'S' (3x6)
+	//###
+	//# #
+	// # 
+	//  #
+	//# #
+	//###
+	0xF5, 0x1B, 0xC0,
+
+	// @152 'T' (5x6)
+	//#####
+	//# # #
+	//  #  
+	//  #  
+	//  #  
+	// ### 
+	0xFD, 0x48, 0x42, 0x38,
+
+	// @156 'U' (5x6)
+	//## ##
+	// #  #
+	// #  #
+	// #  #
+	// #  #
+	//  ## 
+	0xDA, 0x52, 0x94, 0x98,
+
+	// @160 'V' (5x6)
+	//## ##
+	//#   #
+	// #  #
+	// # # 
+	// # # 
+	//  ## 
+	0xDC, 0x52, 0xA5, 0x18,
+
+	// @164 'W' (5x6)
+	//## ##
+	//#   #
+	//# # #
+	//# # #
+	//# # #
+	// # # 
+	0xDC, 0x6B, 0x5A, 0xA8,
+
+	// @168 'X' (5x6)
+	//## ##
+	// # # 
+	//  #  
+	//  #  
+	// # # 
+	//## ##
+	0xDA, 0x88, 0x45, 0x6C,
+
+	// @172 'Y' (5x6)
+	//## ##
+	//#   #
+	// # # 
+	//  #  
+	//  #  
+	// ### 
+	0xDC, 0x54, 0x42, 0x38,
+
+	// @176 'Z' (4x6)
+	//####
+	//#  #
+	//  # 
+	// #  
+	//#  #
+	//####
+	0xF9, 0x24, 0x9F,
+
+	// @179 '[' (2x7)
+	//##
+	//# 
+	//# 
+	//# 
+	//# 
+	//# 
+	//##
+	0xEA, 0xAC,
+
+	// @181 '\' (4x7)
+	//#   
+	// #  
+	// #  
+	//  # 
+	//  # 
+	//  # 
+	//   #
+	0x84, 0x42, 0x22, 0x10,
+
+	// @185 ']' (2x7)
+	//##
+	// #
+	// #
+	// #
+	// #
+	// #
+	//##
+	0xD5, 0x5C,
+
+	// @187 '^' (3x3)
+	// # 
+	// # 
+	//# #
+	0x4A, 0x80,
+
+	// @189 '_' (5x1)
+	//#####
+	0xF8,
+
+	// @190 '`' (2x2)
+	//# 
+	// #
+	0x90,
+
+	// @191 'a' (4x4)
+	// ## 
+	//  # 
+	//### 
+	//####
+	0x62, 0xEF,
+
+	// @193 'b' (5x6)
+	//##   
+	// #   
+	// ### 
+	// #  #
+	// #  #
+	//#### 
+	0xC2, 0x1C, 0x94, 0xF8,
+
+	// @197 'c' (3x4)
+	//###
+	//#  
+	//#  
+	//###
+	0xF2, 0x70,
+
+	// @199 'd' (4x6)
+	//  ##
+	//   #
+	// ###
+	//#  #
+	//#  #
+	// ###
+	0x31, 0x79, 0x97,
+
+	// @202 'e' (3x4)
+	//###
+	//###
+	//#  
+	// ##
+	0xFE, 0x30,
+
+	// @204 'f' (3x6)
+	//  #
+	// # 
+	//###
+	// # 
+	// # 
+	//###
+	0x2B, 0xA5, 0xC0,
+
+	// @207 'g' (4x6)
+	// ###
+	//#  #
+	//#  #
+	// ###
+	//   #
+	// ## 
+	0x79, 0x97, 0x16,
+
+	// @210 'h' (5x6)
+	//##   
+	// #   
+	// ### 
+	// #  #
+	// #  #
+	//### #
+	0xC2, 0x1C, 0x94, 0xF4,
+
+	// @214 'i' (3x6)
+	// # 
+	//   
+	//## 
+	// # 
+	// # 
+	//###
+	0x43, 0x25, 0xC0,
+
+	// @217 'j' (3x8)
+	// # 
+	//   
+	//###
+	//  #
+	//  #
+	//  #
+	//  #
+	//###
+	0x43, 0x92, 0x4F,
+
+	// @220 'k' (5x6)
+	//##   
+	// #   
+	// # ##
+	// ### 
+	// # # 
+	//## ##
+	0xC2, 0x16, 0xE5, 0x6C,
+
+	// @224 'l' (3x6)
+	//## 
+	// # 
+	// # 
+	// # 
+	// # 
+	//###
+	0xC9, 0x25, 0xC0,
+
+	// @227 'm' (5x4)
+	//## # 
+	//# # #
+	//# # #
+	//# # #
+	0xD5, 0x6B, 0x50,
+
+	// @230 'n' (5x4)
+	//#### 
+	// #  #
+	// #  #
+	//##  #
+	0xF2, 0x53, 0x90,
+
+	// @233 'o' (4x4)
+	// ## 
+	//#  #
+	//#  #
+	// ## 
+	0x69, 0x96,
+
+	// @235 'p' (5x6)
+	//#### 
+	// #  #
+	// #  #
+	// ### 
+	// #   
+	//###  
+	0xF2, 0x52, 0xE4, 0x70,
+
+	// @239 'q' (4x6)
+	// ###
+	//#  #
+	//#  #
+	// ###
+	//   #
+	//  ##
+	0x79, 0x97, 0x13,
+
+	// @242 'r' (4x4)
+	//####
+	// #  
+	// #  
+	//### 
+	0xF4, 0x4E,
+
+	// @244 's' (3x4)
+	// ##
+	// # 
+	//  #
+	//## 
+	0x68, 0xE0,
+
+	// @246 't' (5x5)
+	// #   
+	//#### 
+	// #   
+	// #  #
+	//  ## 
+	0x47, 0x90, 0x93, 0x00,
+
+	// @250 'u' (5x4)
+	//## ##
+	// #  #
+	// #  #
+	//  ###
+	0xDA, 0x52, 0x70,
+
+	// @253 'v' (5x4)
+	//##  #
+	// #  #
+	//  ## 
+	//  ## 
+	0xCA, 0x4C, 0x60,
+
+	// @256 'w' (5x4)
+	//## ##
+	//# # #
+	//# # #
+	// # # 
+	0xDD, 0x6A, 0xA0,
+
+	// @259 'x' (4x4)
+	//#  #
+	// ## 
+	// ## 
+	//#  #
+	0x96, 0x69,
+
+	// @261 'y' (5x6)
+	//## ##
+	// # # 
+	// # # 
+	//  #  
+	//  #  
+	// ##  
+	0xDA, 0x94, 0x42, 0x30,
+
+	// @265 'z' (4x4)
+	//####
+	//# # 
+	// # #
+	//####
+	0xFA, 0x5F,
+
+	// @267 '{' (3x7)
+	//  #
+	// # 
+	// # 
+	//## 
+	// # 
+	// # 
+	//  #
+	0x29, 0x64, 0x88,
+
+	// @270 '|' (1x7)
+	//#
+	//#
+	//#
+	//#
+	//#
+	//#
+	//#
+	0xFE,
+
+	// @271 '}' (3x7)
+	//#  
+	// # 
+	// # 
+	// ##
+	// # 
+	// # 
+	//#  
+	0x89, 0x34, 0xA0,
+
+	// @274 '~' (4x2)
+	// # #
+	//# # 
+	0x5A,
+
+	// @275 degree sign (3x3)
+	//###
+	//# #
+	//###
+	0xF7, 0x80,
+};
+
+const sGLYPH Font8P_Glyphs[] =
+{
+	//Offset, Width, Height, Left, Top, Advance
+	{0, 0, 0, 0, 0, 2}, // ' '
+	{0, 1, 6, 1, 0, 2}, // '!'
+	{1, 3, 2, 1, 0, 4}, // '"'
+	{2, 5, 7, 1, 0, 6}, // '#'
+	{7, 3, 7, 1, 0, 4}, // '$'
+	{10, 4, 6, 1, 0, 5}, // '%'
+	{13, 4, 5, 1, 1, 5}, // '&'
+	{16, 1, 3, 1, 0, 2}, // '''
+	{17, 2, 7, 1, 0, 3}, // '('
+	{19, 2, 7, 1, 0, 3}, // ')'
+	{21, 3, 4, 1, 0, 4}, // '*'
+	{23, 5, 5, 1, 1, 6}, // '+'
+	{27, 2, 3, 1, 4, 3}, // ','
+	{28, 3, 1, 1, 3, 4}, // '-'
+	{29, 1, 1, 1, 5, 2}, // '.'
+	{30, 4, 7, 1, 0, 5}, // '/'
+	{34, 3, 6, 1, 0, 4}, // '0'
+	{37, 5, 6, 1, 0, 6}, // '1'
+	{41, 3, 6, 1, 0, 4}, // '2'
+	{44, 3, 6, 1, 0, 4}, // '3'
+	{47, 4, 6, 1, 0, 5}, // '4'
+	{50, 3, 6, 1, 0, 4}, // '5'
+	{53, 3, 6, 1, 0, 4}, // '6'
+	{56, 3, 6, 1, 0, 4}, // '7'
+	{59, 3, 6, 1, 0, 4}, // '8'
+	{62, 3, 6, 1, 0, 4}, // '9'
+	{65, 1, 4, 1, 2, 2}, // ':'
+	{66, 2, 4, 1, 2, 3}, // ';'
+	{67, 4, 5, 1, 1, 5}, // '<'
+	{70, 3, 3, 1, 1, 4}, // '='
+	{72, 4, 5, 1, 1, 5}, // '>'
+	{75, 3, 6, 1, 0, 4}, // '?'
+	{78, 4, 7, 1, 0, 5}, // '@'
+	{82, 5, 6, 1, 0, 6}, // 'A'
+	{86, 5, 6, 1, 0, 6}, // 'B'
+	{90, 3, 6, 1, 0, 4}, // 'C'
+	{93, 5, 6, 1, 0, 6}, // 'D'
+	{97, 5, 6, 1, 0, 6}, // 'E'
+	{101, 5, 6, 1, 0, 6}, // 'F'
+	{105, 4, 6, 1, 0, 5}, // 'G'
+	{108, 5, 6, 1, 0, 6}, // 'H'
+	{112, 3, 6, 1, 0, 4}, // 'I'
+	{115, 4, 6, 1, 0, 5}, // 'J'
+	{118, 5, 6, 1, 0, 6}, // 'K'
+	{122, 5, 6, 1, 0, 6}, // 'L'
+	{126, 5, 6, 1, 0, 6}, // 'M'
+	{130, 5, 6, 1, 0, 6}, // 'N'
+	{134, 4, 6, 1, 0, 5}, // 'O'
+	{137, 5, 6, 1, 0, 6}, // 'P'
+	{141, 4, 7, 1, 0, 5}, // 'Q'
+	{145, 5, 6, 1, 0, 6}, // 'R'
+	{149, 3, 6, 1, 0, 4}, // 'S'
+	{152, 5, 6, 1, 0, 6}, // 'T'
+	{156, 5, 6, 1, 0, 6}, // 'U'
+	{160, 5, 6, 1, 0, 6}, // 'V'
+	{164, 5, 6, 1, 0, 6}, // 'W'
+	{168, 5, 6, 1, 0, 6}, // 'X'
+	{172, 5, 6, 1, 0, 6}, // 'Y'
+	{176, 4, 6, 1, 0, 5}, // 'Z'
+	{179, 2, 7, 1, 0, 3}, // '['
+	{181, 4, 7, 1, 0, 5}, // '\'
+	{185, 2, 7, 1, 0, 3}, // ']'
+	{187, 3, 3, 1, 0, 4}, // '^'
+	{189, 5, 1, 1, 7, 6}, // '_'
+	{190, 2, 2, 1, 0, 3}, // '`'
+	{191, 4, 4, 1, 2, 5}, // 'a'
+	{193, 5, 6, 1, 0, 6}, // 'b'
+	{197, 3, 4, 1, 2, 4}, // 'c'
+	{199, 4, 6, 1, 0, 5}, // 'd'
+	{202, 3, 4, 1, 2, 4}, // 'e'
+	{204, 3, 6, 1, 0, 4}, // 'f'
+	{207, 4, 6, 1, 2, 5}, // 'g'
+	{210, 5, 6, 1, 0, 6}, // 'h'
+	{214, 3, 6, 1, 0, 4}, // 'i'
+	{217, 3, 8, 1, 0, 4}, // 'j'
+	{220, 5, 6, 1, 0, 6}, // 'k'
+	{224, 3, 6, 1, 0, 4}, // 'l'
+	{227, 5, 4, 1, 2, 6}, // 'm'
+	{230, 5, 4, 1, 2, 6}, // 'n'
+	{233, 4, 4, 1, 2, 5}, // 'o'
+	{235, 5, 6, 1, 2, 6}, // 'p'
+	{239, 4, 6, 1, 2, 5}, // 'q'
+	{242, 4, 4, 1, 2, 5}, // 'r'
+	{244, 3, 4, 1, 2, 4}, // 's'
+	{246, 5, 5, 1, 1, 6}, // 't'
+	{250, 5, 4, 1, 2, 6}, // 'u'
+	{253, 5, 4, 1, 2, 6}, // 'v'
+	{256, 5, 4, 1, 2, 6}, // 'w'
+	{259, 4, 4, 1, 2, 5}, // 'x'
+	{261, 5, 6, 1, 2, 6}, // 'y'
+	{265, 4, 4, 1, 2, 5}, // 'z'
+	{267, 3, 7, 1, 0, 4}, // '{'
+	{270, 1, 7, 1, 0, 2}, // '|'
+	{271, 3, 7, 1, 0, 4}, // '}'
+	{274, 4, 2, 1, 3, 5}, // '~'
+	{275, 3, 3, 1, 1, 4}, // degree sign
+	{275, 3, 3, 1, 1, 4}, // U+00B0
+};
+
+const sRANGE Font8P_Ranges[] =
+{
+	//First, Count, Index
+	{0x00B0, 1, 96}, // U+00B0
+};
+
+sFONT Font8P = {
+  Font8P_Table,
+  6, /* Width */
+  8, /* Height */
+  Font8P_Glyphs,
+  0x20, /* First */
+  0x7F, /* Last */
+  FONT_ENCODING_BITS,
+  0, /* Map: every code from First to Last */
+  '?', /* Fallback */
+  Font8P_Ranges,
+  1, /* RangeCount */
+  0, /* Kerning: none */
+  0, /* KernCount */
+};
@@ -45,6 +45,10 @@
 #define MAX_WIDTH_FONT          32
 #define OFFSET_BITMAP           54
 
+//Degree sign in UTF-8. The legacy tables store it after '~' in the place
+//of DEL, and "\x7F" still draws it from there.
+#define FONT_DEGREE             "\xC2\xB0"
+
 #ifdef __cplusplus
  extern "C" {
 #endif
@@ -52,13 +56,66 @@
 /* Includes ------------------------------------------------------------------*/
 #include <stdint.h>
 // #include <avr/pgmspace.h>
+//Metrics of one glyph of a proportional font
+typedef struct
+{
+  uint16_t Offset;    //First byte of the glyph bitmap in the font table
+  uint8_t Width;      //Size of the bitmap, rows are packed without padding
+  uint8_t Height;
+  uint8_t Left;       //Bitmap position from the pen and from the top of the line
+  uint8_t Top;
+  uint8_t Advance;    //Pen movement, covers Left + Width
+} sGLYPH;
+
+//Run of consecutive code points of a proportional font
+typedef struct
+{
+  uint32_t First;     //First code point
+  uint16_t Count;     //Code points in the run
+  uint16_t Index;     //Glyph of First in the font's Glyphs
+} sRANGE;
+
+//Kerning pair of a proportional font
+typedef struct
+{
+  uint16_t Left;      //Code point drawn first
+  uint16_t Right;     //Code point following it
+  int8_t Adjust;      //Pixels added to the advance of Left, usually negative
+} sKERN;
+
 //ASCII
+//A monospaced font only sets table, Width and Height: every glyph from ' '
+//is a Width x Height cell with rows padded to whole bytes.
+//A proportional font also sets Glyphs, indexed from First to Last, and its
+//table holds the tightly packed bitmaps; Width is then the widest advance.
+//With FONT_ENCODING_ROWS every bitmap row starts with a bit: 1 repeats the
+//row above, 0 is followed by the Width bits of a new row.
+//A subset sets Map, one bit per code from First (code First + n is bit
+//n % 32 of word n / 32), and Glyphs only holds the codes whose bit is set.
+//Code points past Last are listed in Ranges, sorted and not overlapping;
+//each range holds Count glyphs from Glyphs[Index] on. ASCII text never
+//searches them.
+//Characters without a glyph are drawn as Fallback, if set.
+//Kerning, if set, holds KernCount pairs sorted by Left, then Right; pairs
+//not listed are spaced by their advances alone.
+#define FONT_ENCODING_BITS  0
+#define FONT_ENCODING_ROWS  1
+
 typedef struct _tFont
 {    
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
-  
+  const sGLYPH *Glyphs;
+  uint8_t First;
+  uint8_t Last;
+  uint8_t Encoding;
+  const uint32_t *Map;
+  uint8_t Fallback;
+  const sRANGE *Ranges;
+  uint16_t RangeCount;
+  const sKERN *Kerning;
+  uint16_t KernCount;
 } sFONT;
 
 
@@ -69,6 +126,17 @@ extern sFONT Font12;
 extern sFONT Font32;
 extern sFONT Font8;
 
+//Proportional versions
+extern sFONT Font8P;
+extern sFONT Font12P;
+extern sFONT Font16P;
+extern sFONT Font20P;
+extern sFONT Font24P;
+extern sFONT Font32P;
+
+//Subsets
+extern sFONT Font32N;    //Font32P digits and signs for temperatures
+
 
 #ifdef __cplusplus
 }
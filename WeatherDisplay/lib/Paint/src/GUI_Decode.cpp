@@ -0,0 +1,969 @@
+/******************************************************************************
+* | File      	:   GUI_Decode.cpp
+* | Function    :   Decode PBM/PGM/PPM, BMP and PNG images chunk by chunk
+*                   straight into a paint context
+* | Info        :
+*   Each format is a small state machine fed whatever bytes arrived.
+*   Header fields are gathered in Head, pixel rows in Row, and every
+*   complete row is converted and drawn at once.
+*
+*   Inflate works on a 64-bit bit buffer. Every step (a header field, a
+*   literal, a length/distance pair) needs at most 48 bits and is run on
+*   a copy of the buffer: if the bits run out it is simply retried once
+*   more input has come, so no input has to be kept by the caller.
+******************************************************************************/
+#include "GUI_Decode.h"
+#include "Debug.h"
+#include <string.h>
+
+enum {
+    DECODE_FORMAT_NONE = 0,
+    DECODE_FORMAT_PNM,
+    DECODE_FORMAT_BMP,
+    DECODE_FORMAT_PNG,
+};
+
+enum {
+    DECODE_OUTPUT_BITS = 0,
+    DECODE_OUTPUT_GRAY,
+    DECODE_OUTPUT_RGB,
+};
+
+//Pixel layout, numbered as PNG color types
+enum {
+    DECODE_GRAY = 0,
+    DECODE_RGB = 2,
+    DECODE_INDEXED = 3,
+    DECODE_GRAY_ALPHA = 4,
+    DECODE_RGB_ALPHA = 6,
+};
+
+enum {
+    PNM_HEADER = 0,
+    PNM_ROWS,
+
+    BMP_HEADER = 0,
+    BMP_SKIP_TO_PALETTE,
+    BMP_PALETTE,
+    BMP_SKIP_TO_PIXELS,
+    BMP_ROWS,
+
+    PNG_SIGNATURE = 0,
+    PNG_CHUNK,
+    PNG_IHDR,
+    PNG_PLTE,
+    PNG_IDAT,
+    PNG_SKIP,
+    PNG_CRC,
+};
+
+/******************************************************************************
+function: Start decoding an image
+parameter:
+    Dec       : Decoder state
+    Ctx       : Target context
+    Xstart    : X starting coordinates of the image
+    Ystart    : Y starting coordinates of the image
+    Method    : Dithering of gray and colour images
+    Work      : Work area, 4-byte aligned, see DECODE_WORK_SIZE
+    Work_Size : Bytes in Work
+info:
+    The format is recognized from the first bytes fed.
+******************************************************************************/
+void PaintDecoder_Init(PAINT_DECODER *Dec, PaintContext *Ctx, UWORD Xstart, UWORD Ystart,
+                       DITHER_METHOD Method, void *Work, UDOUBLE Work_Size)
+{
+    memset(Dec, 0, sizeof(PAINT_DECODER));
+    Dec->Ctx = Ctx;
+    Dec->Xstart = Xstart;
+    Dec->Ystart = Ystart;
+    Dec->Method = Method;
+    Dec->Work = (UBYTE *)Work;
+    Dec->Work_Size = Work_Size;
+    Dec->Status = DECODE_MORE;
+}
+
+static UBYTE PaintDecoder_Fail(PAINT_DECODER *Dec, const char *Reason)
+{
+    Debug("PaintDecoder: ");
+    Debug(Reason);
+    Debug("\r\n");
+    Dec->Status = DECODE_ERROR;
+    return 0;
+}
+
+static void *PaintDecoder_Alloc(PAINT_DECODER *Dec, UDOUBLE Size)
+{
+    UDOUBLE Start = (Dec->Work_Used + 3) & ~3UL;
+    if (Start + Size > Dec->Work_Size) {
+        PaintDecoder_Fail(Dec, "work area too small");
+        return NULL;
+    }
+    Dec->Work_Used = Start + Size;
+    return Dec->Work + Start;
+}
+
+static UDOUBLE PaintDecoder_Le16(const UBYTE *p) { return p[0] | (p[1] << 8); }
+static UDOUBLE PaintDecoder_Le32(const UBYTE *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((UDOUBLE)p[3] << 24); }
+static UDOUBLE PaintDecoder_Be32(const UBYTE *p) { return ((UDOUBLE)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3]; }
+
+/******************************************************************************
+function: Set up the row buffers once the header is known
+parameter:
+    Row_Bytes : Bytes of one encoded row
+info:
+    1-bit gray images are blitted as they are, other gray images are
+    dithered on their gray level and everything else in colour.
+******************************************************************************/
+static UBYTE PaintDecoder_Start(PAINT_DECODER *Dec, UDOUBLE Row_Bytes)
+{
+    UWORD Width = Dec->Width;
+    if (Width == 0 || Dec->Height == 0)
+        return PaintDecoder_Fail(Dec, "empty image");
+
+    if (Dec->Channels == 1 && Dec->Depth == 1 && Dec->Layout != DECODE_INDEXED)
+        Dec->Output = DECODE_OUTPUT_BITS;
+    else if (Dec->Layout == DECODE_GRAY || Dec->Layout == DECODE_GRAY_ALPHA)
+        Dec->Output = DECODE_OUTPUT_GRAY;
+    else
+        Dec->Output = DECODE_OUTPUT_RGB;
+
+    Dec->Row_Bytes = Row_Bytes;
+    Dec->Row = (UBYTE *)PaintDecoder_Alloc(Dec, Row_Bytes);
+    if (Dec->Format == DECODE_FORMAT_PNG) {
+        Dec->Prev = (UBYTE *)PaintDecoder_Alloc(Dec, Row_Bytes);
+        if (Dec->Prev)
+            memset(Dec->Prev, 0, Row_Bytes);
+    }
+    if (Dec->Output == DECODE_OUTPUT_BITS) {
+        Dec->Pixels = (UBYTE *)PaintDecoder_Alloc(Dec, (Width + 7) / 8);
+    } else {
+        Dec->Pixels = (UBYTE *)PaintDecoder_Alloc(Dec, (Dec->Output == DECODE_OUTPUT_RGB ? 3 : 1) * (UDOUBLE)Width);
+        void *Dither_Work = PaintDecoder_Alloc(Dec, DITHER_WORK_SIZE(Width));
+        if (Dither_Work == NULL)
+            return 0;
+        PaintDither_Init(&Dec->Dither, Dec->Ctx, Dec->Xstart, Dec->Ystart, Width, Dec->Height,
+                         (DITHER_METHOD)Dec->Method, Dither_Work);
+        PaintDither_SetBottomUp(&Dec->Dither, Dec->Bottom_Up);
+    }
+    return Dec->Status == DECODE_MORE;
+}
+
+/******************************************************************************
+function: Read sample x of a row of Depth-bit samples, scaled to 0..255
+******************************************************************************/
+static UBYTE PaintDecoder_Sample(const PAINT_DECODER *Dec, const UBYTE *Src, UDOUBLE x)
+{
+    UBYTE Depth = Dec->Depth;
+    if (Depth == 8)
+        return Src[x];
+    if (Depth == 16)
+        return Src[x * 2];
+    UDOUBLE Bit = x * Depth;
+    return (Src[Bit / 8] >> (8 - Depth - Bit % 8)) & ((1 << Depth) - 1);
+}
+
+/******************************************************************************
+function: Convert a decoded row and draw it
+parameter:
+    Src : Row of pixels in the layout of the file
+******************************************************************************/
+static void PaintDecoder_EmitRow(PAINT_DECODER *Dec, const UBYTE *Src)
+{
+    UWORD Width = Dec->Width;
+    UBYTE *Out = Dec->Pixels;
+    UBYTE Bytes = Dec->Depth == 16 ? 2 : 1;
+    //Largest sample value, scaled to 255
+    UWORD Max = Dec->Format == DECODE_FORMAT_PNM ? Dec->Value : Dec->Depth < 8 ? (1 << Dec->Depth) - 1 : 255;
+
+    if (Dec->Output == DECODE_OUTPUT_BITS) {
+        //PBM uses 1 for black
+        UBYTE Invert = Dec->Format == DECODE_FORMAT_PNM ? 0xFF : 0x00;
+        for (UWORD i = 0; i < (Width + 7) / 8; i++)
+            Out[i] = Src[i] ^ Invert;
+    } else {
+        for (UWORD x = 0; x < Width; x++) {
+            UBYTE R, G, B, A = 255;
+            const UBYTE *P = Src + (UDOUBLE)x * Dec->Channels * Bytes;
+            switch (Dec->Layout) {
+            case DECODE_INDEXED: {
+                UBYTE Index = PaintDecoder_Sample(Dec, Src, x);
+                if (Index >= Dec->Palette_Count)
+                    Index = 0;
+                R = Dec->Palette[Index][0];
+                G = Dec->Palette[Index][1];
+                B = Dec->Palette[Index][2];
+                break;
+            }
+            case DECODE_GRAY_ALPHA:
+                A = P[Bytes];
+                //fall through
+            case DECODE_GRAY:
+                R = G = B = (UWORD)PaintDecoder_Sample(Dec, Src, (UDOUBLE)x * Dec->Channels) * 255 / Max;
+                break;
+            case DECODE_RGB_ALPHA:
+                A = P[3 * Bytes];
+                //fall through
+            default:
+                R = (UWORD)P[0] * 255 / Max;
+                G = (UWORD)P[Bytes] * 255 / Max;
+                B = (UWORD)P[2 * Bytes] * 255 / Max;
+                //BMP stores blue first and no alpha
+                if (Dec->Format == DECODE_FORMAT_BMP) {
+                    UBYTE T = R;
+                    R = B;
+                    B = T;
+                }
+                break;
+            }
+            //Transparent pixels are shown over white
+            if (A != 255) {
+                R = (R * A + 255 * (255 - A)) / 255;
+                G = (G * A + 255 * (255 - A)) / 255;
+                B = (B * A + 255 * (255 - A)) / 255;
+            }
+            if (Dec->Output == DECODE_OUTPUT_GRAY) {
+                Out[x] = G;
+            } else {
+                Out[3 * x] = R;
+                Out[3 * x + 1] = G;
+                Out[3 * x + 2] = B;
+            }
+        }
+    }
+
+    if (Dec->Output == DECODE_OUTPUT_BITS) {
+        UWORD Y = Dec->Bottom_Up ? Dec->Ystart + Dec->Height - 1 - Dec->Rows : Dec->Ystart + Dec->Rows;
+        PaintCtx_DrawImage(Dec->Ctx, Out, Dec->Xstart, Y, Width, 1);
+    } else if (Dec->Output == DECODE_OUTPUT_GRAY) {
+        PaintDither_Gray(&Dec->Dither, Out);
+    } else {
+        PaintDither_RGB(&Dec->Dither, Out);
+    }
+    if (++Dec->Rows == Dec->Height)
+        Dec->Status = DECODE_DONE;
+}
+
+/******************************************************************************
+function: Gather header bytes until Head holds Count of them
+return:
+    Bytes used
+******************************************************************************/
+static UDOUBLE PaintDecoder_Collect(PAINT_DECODER *Dec, const UBYTE *Data, UDOUBLE Len, UBYTE Count)
+{
+    UDOUBLE Used = Count - Dec->Head_Len;
+    if (Used > Len)
+        Used = Len;
+    memcpy(Dec->Head + Dec->Head_Len, Data, Used);
+    Dec->Head_Len += Used;
+    return Used;
+}
+
+/******************************************************************************
+function: Gather a row of a file without compression and draw it once complete
+******************************************************************************/
+static UDOUBLE PaintDecoder_RowData(PAINT_DECODER *Dec, const UBYTE *Data, UDOUBLE Len)
+{
+    UDOUBLE Used = Dec->Row_Bytes - Dec->Row_Pos;
+    if (Used > Len)
+        Used = Len;
+    memcpy(Dec->Row + Dec->Row_Pos, Data, Used);
+    Dec->Row_Pos += Used;
+    if (Dec->Row_Pos == Dec->Row_Bytes) {
+        Dec->Row_Pos = 0;
+        PaintDecoder_EmitRow(Dec, Dec->Row);
+    }
+    return Used;
+}
+
+/******************************************************************************
+function: PBM (P4), PGM (P5) and PPM (P6)
+info:
+    The header is read a byte at a time: Field counts the tokens (magic,
+    width, height, maximum value), Head[0] holds the magic digit,
+    Head[1] is set inside a comment and Head[2] inside a token. The
+    maximum value stays in Value.
+******************************************************************************/
+static UDOUBLE PaintDecoder_Pnm(PAINT_DECODER *Dec, const UBYTE *Data, UDOUBLE Len)
+{
+    if (Dec->State == PNM_ROWS)
+        return PaintDecoder_RowData(Dec, Data, Len);
+
+    UBYTE c = Data[0];
+    if (Dec->Head[1]) {
+        if (c == '\n' || c == '\r')
+            Dec->Head[1] = 0;
+        return 1;
+    }
+    if (c == '#' && !Dec->Head[2]) {
+        Dec->Head[1] = 1;
+        return 1;
+    }
+    if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+        if (!Dec->Head[2])
+            return 1;
+        Dec->Head[2] = 0;
+        switch (Dec->Field++) {
+        case 0:
+            if (Dec->Head[0] < '4' || Dec->Head[0] > '6')
+                return PaintDecoder_Fail(Dec, "only P4, P5 and P6 images");
+            break;
+        case 1:
+            Dec->Width = Dec->Value;
+            break;
+        case 2:
+            Dec->Height = Dec->Value;
+            break;
+        default:
+            if (Dec->Value == 0 || Dec->Value > 255)
+                return PaintDecoder_Fail(Dec, "maximum value above 255");
+            break;
+        }
+        if (Dec->Field == (Dec->Head[0] == '4' ? 3 : 4)) {
+            //The single whitespace after the header is consumed
+            UWORD Width = Dec->Width;
+            Dec->Channels = Dec->Head[0] == '6' ? 3 : 1;
+            Dec->Depth = Dec->Head[0] == '4' ? 1 : 8;
+            Dec->Layout = Dec->Head[0] == '6' ? DECODE_RGB : DECODE_GRAY;
+            if (Dec->Head[0] == '4')
+                Dec->Value = 1;
+            Dec->State = PNM_ROWS;
+            PaintDecoder_Start(Dec, Dec->Depth == 1 ? (Width + 7) / 8 : (UDOUBLE)Width * Dec->Channels);
+        } else {
+            Dec->Value = 0;
+        }
+        return 1;
+    }
+
+    if (Dec->Field == 0) {
+        if (Dec->Head[2])
+            Dec->Head[0] = c;
+        else if (c != 'P')
+            return PaintDecoder_Fail(Dec, "not a PNM image");
+    } else if (c >= '0' && c <= '9') {
+        Dec->Value = Dec->Value * 10 + (c - '0');
+        if (Dec->Value > 0xFFFF)
+            return PaintDecoder_Fail(Dec, "image too large");
+    } else {
+        return PaintDecoder_Fail(Dec, "bad PNM header");
+    }
+    Dec->Head[2] = 1;
+    return 1;
+}
+
+/******************************************************************************
+function: BMP, uncompressed
+info:
+    File and info headers are gathered in one go, then the palette, then
+    the rows, which are padded to 4 bytes and usually stored bottom up.
+    Target is the file offset where the current section ends.
+******************************************************************************/
+static UDOUBLE PaintDecoder_Bmp(PAINT_DECODER *Dec, const UBYTE *Data, UDOUBLE Len)
+{
+    UDOUBLE Used;
+    switch (Dec->State) {
+    case BMP_HEADER: {
+        Used = PaintDecoder_Collect(Dec, Data, Len, 54);
+        if (Dec->Head_Len < 54)
+            return Used;
+        Dec->Head_Len = 0;
+        const UBYTE *Head = Dec->Head;
+        UDOUBLE Info_Size = PaintDecoder_Le32(Head + 14);
+        long Width = (long)(int32_t)PaintDecoder_Le32(Head + 18);
+        long Height = (long)(int32_t)PaintDecoder_Le32(Head + 22);
+        UDOUBLE Bpp = PaintDecoder_Le16(Head + 28);
+        UDOUBLE Colors = PaintDecoder_Le32(Head + 46);
+        if (Head[0] != 'B' || Head[1] != 'M' || Info_Size < 40)
+            return PaintDecoder_Fail(Dec, "not a BMP image");
+        if (PaintDecoder_Le32(Head + 30) != 0)
+            return PaintDecoder_Fail(Dec, "compressed BMP");
+        if (Bpp != 1 && Bpp != 4 && Bpp != 8 && Bpp != 24 && Bpp != 32)
+            return PaintDecoder_Fail(Dec, "unsupported BMP depth");
+        if (Height < 0)
+            Height = -Height;
+        else
+            Dec->Bottom_Up = 1;
+        if (Width <= 0 || Width > 0xFFFF || Height > 0xFFFF)
+            return PaintDecoder_Fail(Dec, "image too large");
+        Dec->Width = Width;
+        Dec->Height = Height;
+        if (Bpp <= 8) {
+            Dec->Layout = DECODE_INDEXED;
+            Dec->Depth = Bpp;
+            Dec->Channels = 1;
+            Dec->Palette_Count = (Colors && Colors < 256) ? Colors : 1 << Bpp;
+        } else {
+            Dec->Layout = DECODE_RGB;
+            Dec->Depth = 8;
+            Dec->Channels = Bpp / 8;
+        }
+        Dec->Value = PaintDecoder_Le32(Head + 10);   //Offset of the pixels
+        Dec->Target = 14 + Info_Size;
+        Dec->State = BMP_SKIP_TO_PALETTE;
+        PaintDecoder_Start(Dec, (Width * Bpp + 31) / 32 * 4);
+        return Used;
+    }
+    case BMP_SKIP_TO_PALETTE:
+    case BMP_SKIP_TO_PIXELS:
+        if (Dec->Offset < Dec->Target) {
+            Used = Dec->Target - Dec->Offset;
+            return Used < Len ? Used : Len;
+        }
+        if (Dec->State == BMP_SKIP_TO_PALETTE && Dec->Palette_Count) {
+            Dec->State = BMP_PALETTE;
+            Dec->Target += 4 * Dec->Palette_Count;
+        } else {
+            if (Dec->Offset > Dec->Value)
+                return PaintDecoder_Fail(Dec, "bad BMP pixel offset");
+            Dec->State = Dec->Offset == Dec->Value ? BMP_ROWS : BMP_SKIP_TO_PIXELS;
+            Dec->Target = Dec->Value;
+        }
+        return 0;
+    case BMP_PALETTE:
+        Used = PaintDecoder_Collect(Dec, Data, Len, 4);
+        if (Dec->Head_Len == 4) {
+            UBYTE *Entry = Dec->Palette[Dec->Field++];
+            Dec->Head_Len = 0;
+            Entry[0] = Dec->Head[2];
+            Entry[1] = Dec->Head[1];
+            Entry[2] = Dec->Head[0];
+            if (Dec->Field == Dec->Palette_Count)
+                Dec->State = BMP_SKIP_TO_PIXELS;
+        }
+        return Used;
+    default:
+        return PaintDecoder_RowData(Dec, Data, Len);
+    }
+}
+
+/******************************************************************************
+Inflate
+******************************************************************************/
+enum {
+    INFLATE_ZLIB = 0,
+    INFLATE_BLOCK,
+    INFLATE_STORED_LEN,
+    INFLATE_STORED,
+    INFLATE_DYN_HEADER,
+    INFLATE_DYN_CODELEN,
+    INFLATE_DYN_LENS,
+    INFLATE_CODES,
+    INFLATE_CHECK,
+    INFLATE_END,
+};
+
+enum {
+    INFLATE_OK = 0,
+    INFLATE_NEED,   //Out of input bits, nothing was consumed
+    INFLATE_DONE,
+    INFLATE_BAD,
+};
+
+static const UWORD Inflate_Length_Base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const UBYTE Inflate_Length_Extra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static const UWORD Inflate_Dist_Base[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+static const UBYTE Inflate_Dist_Extra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+static const UBYTE Inflate_Code_Order[19] = {
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+/******************************************************************************
+function: Build a canonical Huffman code from code lengths
+return:
+    0 if complete, > 0 if incomplete, < 0 if over-subscribed
+******************************************************************************/
+static int Inflate_Build(PAINT_HUFFMAN *Huff, const UBYTE *Length, UWORD Count)
+{
+    UWORD Offset[16];
+    memset(Huff->Count, 0, sizeof(Huff->Count));
+    for (UWORD i = 0; i < Count; i++)
+        Huff->Count[Length[i]]++;
+    if (Huff->Count[0] == Count)
+        return 0;
+
+    int Left = 1;
+    for (UBYTE Len = 1; Len < 16; Len++) {
+        Left <<= 1;
+        Left -= Huff->Count[Len];
+        if (Left < 0)
+            return Left;
+    }
+    Offset[1] = 0;
+    for (UBYTE Len = 1; Len < 15; Len++)
+        Offset[Len + 1] = Offset[Len] + Huff->Count[Len];
+    for (UWORD i = 0; i < Count; i++)
+        if (Length[i])
+            Huff->Symbol[Offset[Length[i]]++] = i;
+    return Left;
+}
+
+//Only a code with a single symbol may be incomplete
+static UBYTE Inflate_Usable(const PAINT_HUFFMAN *Huff, int Left, UWORD Count)
+{
+    return Left == 0 || (Left > 0 && Count - Huff->Count[0] == 1);
+}
+
+static UBYTE Inflate_Take(uint64_t *Hold, UBYTE *Bits, UBYTE Count, UDOUBLE *Value)
+{
+    if (*Bits < Count)
+        return 0;
+    *Value = (UDOUBLE)(*Hold & (((uint64_t)1 << Count) - 1));
+    *Hold >>= Count;
+    *Bits -= Count;
+    return 1;
+}
+
+/******************************************************************************
+function: Decode one symbol, a bit at a time
+return:
+    Symbol, -1 if out of bits, -2 for an invalid code
+******************************************************************************/
+static int Inflate_Decode(uint64_t *Hold, UBYTE *Bits, const PAINT_HUFFMAN *Huff)
+{
+    uint64_t H = *Hold;
+    UBYTE B = *Bits;
+    int Code = 0, First = 0, Index = 0;
+    for (UBYTE Len = 1; Len < 16; Len++) {
+        if (B == 0)
+            return -1;
+        Code |= H & 1;
+        H >>= 1;
+        B--;
+        int Count = Huff->Count[Len];
+        if (Code - Count < First) {
+            *Hold = H;
+            *Bits = B;
+            return Huff->Symbol[Index + (Code - First)];
+        }
+        Index += Count;
+        First = (First + Count) << 1;
+        Code <<= 1;
+    }
+    return -2;
+}
+
+static void PaintDecoder_PngByte(PAINT_DECODER *Dec, UBYTE Byte);
+
+static void Inflate_Put(PAINT_DECODER *Dec, UBYTE Byte)
+{
+    PAINT_INFLATE *In = &Dec->Inflate;
+    In->Window[In->Total++ & In->Window_Mask] = Byte;
+    PaintDecoder_PngByte(Dec, Byte);
+}
+
+/******************************************************************************
+function: Run one inflate step
+info:
+    Bits are taken from a copy of the bit buffer, which is only written
+    back once the step is complete; a step that runs out of bits has no
+    effect and returns INFLATE_NEED.
+******************************************************************************/
+static UBYTE Inflate_Step(PAINT_DECODER *Dec)
+{
+    PAINT_INFLATE *In = &Dec->Inflate;
+    uint64_t Hold = In->Hold;
+    UBYTE Bits = In->Bits;
+    UDOUBLE Value;
+    int Symbol, Left;
+
+    switch (In->State) {
+    case INFLATE_ZLIB: {
+        if (!Inflate_Take(&Hold, &Bits, 16, &Value))
+            return INFLATE_NEED;
+        UBYTE Cmf = Value & 0xFF, Flg = Value >> 8;
+        if ((Cmf & 0x0F) != 8 || (Cmf >> 4) > 7 || (Cmf * 256 + Flg) % 31 || (Flg & 0x20))
+            return INFLATE_BAD;
+        UDOUBLE Size = 1UL << ((Cmf >> 4) + 8);
+        In->Window = (UBYTE *)PaintDecoder_Alloc(Dec, Size);
+        if (In->Window == NULL)
+            return INFLATE_BAD;
+        In->Window_Mask = Size - 1;
+        In->State = INFLATE_BLOCK;
+        break;
+    }
+    case INFLATE_BLOCK:
+        if (!Inflate_Take(&Hold, &Bits, 3, &Value))
+            return INFLATE_NEED;
+        In->Last = Value & 1;
+        if ((Value >> 1) == 0) {
+            //Stored blocks start on a byte boundary
+            Hold >>= Bits & 7;
+            Bits -= Bits & 7;
+            In->State = INFLATE_STORED_LEN;
+        } else if ((Value >> 1) == 1) {
+            memset(In->Lengths, 8, 144);
+            memset(In->Lengths + 144, 9, 112);
+            memset(In->Lengths + 256, 7, 24);
+            memset(In->Lengths + 280, 8, 8);
+            Inflate_Build(&In->Lencode, In->Lengths, 288);
+            memset(In->Lengths, 5, 30);
+            Inflate_Build(&In->Distcode, In->Lengths, 30);
+            In->State = INFLATE_CODES;
+        } else if ((Value >> 1) == 2) {
+            In->State = INFLATE_DYN_HEADER;
+        } else {
+            return INFLATE_BAD;
+        }
+        break;
+    case INFLATE_STORED_LEN:
+        if (!Inflate_Take(&Hold, &Bits, 32, &Value))
+            return INFLATE_NEED;
+        if ((Value & 0xFFFF) != (~Value >> 16))
+            return INFLATE_BAD;
+        In->Stored = Value & 0xFFFF;
+        In->State = In->Stored ? INFLATE_STORED : In->Last ? INFLATE_CHECK : INFLATE_BLOCK;
+        break;
+    case INFLATE_STORED:
+        if (!Inflate_Take(&Hold, &Bits, 8, &Value))
+            return INFLATE_NEED;
+        Inflate_Put(Dec, Value);
+        if (--In->Stored == 0)
+            In->State = In->Last ? INFLATE_CHECK : INFLATE_BLOCK;
+        break;
+    case INFLATE_DYN_HEADER:
+        if (!Inflate_Take(&Hold, &Bits, 14, &Value))
+            return INFLATE_NEED;
+        In->Nlen = (Value & 0x1F) + 257;
+        In->Ndist = ((Value >> 5) & 0x1F) + 1;
+        In->Ncode = (Value >> 10) + 4;
+        if (In->Nlen > 286 || In->Ndist > 30)
+            return INFLATE_BAD;
+        memset(In->Lengths, 0, 19);
+        In->Index = 0;
+        In->State = INFLATE_DYN_CODELEN;
+        break;
+    case INFLATE_DYN_CODELEN:
+        if (!Inflate_Take(&Hold, &Bits, 3, &Value))
+            return INFLATE_NEED;
+        In->Lengths[Inflate_Code_Order[In->Index++]] = Value;
+        if (In->Index == In->Ncode) {
+            //The code length code is kept in Distcode until the lengths are read
+            if (Inflate_Build(&In->Distcode, In->Lengths, 19) != 0)
+                return INFLATE_BAD;
+            In->Index = 0;
+            In->State = INFLATE_DYN_LENS;
+        }
+        break;
+    case INFLATE_DYN_LENS: {
+        UWORD Total = In->Nlen + In->Ndist;
+        UBYTE Length = 0;
+        UWORD Repeat = 1;
+        Symbol = Inflate_Decode(&Hold, &Bits, &In->Distcode);
+        if (Symbol == -1)
+            return INFLATE_NEED;
+        if (Symbol < 0)
+            return INFLATE_BAD;
+        if (Symbol < 16) {
+            Length = Symbol;
+        } else if (Symbol == 16) {
+            if (In->Index == 0)
+                return INFLATE_BAD;
+            if (!Inflate_Take(&Hold, &Bits, 2, &Value))
+                return INFLATE_NEED;
+            Length = In->Lengths[In->Index - 1];
+            Repeat = 3 + Value;
+        } else if (Symbol == 17) {
+            if (!Inflate_Take(&Hold, &Bits, 3, &Value))
+                return INFLATE_NEED;
+            Repeat = 3 + Value;
+        } else {
+            if (!Inflate_Take(&Hold, &Bits, 7, &Value))
+                return INFLATE_NEED;
+            Repeat = 11 + Value;
+        }
+        if (In->Index + Repeat > Total)
+            return INFLATE_BAD;
+        while (Repeat--)
+            In->Lengths[In->Index++] = Length;
+        if (In->Index == Total) {
+            if (In->Lengths[256] == 0)
+                return INFLATE_BAD;
+            Left = Inflate_Build(&In->Lencode, In->Lengths, In->Nlen);
+            if (!Inflate_Usable(&In->Lencode, Left, In->Nlen))
+                return INFLATE_BAD;
+            Left = Inflate_Build(&In->Distcode, In->Lengths + In->Nlen, In->Ndist);
+            if (!Inflate_Usable(&In->Distcode, Left, In->Ndist))
+                return INFLATE_BAD;
+            In->State = INFLATE_CODES;
+        }
+        break;
+    }
+    case INFLATE_CODES: {
+        Symbol = Inflate_Decode(&Hold, &Bits, &In->Lencode);
+        if (Symbol == -1)
+            return INFLATE_NEED;
+        if (Symbol < 0)
+            return INFLATE_BAD;
+        if (Symbol < 256) {
+            Inflate_Put(Dec, Symbol);
+            break;
+        }
+        if (Symbol == 256) {
+            In->State = In->Last ? INFLATE_CHECK : INFLATE_BLOCK;
+            break;
+        }
+        Symbol -= 257;
+        if (Symbol >= 29)
+            return INFLATE_BAD;
+        if (!Inflate_Take(&Hold, &Bits, Inflate_Length_Extra[Symbol], &Value))
+            return INFLATE_NEED;
+        UWORD Length = Inflate_Length_Base[Symbol] + Value;
+        Symbol = Inflate_Decode(&Hold, &Bits, &In->Distcode);
+        if (Symbol == -1)
+            return INFLATE_NEED;
+        if (Symbol < 0 || Symbol >= 30)
+            return INFLATE_BAD;
+        if (!Inflate_Take(&Hold, &Bits, Inflate_Dist_Extra[Symbol], &Value))
+            return INFLATE_NEED;
+        UDOUBLE Dist = Inflate_Dist_Base[Symbol] + Value;
+        if (Dist > In->Total || Dist > In->Window_Mask + 1)
+            return INFLATE_BAD;
+        while (Length--)
+            Inflate_Put(Dec, In->Window[(In->Total - Dist) & In->Window_Mask]);
+        break;
+    }
+    case INFLATE_CHECK:
+        //Adler-32 of the data, not verified
+        Hold >>= Bits & 7;
+        Bits -= Bits & 7;
+        if (!Inflate_Take(&Hold, &Bits, 32, &Value))
+            return INFLATE_NEED;
+        In->State = INFLATE_END;
+        break;
+    default:
+        return INFLATE_DONE;
+    }
+    In->Hold = Hold;
+    In->Bits = Bits;
+    return INFLATE_OK;
+}
+
+/******************************************************************************
+function: Inflate a run of IDAT bytes
+info:
+    The bit buffer is refilled to at least 57 bits whenever input is left,
+    more than any step needs, so a step only waits once the run is used up.
+******************************************************************************/
+static void PaintDecoder_Inflate(PAINT_DECODER *Dec, const UBYTE *Data, UDOUBLE Len)
+{
+    PAINT_INFLATE *In = &Dec->Inflate;
+    while (Dec->Status == DECODE_MORE) {
+        while (In->Bits <= 56 && Len) {
+            In->Hold |= (uint64_t)*Data++ << In->Bits;
+            In->Bits += 8;
+            Len--;
+        }
+        UBYTE Result = Inflate_Step(Dec);
+        if (Result == INFLATE_NEED && Len == 0)
+            return;
+        if (Result == INFLATE_DONE)
+            return;
+        if (Result == INFLATE_BAD || Result == INFLATE_NEED) {
+            PaintDecoder_Fail(Dec, "corrupt PNG data");
+            return;
+        }
+    }
+}
+
+/******************************************************************************
+function: Undo the PNG filter of the row in Dec->Row
+******************************************************************************/
+static UBYTE PaintDecoder_Unfilter(PAINT_DECODER *Dec)
+{
+    UBYTE *Cur = Dec->Row + 1;
+    const UBYTE *Up = Dec->Prev + 1;
+    UDOUBLE Len = Dec->Row_Bytes - 1;
+    UDOUBLE Bpp = (Dec->Depth * Dec->Channels + 7) / 8;
+    UDOUBLE i;
+
+    switch (Dec->Row[0]) {
+    case 0:
+        break;
+    case 1:
+        for (i = Bpp; i < Len; i++)
+            Cur[i] += Cur[i - Bpp];
+        break;
+    case 2:
+        for (i = 0; i < Len; i++)
+            Cur[i] += Up[i];
+        break;
+    case 3:
+        for (i = 0; i < Len; i++)
+            Cur[i] += ((i >= Bpp ? Cur[i - Bpp] : 0) + Up[i]) >> 1;
+        break;
+    case 4:
+        for (i = 0; i < Len; i++) {
+            int a = i >= Bpp ? Cur[i - Bpp] : 0, b = Up[i], c = i >= Bpp ? Up[i - Bpp] : 0;
+            int p = a + b - c;
+            int pa = p > a ? p - a : a - p, pb = p > b ? p - b : b - p, pc = p > c ? p - c : c - p;
+            Cur[i] += (pa <= pb && pa <= pc) ? a : (pb <= pc) ? b : c;
+        }
+        break;
+    default:
+        return PaintDecoder_Fail(Dec, "bad PNG filter");
+    }
+    return 1;
+}
+
+static void PaintDecoder_PngByte(PAINT_DECODER *Dec, UBYTE Byte)
+{
+    if (Dec->Status != DECODE_MORE)
+        return;
+    Dec->Row[Dec->Row_Pos++] = Byte;
+    if (Dec->Row_Pos < Dec->Row_Bytes)
+        return;
+    Dec->Row_Pos = 0;
+    if (!PaintDecoder_Unfilter(Dec))
+        return;
+    PaintDecoder_EmitRow(Dec, Dec->Row + 1);
+    UBYTE *Swap = Dec->Prev;
+    Dec->Prev = Dec->Row;
+    Dec->Row = Swap;
+}
+
+/******************************************************************************
+function: PNG
+info:
+    Chunks are walked one by one, Target counts the bytes left in the
+    current one. Only IHDR, PLTE and IDAT are read, IEND ends the image.
+******************************************************************************/
+static UDOUBLE PaintDecoder_Png(PAINT_DECODER *Dec, const UBYTE *Data, UDOUBLE Len)
+{
+    static const UBYTE Signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    UDOUBLE Used;
+
+    if (Dec->Target == 0 && Dec->State >= PNG_IHDR && Dec->State <= PNG_SKIP) {
+        Dec->State = PNG_CRC;
+        Dec->Target = 4;
+    }
+    if (Len > Dec->Target && Dec->State >= PNG_IHDR)
+        Len = Dec->Target;
+
+    switch (Dec->State) {
+    case PNG_SIGNATURE:
+    case PNG_CHUNK:
+        Used = PaintDecoder_Collect(Dec, Data, Len, 8);
+        if (Dec->Head_Len < 8)
+            return Used;
+        Dec->Head_Len = 0;
+        if (Dec->State == PNG_SIGNATURE) {
+            if (memcmp(Dec->Head, Signature, 8))
+                return PaintDecoder_Fail(Dec, "not a PNG image");
+            Dec->State = PNG_CHUNK;
+            return Used;
+        }
+        Dec->Target = PaintDecoder_Be32(Dec->Head);
+        if (!memcmp(Dec->Head + 4, "IHDR", 4)) {
+            if (Dec->Target != 13 || Dec->Width)
+                return PaintDecoder_Fail(Dec, "bad IHDR");
+            Dec->State = PNG_IHDR;
+        } else if (!Dec->Width) {
+            return PaintDecoder_Fail(Dec, "IHDR missing");
+        } else if (!memcmp(Dec->Head + 4, "PLTE", 4)) {
+            Dec->Value = 0;
+            Dec->State = PNG_PLTE;
+        } else if (!memcmp(Dec->Head + 4, "IDAT", 4)) {
+            Dec->State = PNG_IDAT;
+        } else if (!memcmp(Dec->Head + 4, "IEND", 4)) {
+            return PaintDecoder_Fail(Dec, "image data ends early");
+        } else {
+            Dec->State = PNG_SKIP;
+        }
+        return Used;
+    case PNG_IHDR: {
+        Used = PaintDecoder_Collect(Dec, Data, Len, 13);
+        Dec->Target -= Used;
+        if (Dec->Head_Len < 13)
+            return Used;
+        Dec->Head_Len = 0;
+        const UBYTE *Head = Dec->Head;
+        UDOUBLE Width = PaintDecoder_Be32(Head), Height = PaintDecoder_Be32(Head + 4);
+        UBYTE Depth = Head[8], Type = Head[9];
+        if (Width > 0xFFFF || Height > 0xFFFF)
+            return PaintDecoder_Fail(Dec, "image too large");
+        if (Head[10] || Head[11] || Head[12])
+            return PaintDecoder_Fail(Dec, "interlaced or unknown PNG method");
+        switch (Type) {
+        case DECODE_GRAY:       Dec->Channels = 1; break;
+        case DECODE_RGB:        Dec->Channels = 3; break;
+        case DECODE_INDEXED:    Dec->Channels = 1; break;
+        case DECODE_GRAY_ALPHA: Dec->Channels = 2; break;
+        case DECODE_RGB_ALPHA:  Dec->Channels = 4; break;
+        default:
+            return PaintDecoder_Fail(Dec, "bad PNG color type");
+        }
+        if ((Depth != 1 && Depth != 2 && Depth != 4 && Depth != 8 && Depth != 16) ||
+            (Type == DECODE_INDEXED && Depth == 16) || (Dec->Channels > 1 && Type != DECODE_INDEXED && Depth < 8))
+            return PaintDecoder_Fail(Dec, "bad PNG bit depth");
+        Dec->Width = Width;
+        Dec->Height = Height;
+        Dec->Depth = Depth;
+        Dec->Layout = Type;
+        PaintDecoder_Start(Dec, 1 + (Width * Depth * Dec->Channels + 7) / 8);
+        return Used;
+    }
+    case PNG_PLTE:
+        for (Used = 0; Used < Len; Used++, Dec->Value++) {
+            if (Dec->Value < 256 * 3)
+                Dec->Palette[Dec->Value / 3][Dec->Value % 3] = Data[Used];
+        }
+        Dec->Palette_Count = Dec->Value < 256 * 3 ? Dec->Value / 3 : 256;
+        Dec->Target -= Len;
+        return Len;
+    case PNG_IDAT:
+        PaintDecoder_Inflate(Dec, Data, Len);
+        Dec->Target -= Len;
+        return Len;
+    case PNG_SKIP:
+        Dec->Target -= Len;
+        return Len;
+    default:
+        Dec->Target -= Len;
+        if (Dec->Target == 0)
+            Dec->State = PNG_CHUNK;
+        return Len;
+    }
+}
+
+/******************************************************************************
+function: Feed the next bytes of the file
+parameter:
+    Data : Bytes, only read during the call
+    Len  : Number of bytes, any size
+return:
+    DECODE_MORE until the last row is drawn or an error is found
+******************************************************************************/
+DECODE_STATUS PaintDecoder_Feed(PAINT_DECODER *Dec, const UBYTE *Data, UDOUBLE Len)
+{
+    while (Len && Dec->Status == DECODE_MORE) {
+        UDOUBLE Used;
+        if (Dec->Format == DECODE_FORMAT_NONE) {
+            if (Data[0] == 'P')
+                Dec->Format = DECODE_FORMAT_PNM;
+            else if (Data[0] == 'B')
+                Dec->Format = DECODE_FORMAT_BMP;
+            else if (Data[0] == 0x89)
+                Dec->Format = DECODE_FORMAT_PNG;
+            else
+                PaintDecoder_Fail(Dec, "unknown image format");
+            continue;
+        }
+        if (Dec->Format == DECODE_FORMAT_PNM)
+            Used = PaintDecoder_Pnm(Dec, Data, Len);
+        else if (Dec->Format == DECODE_FORMAT_BMP)
+            Used = PaintDecoder_Bmp(Dec, Data, Len);
+        else
+            Used = PaintDecoder_Png(Dec, Data, Len);
+        Data += Used;
+        Len -= Used;
+        Dec->Offset += Used;
+    }
+    return (DECODE_STATUS)Dec->Status;
+}
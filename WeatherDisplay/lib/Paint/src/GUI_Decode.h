@@ -0,0 +1,110 @@
+/******************************************************************************
+* | File      	:   GUI_Decode.h
+* | Function    :   Decode PBM/PGM/PPM, BMP and PNG images chunk by chunk
+*                   straight into a paint context
+* | Info        :
+*   The encoded file is pushed in chunks of any size as it is read from
+*   flash, a file or the network; neither the file nor the decoded image
+*   is ever held in memory. Every row is drawn as soon as it is decoded:
+*   1-bit images are blitted, gray and colour images go through the
+*   dithering stage. All memory is a work area supplied by the caller.
+*
+*   PNG: every color type, bit depths 1 to 16, not interlaced. The zlib
+*   window is taken from the work area at the size the stream declares.
+*   CRCs and the Adler-32 checksum are not verified.
+*   BMP: uncompressed, 1, 4, 8, 24 and 32 bits per pixel.
+*   PNM: P4, P5 and P6 with a maximum value up to 255.
+******************************************************************************/
+#ifndef __GUI_DECODE_H
+#define __GUI_DECODE_H
+
+#include "GUI_Paint.h"
+#include "GUI_Dither.h"
+
+/**
+ * Decoder status
+**/
+typedef enum {
+    DECODE_MORE = 0,    //Waiting for more input
+    DECODE_DONE,        //Every row was drawn, further input is ignored
+    DECODE_ERROR,       //Unsupported or corrupt file, or work area too small
+} DECODE_STATUS;
+
+/**
+ * Work area large enough for any supported image Width pixels wide:
+ * 32 KB zlib window, two 16-bit RGBA rows, a colour row and the dithering
+ * rows. BMP, PNM and PNG with a smaller window need much less.
+**/
+#define DECODE_WORK_SIZE(Width) (32768 + 2 * (8 * (UDOUBLE)(Width) + 4) + 3 * (UDOUBLE)(Width) + \
+                                 DITHER_WORK_SIZE(Width) + 16)
+
+/**
+ * Canonical Huffman code, decoded a bit at a time
+**/
+typedef struct {
+    UWORD Count[16];    //Codes of each length
+    UWORD Symbol[288];  //Symbols ordered by code
+} PAINT_HUFFMAN;
+
+/**
+ * Resumable inflate state; every step either completes or waits for input
+**/
+typedef struct {
+    uint64_t Hold;      //Input bits not consumed yet
+    UBYTE Bits;
+    UBYTE State;
+    UBYTE Last;         //Current block is the final one
+    UWORD Index;        //Progress inside a dynamic block header
+    UWORD Nlen;
+    UWORD Ndist;
+    UWORD Ncode;
+    UWORD Stored;       //Bytes left in a stored block
+    UBYTE Lengths[320];
+    PAINT_HUFFMAN Lencode;
+    PAINT_HUFFMAN Distcode;
+    UBYTE *Window;
+    UDOUBLE Window_Mask;
+    UDOUBLE Total;      //Bytes written so far
+} PAINT_INFLATE;
+
+typedef struct {
+    PaintContext *Ctx;
+    UWORD Xstart;
+    UWORD Ystart;
+    UWORD Width;        //Known once the header is read
+    UWORD Height;
+    UBYTE Status;
+    UBYTE Format;
+    UBYTE State;
+    UBYTE Method;       //DITHER_METHOD of gray and colour images
+    UBYTE Output;       //Rows drawn as bits, gray or RGB
+    UBYTE Depth;        //Bits per sample, or per pixel for BMP
+    UBYTE Channels;
+    UBYTE Layout;       //Pixel layout, numbered as PNG color types
+    UBYTE Bottom_Up;
+    UDOUBLE Offset;     //Bytes of the file consumed
+    UDOUBLE Target;     //Offset where the current field ends
+    UDOUBLE Value;
+    UWORD Field;        //Header token or palette entry being read
+    UBYTE Head[64];     //Header bytes being collected
+    UBYTE Head_Len;
+    UBYTE Palette[256][3];
+    UWORD Palette_Count;
+    UBYTE *Work;
+    UDOUBLE Work_Size;
+    UDOUBLE Work_Used;
+    UBYTE *Row;         //Encoded row, with the filter byte for PNG
+    UBYTE *Prev;        //Previous PNG row
+    UDOUBLE Row_Bytes;
+    UDOUBLE Row_Pos;
+    UWORD Rows;         //Rows drawn
+    UBYTE *Pixels;      //Converted row
+    PAINT_DITHER Dither;
+    PAINT_INFLATE Inflate;
+} PAINT_DECODER;
+
+void PaintDecoder_Init(PAINT_DECODER *Dec, PaintContext *Ctx, UWORD Xstart, UWORD Ystart,
+                       DITHER_METHOD Method, void *Work, UDOUBLE Work_Size);
+DECODE_STATUS PaintDecoder_Feed(PAINT_DECODER *Dec, const UBYTE *Data, UDOUBLE Len);
+
+#endif
@@ -0,0 +1,173 @@
+/******************************************************************************
+* | File      	:   GUI_Dither.cpp
+* | Function    :   Dither grayscale or colour images into a paint context,
+*                   one source row at a time
+* | Info        :
+*   Error terms are kept in fixed point, in 1/16 of a gray level, so the
+*   Floyd-Steinberg weights 7, 3, 5 and 1 are plain integer multiplies.
+*   Every dithered row goes to the context as a one row image, which the
+*   blitter merges a byte at a time; red runs are filled over it.
+******************************************************************************/
+#include "GUI_Dither.h"
+#include <string.h>
+
+static const UBYTE Bayer8[8][8] = {
+    { 0, 32,  8, 40,  2, 34, 10, 42},
+    {48, 16, 56, 24, 50, 18, 58, 26},
+    {12, 44,  4, 36, 14, 46,  6, 38},
+    {60, 28, 52, 20, 62, 30, 54, 22},
+    { 3, 35, 11, 43,  1, 33,  9, 41},
+    {51, 19, 59, 27, 49, 17, 57, 25},
+    {15, 47,  7, 39, 13, 45,  5, 37},
+    {63, 31, 55, 23, 61, 29, 53, 21},
+};
+
+/******************************************************************************
+function: Start dithering an image into a context
+parameter:
+    Dither : Dithering state
+    Ctx    : Target context
+    Xstart : X starting coordinates of the image
+    Ystart : Y starting coordinates of the image
+    Width  : Image width
+    Height : Image height, later rows are ignored
+    Method : DITHER_BAYER or DITHER_FLOYD_STEINBERG
+    Work   : DITHER_WORK_SIZE(Width) bytes, 2-byte aligned
+******************************************************************************/
+void PaintDither_Init(PAINT_DITHER *Dither, PaintContext *Ctx, UWORD Xstart, UWORD Ystart,
+                      UWORD Width, UWORD Height, DITHER_METHOD Method, void *Work)
+{
+    Dither->Ctx = Ctx;
+    Dither->Xstart = Xstart;
+    Dither->Ystart = Ystart;
+    Dither->Width = Width;
+    Dither->Height = Height;
+    Dither->Row = 0;
+    Dither->Method = Method;
+    Dither->Red_Min = DITHER_RED_MIN;
+    Dither->Red_Delta = DITHER_RED_DELTA;
+    Dither->Bottom_Up = 0;
+    Dither->Error = (int16_t *)Work;
+    Dither->Error_Next = Dither->Error + Width + 2;
+    Dither->Bits = (UBYTE *)(Dither->Error_Next + Width + 2);
+    memset(Dither->Error, 0, (Width + 2) * sizeof(int16_t));
+}
+
+/******************************************************************************
+function: Set which colour pixels are drawn RED
+parameter:
+    Red_Min   : Lowest red component of a red pixel
+    Red_Delta : Lowest margin of red over green and blue
+info:
+    Only used with a tri-colour context, others dither every pixel.
+******************************************************************************/
+void PaintDither_SetRed(PAINT_DITHER *Dither, UBYTE Red_Min, UBYTE Red_Delta)
+{
+    Dither->Red_Min = Red_Min;
+    Dither->Red_Delta = Red_Delta;
+}
+
+/******************************************************************************
+function: Set the order in which rows arrive
+parameter:
+    Bottom_Up : 1 if the first row is the bottom one, as in most BMP files
+******************************************************************************/
+void PaintDither_SetBottomUp(PAINT_DITHER *Dither, UBYTE Bottom_Up)
+{
+    Dither->Bottom_Up = Bottom_Up;
+}
+
+static UBYTE PaintDither_IsRed(const PAINT_DITHER *Dither, const UBYTE *Pixel)
+{
+    UBYTE Max = Pixel[1] > Pixel[2] ? Pixel[1] : Pixel[2];
+    return Pixel[0] >= Dither->Red_Min && Pixel[0] - Max >= Dither->Red_Delta;
+}
+
+/******************************************************************************
+function: Dither one source row and draw it
+parameter:
+    Src      : Width pixels of Channels bytes
+    Channels : 1 for gray, 3 for R, G, B
+******************************************************************************/
+static UBYTE PaintDither_Row(PAINT_DITHER *Dither, const UBYTE *Src, UBYTE Channels)
+{
+    if (Dither->Row >= Dither->Height)
+        return 0;
+
+    UWORD Width = Dither->Width;
+    UBYTE Red = Channels == 3 && Dither->Ctx->TriColor;
+    UBYTE *Bits = Dither->Bits;
+    memset(Bits, 0xFF, (Width + 7) / 8);
+
+    if (Dither->Method == DITHER_BAYER) {
+        const UBYTE *Threshold = Bayer8[Dither->Row & 7];
+        for (UWORD x = 0; x < Width; x++) {
+            const UBYTE *Pixel = Src + x * Channels;
+            if (Red && PaintDither_IsRed(Dither, Pixel))
+                continue;
+            UBYTE Gray = Channels == 3 ? (77 * Pixel[0] + 150 * Pixel[1] + 29 * Pixel[2]) >> 8 : Pixel[0];
+            if (Gray <= Threshold[x & 7] * 4 + 1)
+                Bits[x / 8] &= ~(0x80 >> (x % 8));
+        }
+    } else {
+        //Serpentine: odd rows run right to left, the weights follow
+        int Step = (Dither->Row & 1) ? -1 : 1;
+        int16_t *Error = Dither->Error + 1;
+        int16_t *Next = Dither->Error_Next + 1;
+        memset(Dither->Error_Next, 0, (Width + 2) * sizeof(int16_t));
+        for (UWORD i = 0; i < Width; i++) {
+            int x = Step > 0 ? i : Width - 1 - i;
+            const UBYTE *Pixel = Src + x * Channels;
+            //Red pixels are drawn as they are and pass no error on
+            if (Red && PaintDither_IsRed(Dither, Pixel))
+                continue;
+            int Gray = Channels == 3 ? (77 * Pixel[0] + 150 * Pixel[1] + 29 * Pixel[2]) >> 8 : Pixel[0];
+            int Value = Gray + ((Error[x] + 8) >> 4);
+            int Diff = Value;
+            if (Value < 128)
+                Bits[x / 8] &= ~(0x80 >> (x % 8));
+            else
+                Diff -= 255;
+            Error[x + Step] += Diff * 7;
+            Next[x - Step] += Diff * 3;
+            Next[x] += Diff * 5;
+            Next[x + Step] += Diff;
+        }
+        Dither->Error_Next = Dither->Error;
+        Dither->Error = Next - 1;
+    }
+
+    UWORD Y = Dither->Bottom_Up ? Dither->Ystart + Dither->Height - 1 - Dither->Row : Dither->Ystart + Dither->Row;
+    Dither->Row++;
+    PaintCtx_DrawImage(Dither->Ctx, Bits, Dither->Xstart, Y, Width, 1);
+    if (Red) {
+        for (UWORD x = 0; x < Width; x++) {
+            if (!PaintDither_IsRed(Dither, Src + x * 3))
+                continue;
+            UWORD Run = x + 1;
+            while (Run < Width && PaintDither_IsRed(Dither, Src + Run * 3))
+                Run++;
+            PaintCtx_ClearWindows(Dither->Ctx, Dither->Xstart + x, Y, Dither->Xstart + Run, Y + 1, RED);
+            x = Run;
+        }
+    }
+    return 1;
+}
+
+/******************************************************************************
+function: Dither the next row of the image
+parameter:
+    Gray : Width gray levels, 0 = black
+    Rgb  : Width pixels of R, G, B
+return:
+    0 once all Height rows were drawn, the row is then ignored
+******************************************************************************/
+UBYTE PaintDither_Gray(PAINT_DITHER *Dither, const UBYTE *Gray)
+{
+    return PaintDither_Row(Dither, Gray, 1);
+}
+
+UBYTE PaintDither_RGB(PAINT_DITHER *Dither, const UBYTE *Rgb)
+{
+    return PaintDither_Row(Dither, Rgb, 3);
+}
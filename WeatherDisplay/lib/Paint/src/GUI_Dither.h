@@ -0,0 +1,61 @@
+/******************************************************************************
+* | File      	:   GUI_Dither.h
+* | Function    :   Dither grayscale or colour images into a paint context,
+*                   one source row at a time
+* | Info        :
+*   The source is never held in memory: every row is dithered as it is
+*   decoded or received and drawn straight into the planes of the context,
+*   at any position, clipped, rotated and mirrored like any other image.
+*   Error diffusion keeps two rows of error terms, ordered dithering none;
+*   the work area is supplied by the caller.
+*
+*   Colour rows can also be dithered for a tri-colour panel: saturated
+*   red pixels are drawn RED, every other pixel is dithered on its
+*   luminance.
+******************************************************************************/
+#ifndef __GUI_DITHER_H
+#define __GUI_DITHER_H
+
+#include "GUI_Paint.h"
+
+/**
+ * Dithering method
+**/
+typedef enum {
+    DITHER_BAYER = 0,       //Ordered, 8x8 Bayer matrix
+    DITHER_FLOYD_STEINBERG, //Error diffusion, serpentine
+} DITHER_METHOD;
+
+#define DITHER_RED_MIN      128 //Default red threshold, see PaintDither_SetRed
+#define DITHER_RED_DELTA    64
+
+/**
+ * Bytes of work area for images Width pixels wide:
+ * two rows of error terms and one row of output bits
+**/
+#define DITHER_WORK_SIZE(Width) (2 * ((Width) + 2) * sizeof(int16_t) + ((Width) + 7) / 8)
+
+typedef struct {
+    PaintContext *Ctx;
+    UWORD Xstart;
+    UWORD Ystart;
+    UWORD Width;
+    UWORD Height;
+    UWORD Row;          //Next source row
+    UBYTE Method;
+    UBYTE Red_Min;      //A colour pixel is red if R >= Red_Min
+    UBYTE Red_Delta;    //and R - max(G, B) >= Red_Delta
+    UBYTE Bottom_Up;    //Rows arrive from the bottom of the image up
+    int16_t *Error;     //Error terms of the current row, in 1/16
+    int16_t *Error_Next;//Error terms of the next row
+    UBYTE *Bits;        //Output row, bit 1 = white
+} PAINT_DITHER;
+
+void PaintDither_Init(PAINT_DITHER *Dither, PaintContext *Ctx, UWORD Xstart, UWORD Ystart,
+                      UWORD Width, UWORD Height, DITHER_METHOD Method, void *Work);
+void PaintDither_SetRed(PAINT_DITHER *Dither, UBYTE Red_Min, UBYTE Red_Delta);
+void PaintDither_SetBottomUp(PAINT_DITHER *Dither, UBYTE Bottom_Up);
+UBYTE PaintDither_Gray(PAINT_DITHER *Dither, const UBYTE *Gray);
+UBYTE PaintDither_RGB(PAINT_DITHER *Dither, const UBYTE *Rgb);
+
+#endif
@@ -0,0 +1,210 @@
+/******************************************************************************
+* | File      	:   GUI_Format.cpp
+* | Function    :   Format numbers and weather units into caller buffers
+* | Info        :
+*   Digits are produced two at a time from a table, so a value costs one
+*   division by 100 per digit pair; they are written backwards into a
+*   small local array and then copied in order.
+******************************************************************************/
+#include "GUI_Format.h"
+#include <string.h>
+
+static const char Format_Pairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const UDOUBLE Format_Pow10[10] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+
+static const char * const Format_Units[] = {
+    "",
+    FONT_DEGREE "F",
+    FONT_DEGREE "C",
+    FONT_DEGREE,
+    "%",
+    " mb",
+    " hPa",
+    " inHg",
+    " mph",
+    " km/h",
+    " m/s",
+    " kn",
+};
+
+/******************************************************************************
+function: Start formatting into a buffer
+parameter:
+    Fmt  : Formatter state
+    Buf  : Output, always left terminated
+    Size : Bytes in Buf, at least 1
+******************************************************************************/
+void PaintFormat_Init(PAINT_FORMAT *Fmt, char *Buf, UWORD Size)
+{
+    Fmt->Buf = Buf;
+    Fmt->Size = Size;
+    Fmt->Len = 0;
+    Fmt->Overflow = 0;
+    Buf[0] = '\0';
+}
+
+static void PaintFormat_Append(PAINT_FORMAT *Fmt, const char *Src, UWORD Len)
+{
+    UWORD Room = Fmt->Size - 1 - Fmt->Len;
+    if (Len > Room) {
+        //Cut at a UTF-8 character boundary
+        Len = Room;
+        while (Len > 0 && ((UBYTE)Src[Len] & 0xC0) == 0x80)
+            Len--;
+        Fmt->Overflow = 1;
+    }
+    memcpy(Fmt->Buf + Fmt->Len, Src, Len);
+    Fmt->Len += Len;
+    Fmt->Buf[Fmt->Len] = '\0';
+}
+
+void PaintFormat_Char(PAINT_FORMAT *Fmt, char Char)
+{
+    PaintFormat_Append(Fmt, &Char, 1);
+}
+
+void PaintFormat_Str(PAINT_FORMAT *Fmt, const char *pString)
+{
+    PaintFormat_Append(Fmt, pString, strlen(pString));
+}
+
+/******************************************************************************
+function: Write Value in decimal, right-aligned to the end of Out
+parameter:
+    Out    : End of a buffer of at least 10 bytes
+    Digits : Least number of digits, zero padded
+return:
+    Number of characters written before Out
+******************************************************************************/
+static UBYTE PaintFormat_Decimal(char *Out, UDOUBLE Value, UBYTE Digits)
+{
+    char *p = Out;
+    while (Value >= 100) {
+        const char *Pair = Format_Pairs + (Value % 100) * 2;
+        Value /= 100;
+        *--p = Pair[1];
+        *--p = Pair[0];
+    }
+    if (Value >= 10) {
+        *--p = Format_Pairs[Value * 2 + 1];
+        *--p = Format_Pairs[Value * 2];
+    } else {
+        *--p = '0' + Value;
+    }
+    while (Out - p < Digits)
+        *--p = '0';
+    return Out - p;
+}
+
+/******************************************************************************
+function: Append a signed integer
+******************************************************************************/
+void PaintFormat_Int(PAINT_FORMAT *Fmt, int32_t Value)
+{
+    char Str[FORMAT_INT_LEN];
+    char *End = Str + sizeof(Str);
+    //The magnitude of INT32_MIN only fits unsigned
+    UDOUBLE Magnitude = Value < 0 ? 0 - (UDOUBLE)Value : (UDOUBLE)Value;
+    UBYTE Len = PaintFormat_Decimal(End, Magnitude, 1);
+    if (Value < 0)
+        End[-++Len] = '-';
+    PaintFormat_Append(Fmt, End - Len, Len);
+}
+
+/******************************************************************************
+function: Append an unsigned value zero padded to at least Digits digits
+info:
+    For clock and date fields, e.g. 7 with 2 digits is "07".
+******************************************************************************/
+void PaintFormat_Digits(PAINT_FORMAT *Fmt, UDOUBLE Value, UBYTE Digits)
+{
+    char Str[FORMAT_INT_LEN];
+    if (Digits > 10)
+        Digits = 10;
+    UBYTE Len = PaintFormat_Decimal(Str + sizeof(Str), Value, Digits);
+    PaintFormat_Append(Fmt, Str + sizeof(Str) - Len, Len);
+}
+
+/******************************************************************************
+function: Append a fixed-point value
+parameter:
+    Value    : Value times 10^Decimals, e.g. 2992 for 29.92 with 2 decimals
+    Decimals : Decimal digits held in Value, up to 9
+    Shown    : Decimal digits written, rounded half away from zero
+info:
+    A value that rounds to zero is written without a sign.
+******************************************************************************/
+void PaintFormat_Fixed(PAINT_FORMAT *Fmt, int32_t Value, UBYTE Decimals, UBYTE Shown)
+{
+    char Str[2 * FORMAT_INT_LEN];
+    char *End = Str + sizeof(Str);
+    UDOUBLE Magnitude = Value < 0 ? 0 - (UDOUBLE)Value : (UDOUBLE)Value;
+    UBYTE Len = 0, Pad = 0;
+
+    if (Decimals > 9)
+        Decimals = 9;
+    if (Shown > 9)
+        Shown = 9;
+    if (Shown < Decimals) {
+        UDOUBLE Divisor = Format_Pow10[Decimals - Shown];
+        Magnitude = Magnitude / Divisor + (Magnitude % Divisor >= (Divisor + 1) / 2);
+    } else {
+        //Digits beyond the ones held are zeros
+        Pad = Shown - Decimals;
+        Shown = Decimals;
+    }
+
+    while (Pad--)
+        End[-++Len] = '0';
+    if (Shown) {
+        Len += PaintFormat_Decimal(End - Len, Magnitude % Format_Pow10[Shown], Shown);
+        End[-++Len] = '.';
+        Magnitude /= Format_Pow10[Shown];
+    } else if (Len) {
+        End[-++Len] = '.';
+    }
+    Len += PaintFormat_Decimal(End - Len, Magnitude, 1);
+
+    //No "-0" or "-0.0"
+    if (Value < 0) {
+        for (char *p = End - Len; p < End; p++) {
+            if (*p >= '1' && *p <= '9') {
+                End[-++Len] = '-';
+                break;
+            }
+        }
+    }
+    PaintFormat_Append(Fmt, End - Len, Len);
+}
+
+/******************************************************************************
+function: Append a unit
+info:
+    The degree sign is FONT_DEGREE.
+******************************************************************************/
+void PaintFormat_Unit(PAINT_FORMAT *Fmt, FORMAT_UNIT Unit)
+{
+    if ((UWORD)Unit < sizeof(Format_Units) / sizeof(Format_Units[0]))
+        PaintFormat_Str(Fmt, Format_Units[Unit]);
+}
+
+/******************************************************************************
+function: Append a fixed-point value and its unit, e.g. "-3.5°F" or "29.92 inHg"
+******************************************************************************/
+void PaintFormat_Value(PAINT_FORMAT *Fmt, int32_t Value, UBYTE Decimals, UBYTE Shown, FORMAT_UNIT Unit)
+{
+    PaintFormat_Fixed(Fmt, Value, Decimals, Shown);
+    PaintFormat_Unit(Fmt, Unit);
+}
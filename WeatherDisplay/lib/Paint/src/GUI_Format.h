@@ -0,0 +1,59 @@
+/******************************************************************************
+* | File      	:   GUI_Format.h
+* | Function    :   Format numbers and weather units into caller buffers
+* | Info        :
+*   A small replacement for sprintf on the drawing path: integers,
+*   fixed-point values and units are appended to a buffer supplied by the
+*   caller, which is always left terminated. Nothing is allocated and no
+*   printf machinery is linked in.
+*
+*   Fixed-point values carry their scale, e.g. 215 with 1 decimal is 21.5,
+*   and are rounded half away from zero to the digits shown.
+*   Output that does not fit is cut off and flagged in Overflow.
+******************************************************************************/
+#ifndef __GUI_FORMAT_H
+#define __GUI_FORMAT_H
+
+#include "DEV_Config.h"
+#include "fonts.h"
+
+/**
+ * Unit appended after a value
+**/
+typedef enum {
+    UNIT_NONE = 0,
+    UNIT_FAHRENHEIT,    //"°F"
+    UNIT_CELSIUS,       //"°C"
+    UNIT_DEGREE,        //"°", wind direction
+    UNIT_PERCENT,       //"%"
+    UNIT_MBAR,          //" mb"
+    UNIT_HPA,           //" hPa"
+    UNIT_INHG,          //" inHg"
+    UNIT_MPH,           //" mph"
+    UNIT_KMH,           //" km/h"
+    UNIT_MPS,           //" m/s"
+    UNIT_KNOT,          //" kn"
+} FORMAT_UNIT;
+
+/**
+ * Longest int32_t with its sign, e.g. for a stack buffer
+**/
+#define FORMAT_INT_LEN  12
+
+typedef struct {
+    char *Buf;
+    UWORD Size;         //Bytes in Buf, including the terminator
+    UWORD Len;          //Characters written so far
+    UBYTE Overflow;     //Something was cut off
+} PAINT_FORMAT;
+
+void PaintFormat_Init(PAINT_FORMAT *Fmt, char *Buf, UWORD Size);
+void PaintFormat_Char(PAINT_FORMAT *Fmt, char Char);
+void PaintFormat_Str(PAINT_FORMAT *Fmt, const char *pString);
+void PaintFormat_Int(PAINT_FORMAT *Fmt, int32_t Value);
+void PaintFormat_Digits(PAINT_FORMAT *Fmt, UDOUBLE Value, UBYTE Digits);
+void PaintFormat_Fixed(PAINT_FORMAT *Fmt, int32_t Value, UBYTE Decimals, UBYTE Shown);
+void PaintFormat_Unit(PAINT_FORMAT *Fmt, FORMAT_UNIT Unit);
+void PaintFormat_Value(PAINT_FORMAT *Fmt, int32_t Value, UBYTE Decimals, UBYTE Shown, FORMAT_UNIT Unit);
+
+#endif
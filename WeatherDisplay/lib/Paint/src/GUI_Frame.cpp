@@ -0,0 +1,813 @@
+/******************************************************************************
+* | File      	:   GUI_Frame.cpp
+* | Function    :   Record drawing operations into a frame and replay them
+*                   into a paint context, in one pass or band by band on
+*                   both cores
+* | Info        :
+*   Banded rendering gives every worker its own copy of the paint context
+*   clipped to a band of memory rows. Bands never share a byte of the
+*   image, so the workers need no locking; the caller only waits for all
+*   of them before the image is sent to the panel.
+******************************************************************************/
+#include "GUI_Frame.h"
+#include "Debug.h"
+#include <string.h>
+
+#if defined(ESP32)
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#define PAINT_BAND_STACK  4096
+#else
+#include <thread>
+#include <system_error>
+#endif
+
+/******************************************************************************
+function: Attach storage to a frame and empty it
+parameter:
+    Frame    : Frame to initialize
+    Ops      : Operation storage
+    Capacity : Number of operations in Ops
+******************************************************************************/
+void PaintFrame_Init(PAINT_FRAME *Frame, PAINT_OP *Ops, UWORD Capacity)
+{
+    Frame->Ops = Ops;
+    Frame->Capacity = Capacity;
+    PaintFrame_Reset(Frame);
+}
+
+void PaintFrame_Reset(PAINT_FRAME *Frame)
+{
+    Frame->Count = 0;
+    Frame->Dirty.Xstart = Frame->Dirty.Xend = 0;
+    Frame->Dirty.Ystart = Frame->Dirty.Yend = 0;
+}
+
+/******************************************************************************
+function: Compute the pixels an operation may touch
+parameter:
+    Op     : Operation with its parameters filled in
+    Bounds : Box in logical coordinates, the end coordinates are not included
+info:
+    The boxes are conservative, a primitive never draws outside of its box.
+    Strings are measured on one line, as the layout draws them.
+******************************************************************************/
+static void PaintFrame_Bounds(const PAINT_OP *Op, PAINT_RECT *Bounds)
+{
+    int Xmin = 0, Ymin = 0, Xmax = 0xFFFF, Ymax = 0xFFFF;
+    int Pen = Op->Width;
+
+    switch (Op->Type) {
+    case PAINT_OP_CLEAR:
+        break;
+    case PAINT_OP_CLEAR_WINDOWS:
+        Xmin = Op->Xstart;
+        Ymin = Op->Ystart;
+        Xmax = Op->Xend;
+        Ymax = Op->Yend;
+        break;
+    case PAINT_OP_POINT:
+        Xmin = Op->Xstart - Pen;
+        Ymin = Op->Ystart - Pen;
+        Xmax = Op->Xstart + Pen;
+        Ymax = Op->Ystart + Pen;
+        break;
+    case PAINT_OP_LINE:
+    case PAINT_OP_RECTANGLE:
+        Xmin = (Op->Xstart < Op->Xend ? Op->Xstart : Op->Xend) - Pen;
+        Ymin = (Op->Ystart < Op->Yend ? Op->Ystart : Op->Yend) - Pen;
+        Xmax = (Op->Xstart > Op->Xend ? Op->Xstart : Op->Xend) + Pen;
+        Ymax = (Op->Ystart > Op->Yend ? Op->Ystart : Op->Yend) + Pen;
+        break;
+    case PAINT_OP_CIRCLE:
+        Pen += Op->Xend;
+        Xmin = Op->Xstart - Pen;
+        Ymin = Op->Ystart - Pen;
+        Xmax = Op->Xstart + Pen + 1;
+        Ymax = Op->Ystart + Pen + 1;
+        break;
+    case PAINT_OP_STAR:
+        Xmin = Op->Xstart - Op->Xend - 1;
+        Ymin = Op->Ystart - Op->Xend - 1;
+        Xmax = Op->Xstart + Op->Xend + 1;
+        Ymax = Op->Ystart + Op->Xend + 1;
+        break;
+    case PAINT_OP_POLYGON: {
+        const PAINT_POINT *Points = (const PAINT_POINT *)Op->Data;
+        Xmin = Ymin = 0xFFFF;
+        Xmax = Ymax = 0;
+        for (UWORD i = 0; i < Op->Width; i++) {
+            if (Points[i].X < Xmin) Xmin = Points[i].X;
+            if (Points[i].Y < Ymin) Ymin = Points[i].Y;
+            if (Points[i].X + 1 > Xmax) Xmax = Points[i].X + 1;
+            if (Points[i].Y + 1 > Ymax) Ymax = Points[i].Y + 1;
+        }
+        break;
+    }
+    case PAINT_OP_STRING: {
+        const sFONT *Font = (const sFONT *)Op->Data;
+        int Factor = Op->Width ? Op->Width : 1;
+        PAINT_GLYPH_POS Glyphs[PAINT_OP_TEXT_LEN];
+        PAINT_LAYOUT Layout;
+        PaintLayout_Init(&Layout, Glyphs, PAINT_OP_TEXT_LEN);
+        Xmin = Op->Xstart;
+        Ymin = Op->Ystart;
+        Xmax = Op->Xstart + PaintLayout_String(&Layout, Op->Text, (sFONT *)Font, Op->Style) * Factor;
+        Ymax = Op->Ystart + Font->Height * Factor;
+        break;
+    }
+    case PAINT_OP_TEXT_BOX:
+        Xmin = Op->Xstart;
+        Ymin = Op->Ystart;
+        Xmax = Op->Xend;
+        Ymax = Op->Yend;
+        break;
+    case PAINT_OP_IMAGE:
+        Xmin = Op->Xstart;
+        Ymin = Op->Ystart;
+        Xmax = Op->Xstart + Op->Xend;
+        Ymax = Op->Ystart + Op->Yend;
+        break;
+    default:
+        break;
+    }
+
+    Bounds->Xstart = Xmin < 0 ? 0 : Xmin;
+    Bounds->Ystart = Ymin < 0 ? 0 : Ymin;
+    Bounds->Xend = Xmax > 0xFFFF ? 0xFFFF : (Xmax < Bounds->Xstart ? Bounds->Xstart : Xmax);
+    Bounds->Yend = Ymax > 0xFFFF ? 0xFFFF : (Ymax < Bounds->Ystart ? Bounds->Ystart : Ymax);
+}
+
+static UBYTE PaintFrame_RectEmpty(const PAINT_RECT *Rect)
+{
+    return Rect->Xstart >= Rect->Xend || Rect->Ystart >= Rect->Yend;
+}
+
+static UBYTE PaintFrame_RectOverlap(const PAINT_RECT *A, const PAINT_RECT *B)
+{
+    return A->Xstart < B->Xend && B->Xstart < A->Xend &&
+           A->Ystart < B->Yend && B->Ystart < A->Yend;
+}
+
+/******************************************************************************
+function: Add a region to the part of the frame to redraw
+parameter:
+    Frame : Frame to update
+    Rect  : Region in logical coordinates, the end coordinates are not included
+******************************************************************************/
+void PaintFrame_Invalidate(PAINT_FRAME *Frame, const PAINT_RECT *Rect)
+{
+    PAINT_RECT *Dirty = &Frame->Dirty;
+    if (PaintFrame_RectEmpty(Rect))
+        return;
+    if (PaintFrame_RectEmpty(Dirty)) {
+        *Dirty = *Rect;
+        return;
+    }
+    if (Rect->Xstart < Dirty->Xstart) Dirty->Xstart = Rect->Xstart;
+    if (Rect->Ystart < Dirty->Ystart) Dirty->Ystart = Rect->Ystart;
+    if (Rect->Xend > Dirty->Xend) Dirty->Xend = Rect->Xend;
+    if (Rect->Yend > Dirty->Yend) Dirty->Yend = Rect->Yend;
+}
+
+//Finish a recorded operation. Recording marks nothing dirty, the frame
+//is expected to be rendered once in full before it is updated.
+static UWORD PaintFrame_Commit(PAINT_FRAME *Frame, UWORD Index)
+{
+    if (Index != PAINT_OP_NONE)
+        PaintFrame_Bounds(&Frame->Ops[Index], &Frame->Ops[Index].Bounds);
+    return Index;
+}
+
+//Copy a string into an operation, zero padded; text that does not fit is
+//cut at a UTF-8 character boundary
+static void PaintFrame_CopyText(char *Text, const char *pString)
+{
+    UWORD Len = strnlen(pString, PAINT_OP_TEXT_LEN - 1);
+    while (Len > 0 && pString[Len] != '\0' && ((UBYTE)pString[Len] & 0xC0) == 0x80)
+        Len--;
+    memcpy(Text, pString, Len);
+    memset(Text + Len, 0, PAINT_OP_TEXT_LEN - Len);
+}
+
+/******************************************************************************
+function: Append an empty operation
+return:
+    Index of the operation, PAINT_OP_NONE when the frame is full
+******************************************************************************/
+static UWORD PaintFrame_Append(PAINT_FRAME *Frame, PAINT_OP_TYPE Type, PAINT_OP **Op)
+{
+    if (Frame->Count >= Frame->Capacity) {
+        Debug("PaintFrame is full\r\n");
+        return PAINT_OP_NONE;
+    }
+    *Op = &Frame->Ops[Frame->Count];
+    memset(*Op, 0, sizeof(PAINT_OP));
+    (*Op)->Type = Type;
+    return Frame->Count++;
+}
+
+UWORD PaintFrame_Clear(PAINT_FRAME *Frame, UWORD Color)
+{
+    PAINT_OP *Op;
+    UWORD Index = PaintFrame_Append(Frame, PAINT_OP_CLEAR, &Op);
+    if (Index != PAINT_OP_NONE)
+        Op->Color = Color;
+    return PaintFrame_Commit(Frame, Index);
+}
+
+UWORD PaintFrame_ClearWindows(PAINT_FRAME *Frame, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+{
+    PAINT_OP *Op;
+    UWORD Index = PaintFrame_Append(Frame, PAINT_OP_CLEAR_WINDOWS, &Op);
+    if (Index != PAINT_OP_NONE) {
+        Op->Xstart = Xstart;
+        Op->Ystart = Ystart;
+        Op->Xend = Xend;
+        Op->Yend = Yend;
+        Op->Color = Color;
+    }
+    return PaintFrame_Commit(Frame, Index);
+}
+
+UWORD PaintFrame_DrawPoint(PAINT_FRAME *Frame, UWORD Xpoint, UWORD Ypoint, UWORD Color,
+                           DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
+{
+    PAINT_OP *Op;
+    UWORD Index = PaintFrame_Append(Frame, PAINT_OP_POINT, &Op);
+    if (Index != PAINT_OP_NONE) {
+        Op->Xstart = Xpoint;
+        Op->Ystart = Ypoint;
+        Op->Color = Color;
+        Op->Width = Dot_Pixel;
+        Op->Style = Dot_Style;
+    }
+    return PaintFrame_Commit(Frame, Index);
+}
+
+UWORD PaintFrame_DrawLine(PAINT_FRAME *Frame, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                          UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
+{
+    PAINT_OP *Op;
+    UWORD Index = PaintFrame_Append(Frame, PAINT_OP_LINE, &Op);
+    if (Index != PAINT_OP_NONE) {
+        Op->Xstart = Xstart;
+        Op->Ystart = Ystart;
+        Op->Xend = Xend;
+        Op->Yend = Yend;
+        Op->Color = Color;
+        Op->Width = Line_width;
+        Op->Style = Line_Style;
+    }
+    return PaintFrame_Commit(Frame, Index);
+}
+
+UWORD PaintFrame_DrawRectangle(PAINT_FRAME *Frame, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                               UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    PAINT_OP *Op;
+    UWORD Index = PaintFrame_Append(Frame, PAINT_OP_RECTANGLE, &Op);
+    if (Index != PAINT_OP_NONE) {
+        Op->Xstart = Xstart;
+        Op->Ystart = Ystart;
+        Op->Xend = Xend;
+        Op->Yend = Yend;
+        Op->Color = Color;
+        Op->Width = Line_width;
+        Op->Style = Draw_Fill;
+    }
+    return PaintFrame_Commit(Frame, Index);
+}
+
+UWORD PaintFrame_DrawCircle(PAINT_FRAME *Frame, UWORD X_Center, UWORD Y_Center, UWORD Radius,
+                            UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    PAINT_OP *Op;
+    UWORD Index = PaintFrame_Append(Frame, PAINT_OP_CIRCLE, &Op);
+    if (Index != PAINT_OP_NONE) {
+        Op->Xstart = X_Center;
+        Op->Ystart = Y_Center;
+        Op->Xend = Radius;
+        Op->Color = Color;
+        Op->Width = Line_width;
+        Op->Style = Draw_Fill;
+    }
+    return PaintFrame_Commit(Frame, Index);
+}
+
+UWORD PaintFrame_DrawStar(PAINT_FRAME *Frame, UWORD X_Center, UWORD Y_Center, UWORD Size, UWORD Color)
+{
+    PAINT_OP *Op;
+    UWORD Index = PaintFrame_Append(Frame, PAINT_OP_STAR, &Op);
+    if (Index != PAINT_OP_NONE) {
+        Op->Xstart = X_Center;
+        Op->Ystart = Y_Center;
+        Op->Xend = Size;
+        Op->Color = Color;
+    }
+    return PaintFrame_Commit(Frame, Index);
+}
+
+UWORD PaintFrame_FillPolygon(PAINT_FRAME *Frame, const PAINT_POINT *Points, UWORD Count,
+                             UWORD Color, FILL_RULE Fill_Rule)
+{
+    if (Count > POLYGON_MAX_EDGES) {
+        Debug("PaintFrame_FillPolygon Input vertex count out of range\r\n");
+        return PAINT_OP_NONE;
+    }
+    PAINT_OP *Op;
+    UWORD Index = PaintFrame_Append(Frame, PAINT_OP_POLYGON, &Op);
+    if (Index != PAINT_OP_NONE) {
+        Op->Data = Points;
+        Op->Width = Count;
+        Op->Color = Color;
+        Op->Style = Fill_Rule;
+    }
+    return PaintFrame_Commit(Frame, Index);
+}
+
+UWORD PaintFrame_DrawString_EN(PAINT_FRAME *Frame, UWORD Xstart, UWORD Ystart, const char * pString,
+                               sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    PAINT_OP *Op;
+    UWORD Index = PaintFrame_Append(Frame, PAINT_OP_STRING, &Op);
+    if (Index != PAINT_OP_NONE) {
+        Op->Xstart = Xstart;
+        Op->Ystart = Ystart;
+        Op->Data = Font;
+        Op->Color = Color_Foreground;
+        Op->Background = Color_Background;
+        PaintFrame_CopyText(Op->Text, pString);
+    }
+    return PaintFrame_Commit(Frame, Index);
+}
+
+UWORD PaintFrame_DrawStringScaled(PAINT_FRAME *Frame, UWORD Xstart, UWORD Ystart, const char * pString,
+                                  sFONT* Font, UBYTE Factor, UWORD Flags,
+                                  UWORD Color_Foreground, UWORD Color_Background)
+{
+    PAINT_OP *Op;
+    UWORD Index = PaintFrame_Append(Frame, PAINT_OP_STRING, &Op);
+    if (Index != PAINT_OP_NONE) {
+        Op->Xstart = Xstart;
+        Op->Ystart = Ystart;
+        Op->Data = Font;
+        Op->Width = Factor;
+        Op->Style = Flags;
+        Op->Color = Color_Foreground;
+        Op->Background = Color_Background;
+        PaintFrame_CopyText(Op->Text, pString);
+    }
+    return PaintFrame_Commit(Frame, Index);
+}
+
+UWORD PaintFrame_DrawTextBox(PAINT_FRAME *Frame, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                             const char * pString, sFONT* Font, UWORD Flags,
+                             UWORD Color_Foreground, UWORD Color_Background)
+{
+    PAINT_OP *Op;
+    UWORD Index = PaintFrame_Append(Frame, PAINT_OP_TEXT_BOX, &Op);
+    if (Index != PAINT_OP_NONE) {
+        Op->Xstart = Xstart;
+        Op->Ystart = Ystart;
+        Op->Xend = Xend;
+        Op->Yend = Yend;
+        Op->Data = Font;
+        Op->Style = Flags;
+        Op->Color = Color_Foreground;
+        Op->Background = Color_Background;
+        PaintFrame_CopyText(Op->Text, pString);
+    }
+    return PaintFrame_Commit(Frame, Index);
+}
+
+UWORD PaintFrame_DrawImage(PAINT_FRAME *Frame, const unsigned char *image_buffer,
+                           UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image)
+{
+    return PaintFrame_DrawImageMode(Frame, image_buffer, xStart, yStart, W_Image, H_Image, IMAGE_COPY);
+}
+
+UWORD PaintFrame_DrawImageMode(PAINT_FRAME *Frame, const unsigned char *image_buffer,
+                               UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image, IMAGE_MODE Mode)
+{
+    PAINT_OP *Op;
+    UWORD Index = PaintFrame_Append(Frame, PAINT_OP_IMAGE, &Op);
+    if (Index != PAINT_OP_NONE) {
+        Op->Data = image_buffer;
+        Op->Xstart = xStart;
+        Op->Ystart = yStart;
+        Op->Xend = W_Image;
+        Op->Yend = H_Image;
+        Op->Style = Mode;
+    }
+    return PaintFrame_Commit(Frame, Index);
+}
+
+/******************************************************************************
+function: Replace a recorded operation, keeping its place in the drawing order
+parameter:
+    Frame : Frame to update
+    Index : Operation to replace, as returned when it was recorded
+    Op    : New operation, usually recorded into a scratch frame
+info:
+    Both the old and the new box of the operation become dirty.
+******************************************************************************/
+void PaintFrame_Replace(PAINT_FRAME *Frame, UWORD Index, const PAINT_OP *Op)
+{
+    if (Index >= Frame->Count) {
+        Debug("PaintFrame_Replace Input exceeds the frame\r\n");
+        return;
+    }
+    PAINT_OP *Old = &Frame->Ops[Index];
+    PaintFrame_Invalidate(Frame, &Old->Bounds);
+    *Old = *Op;
+    PaintFrame_Commit(Frame, Index);
+    PaintFrame_Invalidate(Frame, &Old->Bounds);
+}
+
+static UBYTE PaintFrame_SamePlace(const PAINT_GLYPH_POS *A, const PAINT_GLYPH_POS *B)
+{
+    return A->Code == B->Code && A->X == B->X && A->Width == B->Width;
+}
+
+/******************************************************************************
+function: Part of a recorded string that a new text changes
+parameter:
+    Op   : PAINT_OP_STRING, still holding the old text
+    Text : New text
+    Rect : Receives the cells of both texts that differ
+info:
+    Both texts are laid out; the characters at the start and at the end
+    that keep their place are left out, so a reading that changes one
+    digit only redraws that digit. Cells stay inside the op bounds.
+******************************************************************************/
+static void PaintFrame_TextChange(const PAINT_OP *Op, const char *Text, PAINT_RECT *Rect)
+{
+    PAINT_GLYPH_POS Old_Glyphs[PAINT_OP_TEXT_LEN], New_Glyphs[PAINT_OP_TEXT_LEN];
+    PAINT_LAYOUT Old, New;
+    sFONT *Font = (sFONT *)Op->Data;
+    PaintLayout_Init(&Old, Old_Glyphs, PAINT_OP_TEXT_LEN);
+    PaintLayout_Init(&New, New_Glyphs, PAINT_OP_TEXT_LEN);
+    PaintLayout_String(&Old, Op->Text, Font, Op->Style);
+    PaintLayout_String(&New, Text, Font, Op->Style);
+
+    UWORD Head = 0, Tail = 0;
+    while (Head < Old.Count && Head < New.Count && PaintFrame_SamePlace(&Old_Glyphs[Head], &New_Glyphs[Head]))
+        Head++;
+    while (Head + Tail < Old.Count && Head + Tail < New.Count &&
+           PaintFrame_SamePlace(&Old_Glyphs[Old.Count - 1 - Tail], &New_Glyphs[New.Count - 1 - Tail]))
+        Tail++;
+
+    UDOUBLE Xmin = 0xFFFF, Xmax = 0;
+    for (UWORD i = Head; i + Tail < Old.Count; i++) {
+        if (Old_Glyphs[i].X < Xmin) Xmin = Old_Glyphs[i].X;
+        if (Old_Glyphs[i].X + Old_Glyphs[i].Width > Xmax) Xmax = Old_Glyphs[i].X + Old_Glyphs[i].Width;
+    }
+    for (UWORD i = Head; i + Tail < New.Count; i++) {
+        if (New_Glyphs[i].X < Xmin) Xmin = New_Glyphs[i].X;
+        if (New_Glyphs[i].X + New_Glyphs[i].Width > Xmax) Xmax = New_Glyphs[i].X + New_Glyphs[i].Width;
+    }
+    Rect->Xstart = Rect->Xend = Op->Bounds.Xstart;
+    Rect->Ystart = Op->Bounds.Ystart;
+    Rect->Yend = Op->Bounds.Yend;
+    if (Xmin < Xmax) {
+        UDOUBLE Factor = Op->Width ? Op->Width : 1;
+        Rect->Xstart = Op->Xstart + Xmin * Factor > 0xFFFF ? 0xFFFF : Op->Xstart + Xmin * Factor;
+        Rect->Xend = Op->Xstart + Xmax * Factor > 0xFFFF ? 0xFFFF : Op->Xstart + Xmax * Factor;
+    }
+}
+
+/******************************************************************************
+function: Change the text of a recorded string
+parameter:
+    Frame   : Frame to update
+    Index   : String or text box, as returned by PaintFrame_DrawString_EN
+              or PaintFrame_DrawTextBox
+    pString : New text, nothing becomes dirty if it is unchanged
+info:
+    A string only marks the characters that change as dirty, see
+    PaintFrame_TextChange; TEXT_TABULAR keeps digits from moving the
+    ones after them. A text box is dirty as a whole.
+******************************************************************************/
+void PaintFrame_SetString(PAINT_FRAME *Frame, UWORD Index, const char * pString)
+{
+    if (Index >= Frame->Count ||
+        (Frame->Ops[Index].Type != PAINT_OP_STRING && Frame->Ops[Index].Type != PAINT_OP_TEXT_BOX)) {
+        Debug("PaintFrame_SetString Input is not a string\r\n");
+        return;
+    }
+    PAINT_OP *Op = &Frame->Ops[Index];
+    char Text[PAINT_OP_TEXT_LEN];
+    PaintFrame_CopyText(Text, pString);
+    if (memcmp(Op->Text, Text, PAINT_OP_TEXT_LEN) == 0)
+        return;
+    if (Op->Type == PAINT_OP_STRING) {
+        PAINT_RECT Change;
+        PaintFrame_TextChange(Op, Text, &Change);
+        PaintFrame_Invalidate(Frame, &Change);
+        memcpy(Op->Text, Text, PAINT_OP_TEXT_LEN);
+        PaintFrame_Commit(Frame, Index);
+        return;
+    }
+    PaintFrame_Invalidate(Frame, &Op->Bounds);
+    memcpy(Op->Text, Text, PAINT_OP_TEXT_LEN);
+    PaintFrame_Commit(Frame, Index);
+    PaintFrame_Invalidate(Frame, &Op->Bounds);
+}
+
+/******************************************************************************
+function: Draw one recorded operation into a context
+parameter:
+    Op  : Operation to draw
+    Ctx : Target context, its active clip window applies
+******************************************************************************/
+void PaintFrame_RenderOp(const PAINT_OP *Op, PaintContext *Ctx)
+{
+    switch (Op->Type) {
+    case PAINT_OP_CLEAR:
+        //Clear only what the clip allows, so bands clear their own rows
+        PaintCtx_ClearWindows(Ctx, 0, 0, Ctx->Width, Ctx->Height, Op->Color);
+        break;
+    case PAINT_OP_CLEAR_WINDOWS:
+        PaintCtx_ClearWindows(Ctx, Op->Xstart, Op->Ystart, Op->Xend, Op->Yend, Op->Color);
+        break;
+    case PAINT_OP_POINT:
+        PaintCtx_DrawPoint(Ctx, Op->Xstart, Op->Ystart, Op->Color,
+                           (DOT_PIXEL)Op->Width, (DOT_STYLE)Op->Style);
+        break;
+    case PAINT_OP_LINE:
+        PaintCtx_DrawLine(Ctx, Op->Xstart, Op->Ystart, Op->Xend, Op->Yend, Op->Color,
+                          (DOT_PIXEL)Op->Width, (LINE_STYLE)Op->Style);
+        break;
+    case PAINT_OP_RECTANGLE:
+        PaintCtx_DrawRectangle(Ctx, Op->Xstart, Op->Ystart, Op->Xend, Op->Yend, Op->Color,
+                               (DOT_PIXEL)Op->Width, (DRAW_FILL)Op->Style);
+        break;
+    case PAINT_OP_CIRCLE:
+        PaintCtx_DrawCircle(Ctx, Op->Xstart, Op->Ystart, Op->Xend, Op->Color,
+                            (DOT_PIXEL)Op->Width, (DRAW_FILL)Op->Style);
+        break;
+    case PAINT_OP_STAR:
+        PaintCtx_DrawStar(Ctx, Op->Xstart, Op->Ystart, Op->Xend, Op->Color);
+        break;
+    case PAINT_OP_POLYGON:
+        PaintCtx_FillPolygon(Ctx, (const PAINT_POINT *)Op->Data, Op->Width, Op->Color,
+                             (FILL_RULE)Op->Style);
+        break;
+    case PAINT_OP_STRING:
+        //Drawn at factor 1 rather than by DrawString_EN, which would wrap
+        //the string out of its box at the right edge
+        PaintCtx_DrawStringScaled(Ctx, Op->Xstart, Op->Ystart, Op->Text, (sFONT *)Op->Data,
+                                  Op->Width ? Op->Width : 1, Op->Style, Op->Color, Op->Background);
+        break;
+    case PAINT_OP_TEXT_BOX:
+        PaintCtx_DrawTextBox(Ctx, Op->Xstart, Op->Ystart, Op->Xend, Op->Yend, Op->Text, (sFONT *)Op->Data,
+                             Op->Style, Op->Color, Op->Background);
+        break;
+    case PAINT_OP_IMAGE:
+        PaintCtx_DrawImageMode(Ctx, (const unsigned char *)Op->Data, Op->Xstart, Op->Ystart,
+                               Op->Xend, Op->Yend, (IMAGE_MODE)Op->Style);
+        break;
+    default:
+        break;
+    }
+}
+
+/******************************************************************************
+function: Draw a whole frame into a context
+parameter:
+    Frame : Frame to draw
+    Ctx   : Target context, its active clip window applies
+******************************************************************************/
+void PaintFrame_Render(const PAINT_FRAME *Frame, PaintContext *Ctx)
+{
+    for (UWORD i = 0; i < Frame->Count; i++)
+        PaintFrame_RenderOp(&Frame->Ops[i], Ctx);
+}
+
+/******************************************************************************
+function: Draw the frame restricted to a band of memory rows
+parameter:
+    Frame  : Frame to draw
+    Ctx    : Private copy of the target context
+    Ystart : First memory row of the band
+    Yend   : Last memory row of the band (not included)
+******************************************************************************/
+static void PaintFrame_RenderBand(const PAINT_FRAME *Frame, PaintContext *Ctx, UWORD Ystart, UWORD Yend)
+{
+    PaintCtx_PushBand(Ctx, Ystart, Yend);
+    PaintFrame_Render(Frame, Ctx);
+    PaintCtx_PopClip(Ctx);
+}
+
+/******************************************************************************
+function: Whether the sparse red plane holds runs on the memory rows of a box
+info:
+    Memory rows run along logical y for 0/180 and logical x for 90/270,
+    as in PaintCtx_PushBand.
+******************************************************************************/
+static UBYTE PaintFrame_RedUnder(const PaintContext *Ctx, const PAINT_RECT *Box)
+{
+    UBYTE Sideways = Ctx->Rotate == ROTATE_90 || Ctx->Rotate == ROTATE_270;
+    UBYTE Flip = (Ctx->Rotate == ROTATE_180 || Ctx->Rotate == ROTATE_270) ^
+                 ((Ctx->Mirror & MIRROR_VERTICAL) ? 1 : 0);
+    UWORD Start = Sideways ? Box->Xstart : Box->Ystart;
+    UWORD End = Sideways ? Box->Xend : Box->Yend;
+    if (End > Ctx->HeightMemory)
+        End = Ctx->HeightMemory;
+    if (Start >= End)
+        return 0;
+    if (Flip) {
+        UWORD Last = End;
+        End = Ctx->HeightMemory - Start;
+        Start = Ctx->HeightMemory - Last;
+    }
+    for (UWORD Y = Start; Y < End; Y++)
+        if (Ctx->SparseRed->RowHead[Y] != PAINT_RUN_NONE)
+            return 1;
+    return 0;
+}
+
+/******************************************************************************
+function: Draw only the sparse red plane of a frame, if there is one
+parameter:
+    Frame : Frame to draw
+    Ctx   : Target context, takes the plane over if it turns dense
+info:
+    An operation without red can only erase red pixels, so it is skipped
+    where the plane holds none; a layout in black with a few red marks
+    then costs little more than the marks.
+******************************************************************************/
+static void PaintFrame_RenderSparseRed(const PAINT_FRAME *Frame, PaintContext *Ctx)
+{
+    if (Ctx->SparseRed == NULL)
+        return;
+    PaintContext Red = *Ctx;
+    Red.Image = NULL;
+    for (UWORD i = 0; i < Frame->Count; i++) {
+        const PAINT_OP *Op = &Frame->Ops[i];
+        if (Op->Color == RED || Op->Background == RED || Red.SparseRed == NULL ||
+            PaintFrame_RedUnder(&Red, &Op->Bounds))
+            PaintFrame_RenderOp(Op, &Red);
+    }
+    Ctx->ImageRed = Red.ImageRed;
+    Ctx->SparseRed = Red.SparseRed;
+}
+
+typedef struct {
+    const PAINT_FRAME *Frame;
+    PaintContext Ctx;
+    UWORD Ystart;
+    UWORD Yend;
+#if defined(ESP32)
+    SemaphoreHandle_t Done;
+#endif
+} PAINT_BAND_JOB;
+
+#if defined(ESP32)
+static void PaintFrame_BandTask(void *Arg)
+{
+    PAINT_BAND_JOB *Job = (PAINT_BAND_JOB *)Arg;
+    PaintFrame_RenderBand(Job->Frame, &Job->Ctx, Job->Ystart, Job->Yend);
+    xSemaphoreGive(Job->Done);
+    vTaskDelete(NULL);
+}
+#endif
+
+/******************************************************************************
+function: Draw a frame on two cores
+parameter:
+    Frame : Frame to draw
+    Ctx   : Target context, its active clip window applies
+info:
+    The image is split into an upper and a lower band of memory rows. The
+    upper band is drawn by a task on the other core (a thread on the host),
+    the lower band by the caller, and the call returns once both are done.
+    Only the caller's band uses the context's glyph and text-run caches.
+    A sparse red plane is drawn whole by the caller, once its band of the
+    dense black plane is done.
+    Falls back to a single pass for a sparse black plane or if the worker
+    cannot be started.
+******************************************************************************/
+void PaintFrame_RenderParallel(const PAINT_FRAME *Frame, PaintContext *Ctx)
+{
+    //Runs of a sparse plane are shared by all rows, it is drawn in one pass
+    if (Ctx->Sparse) {
+        PaintFrame_Render(Frame, Ctx);
+        return;
+    }
+
+    //The bands draw only the black plane when the red one is sparse
+    PaintContext Lower = *Ctx;
+    Lower.SparseRed = NULL;
+    UWORD Split = Ctx->HeightMemory / 2;
+
+    PAINT_BAND_JOB Job;
+    Job.Frame = Frame;
+    Job.Ctx = Lower;
+    Job.Ystart = 0;
+    Job.Yend = Split;
+    //The caches are not shared between cores, the worker decodes as it goes
+    Job.Ctx.GlyphCache = NULL;
+    Job.Ctx.TextCache = NULL;
+
+#if defined(ESP32)
+    StaticSemaphore_t Done_Buffer;
+    Job.Done = xSemaphoreCreateBinaryStatic(&Done_Buffer);
+    if (xTaskCreatePinnedToCore(PaintFrame_BandTask, "PaintBand", PAINT_BAND_STACK, &Job,
+                                uxTaskPriorityGet(NULL), NULL, xPortGetCoreID() ^ 1) != pdPASS) {
+        Debug("PaintFrame_RenderParallel cannot start the band task\r\n");
+        PaintFrame_Render(Frame, Ctx);
+        return;
+    }
+    PaintFrame_RenderBand(Frame, &Lower, Split, Ctx->HeightMemory);
+    PaintFrame_RenderSparseRed(Frame, Ctx);
+    xSemaphoreTake(Job.Done, portMAX_DELAY);
+#else
+    std::thread Worker;
+    try {
+        Worker = std::thread(PaintFrame_RenderBand, Frame, &Job.Ctx, Job.Ystart, Job.Yend);
+    } catch (const std::system_error &) {
+        Debug("PaintFrame_RenderParallel cannot start the band thread\r\n");
+        PaintFrame_Render(Frame, Ctx);
+        return;
+    }
+    PaintFrame_RenderBand(Frame, &Lower, Split, Ctx->HeightMemory);
+    PaintFrame_RenderSparseRed(Frame, Ctx);
+    Worker.join();
+#endif
+}
+
+/******************************************************************************
+function: Draw a frame strip by strip into a small buffer
+parameter:
+    Frame        : Frame to draw
+    Ctx          : Size, rotation, mirroring and scale of the whole image,
+                   its image buffer is not used
+    Strip        : Buffer of Strip_Height rows of Ctx->WidthByte bytes
+    Strip_Height : Memory rows per strip
+    Red          : 1 to draw the red plane of a tri-colour image, 0 the black one
+    Sink         : Called with every strip once it is drawn, top to bottom
+    Arg          : Passed to Sink
+info:
+    Every strip is cleared to the image color of Ctx and the operations
+    whose boxes meet it are replayed, clipped to its rows. Only one strip is ever held in
+    memory, so the image can be sent to the panel without a frame buffer.
+******************************************************************************/
+void PaintFrame_RenderStrips(const PAINT_FRAME *Frame, const PaintContext *Ctx, UBYTE *Strip, UWORD Strip_Height,
+                             UBYTE Red, PAINT_STRIP_SINK Sink, void *Arg)
+{
+    PaintContext Band = *Ctx;
+    for (UWORD Ystart = 0; Ystart < Ctx->HeightMemory; Ystart += Strip_Height) {
+        UWORD Yend = Ystart + Strip_Height;
+        if (Yend > Ctx->HeightMemory)
+            Yend = Ctx->HeightMemory;
+        if (Red)
+            PaintCtx_SelectBandRed(&Band, Strip, Ystart, Yend);
+        else
+            PaintCtx_SelectBand(&Band, Strip, Ystart, Yend);
+        PaintCtx_Clear(&Band, Ctx->Color);
+        for (UWORD i = 0; i < Frame->Count; i++) {
+            if (PaintFrame_RectOverlap(&Frame->Ops[i].Bounds, &Band.Clip[0]))
+                PaintFrame_RenderOp(&Frame->Ops[i], &Band);
+        }
+        Sink(Strip, Ystart, Yend, Arg);
+    }
+}
+
+/******************************************************************************
+function: Redraw the dirty region of a frame
+parameter:
+    Frame   : Frame to draw, its dirty region is emptied
+    Ctx     : Target context holding the previous rendering of the frame
+    Redrawn : Receives the redrawn region, may be NULL
+return:
+    0 if nothing was dirty
+info:
+    The region is cleared to the image color of the context, then every
+    operation whose box meets it is drawn again in order, clipped to it,
+    so overlapping operations come out as in a full render.
+******************************************************************************/
+UBYTE PaintFrame_Redraw(PAINT_FRAME *Frame, PaintContext *Ctx, PAINT_RECT *Redrawn)
+{
+    PAINT_RECT Dirty = Frame->Dirty;
+    if (Dirty.Xend > Ctx->Width) Dirty.Xend = Ctx->Width;
+    if (Dirty.Yend > Ctx->Height) Dirty.Yend = Ctx->Height;
+    Frame->Dirty.Xstart = Frame->Dirty.Xend = 0;
+    Frame->Dirty.Ystart = Frame->Dirty.Yend = 0;
+    if (PaintFrame_RectEmpty(&Dirty))
+        return 0;
+
+    PaintCtx_PushClip(Ctx, Dirty.Xstart, Dirty.Ystart, Dirty.Xend, Dirty.Yend);
+    PaintCtx_ClearWindows(Ctx, Dirty.Xstart, Dirty.Ystart, Dirty.Xend, Dirty.Yend, Ctx->Color);
+    for (UWORD i = 0; i < Frame->Count; i++) {
+        if (PaintFrame_RectOverlap(&Frame->Ops[i].Bounds, &Dirty))
+            PaintFrame_RenderOp(&Frame->Ops[i], Ctx);
+    }
+    PaintCtx_PopClip(Ctx);
+
+    if (Redrawn)
+        *Redrawn = Dirty;
+    return 1;
+}
@@ -0,0 +1,118 @@
+/******************************************************************************
+* | File      	:   GUI_Frame.h
+* | Function    :   Record drawing operations into a frame and replay them
+*                   into a paint context, in one pass or band by band on
+*                   both cores
+* | Info        :
+*   A frame only stores the parameters of each primitive. Strings are
+*   copied into the operation, polygon points and images are referenced
+*   and must stay valid until the frame is no longer rendered.
+*
+*   A frame can also be kept as a retained display list: every operation
+*   carries its bounding box, replacing an operation marks its old and new
+*   boxes dirty, and PaintFrame_Redraw re-rasterizes only the operations
+*   that intersect the dirty region, clipped to it.
+******************************************************************************/
+#ifndef __GUI_FRAME_H
+#define __GUI_FRAME_H
+
+#include "GUI_Paint.h"
+
+/**
+ * Recorded operation types
+**/
+typedef enum {
+    PAINT_OP_CLEAR = 0,
+    PAINT_OP_CLEAR_WINDOWS,
+    PAINT_OP_POINT,
+    PAINT_OP_LINE,
+    PAINT_OP_RECTANGLE,
+    PAINT_OP_CIRCLE,
+    PAINT_OP_STAR,
+    PAINT_OP_POLYGON,
+    PAINT_OP_STRING,
+    PAINT_OP_IMAGE,
+    PAINT_OP_TEXT_BOX,
+} PAINT_OP_TYPE;
+
+#define PAINT_OP_TEXT_LEN   48  //Text box descriptions such as forecasts included
+#define PAINT_OP_NONE       0xFFFF  //Returned when the frame is full
+
+/**
+ * One recorded primitive
+ *   Xstart..Yend : Coordinates, circle and star use (Xstart, Ystart) as
+ *                  center and Xend as radius, images use Xend/Yend as size,
+ *                  text boxes are the box
+ *   Width        : DOT_PIXEL, the vertex count of a polygon, or the factor
+ *                  of a scaled string (0 for one drawn as is)
+ *   Style        : LINE_STYLE, DRAW_FILL, DOT_STYLE, FILL_RULE, IMAGE_MODE
+ *                  or TEXT_* flags
+ *   Bounds       : Pixels the primitive may touch, strings stay on one
+ *                  line and are clipped at the right edge
+**/
+typedef struct {
+    UBYTE Type;
+    UBYTE Width;
+    UWORD Style;
+    UWORD Color;
+    UWORD Background;
+    UWORD Xstart;
+    UWORD Ystart;
+    UWORD Xend;
+    UWORD Yend;
+    const void *Data;   //sFONT, PAINT_POINT array or image bits
+    char Text[PAINT_OP_TEXT_LEN];
+    PAINT_RECT Bounds;
+} PAINT_OP;
+
+/**
+ * A list of operations in drawing order, the storage is supplied by the caller.
+ * Dirty is the region changed since the last redraw, empty when Xstart >= Xend.
+**/
+typedef struct {
+    PAINT_OP *Ops;
+    UWORD Capacity;
+    UWORD Count;
+    PAINT_RECT Dirty;
+} PAINT_FRAME;
+
+/**
+ * Receives each rendered strip of memory rows [Ystart, Yend)
+**/
+typedef void (*PAINT_STRIP_SINK)(const UBYTE *Strip, UWORD Ystart, UWORD Yend, void *Arg);
+
+//Build
+void PaintFrame_Init(PAINT_FRAME *Frame, PAINT_OP *Ops, UWORD Capacity);
+void PaintFrame_Reset(PAINT_FRAME *Frame);
+
+UWORD PaintFrame_Clear(PAINT_FRAME *Frame, UWORD Color);
+UWORD PaintFrame_ClearWindows(PAINT_FRAME *Frame, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
+UWORD PaintFrame_DrawPoint(PAINT_FRAME *Frame, UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style);
+UWORD PaintFrame_DrawLine(PAINT_FRAME *Frame, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style);
+UWORD PaintFrame_DrawRectangle(PAINT_FRAME *Frame, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+UWORD PaintFrame_DrawCircle(PAINT_FRAME *Frame, UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+UWORD PaintFrame_DrawStar(PAINT_FRAME *Frame, UWORD X_Center, UWORD Y_Center, UWORD Size, UWORD Color);
+UWORD PaintFrame_FillPolygon(PAINT_FRAME *Frame, const PAINT_POINT *Points, UWORD Count, UWORD Color, FILL_RULE Fill_Rule);
+UWORD PaintFrame_DrawString_EN(PAINT_FRAME *Frame, UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+UWORD PaintFrame_DrawStringScaled(PAINT_FRAME *Frame, UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font,
+                                  UBYTE Factor, UWORD Flags, UWORD Color_Foreground, UWORD Color_Background);
+UWORD PaintFrame_DrawTextBox(PAINT_FRAME *Frame, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, const char * pString,
+                             sFONT* Font, UWORD Flags, UWORD Color_Foreground, UWORD Color_Background);
+UWORD PaintFrame_DrawImage(PAINT_FRAME *Frame, const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image);
+UWORD PaintFrame_DrawImageMode(PAINT_FRAME *Frame, const unsigned char *image_buffer, UWORD xStart, UWORD yStart,
+                               UWORD W_Image, UWORD H_Image, IMAGE_MODE Mode);
+
+//Update
+void PaintFrame_Replace(PAINT_FRAME *Frame, UWORD Index, const PAINT_OP *Op);
+void PaintFrame_SetString(PAINT_FRAME *Frame, UWORD Index, const char * pString);
+void PaintFrame_Invalidate(PAINT_FRAME *Frame, const PAINT_RECT *Rect);
+
+//Replay
+void PaintFrame_RenderOp(const PAINT_OP *Op, PaintContext *Ctx);
+void PaintFrame_Render(const PAINT_FRAME *Frame, PaintContext *Ctx);
+void PaintFrame_RenderParallel(const PAINT_FRAME *Frame, PaintContext *Ctx);
+void PaintFrame_RenderStrips(const PAINT_FRAME *Frame, const PaintContext *Ctx, UBYTE *Strip, UWORD Strip_Height,
+                             UBYTE Red, PAINT_STRIP_SINK Sink, void *Arg);
+UBYTE PaintFrame_Redraw(PAINT_FRAME *Frame, PaintContext *Ctx, PAINT_RECT *Redrawn);
+
+#endif
@@ -74,6 +74,7 @@
 *
 ******************************************************************************/
 #include "GUI_Paint.h"
+#include "GUI_Format.h"
 #include "DEV_Config.h"
 #include "Debug.h"
 #include <stdint.h>
@@ -81,7 +82,7 @@
 #include <string.h> //memset()
 #include <math.h>
 
-PAINT Paint;
+PaintContext Paint;
 
 /******************************************************************************
 function: Create Image
@@ -91,30 +92,39 @@ parameter:
     Height  :   The height of the picture
     Color   :   Whether the picture is inverted
 ******************************************************************************/
-void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color)
+void PaintCtx_NewImage(PaintContext *Ctx, UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color)
 {
-    Paint.Image = NULL;
-    Paint.Image = image;
+    Ctx->Image = NULL;
+    Ctx->Image = image;
 
-    Paint.WidthMemory = Width;
-    Paint.HeightMemory = Height;
-    Paint.Color = Color;    
-    Paint.Scale = 2;
-    Paint.WidthByte = (Width % 8 == 0)? (Width / 8 ): (Width / 8 + 1);
-    Paint.HeightByte = Height;    
-//    printf("WidthByte = %d, HeightByte = %d\r\n", Paint.WidthByte, Paint.HeightByte);
+    Ctx->WidthMemory = Width;
+    Ctx->HeightMemory = Height;
+    Ctx->Color = Color;    
+    Ctx->Scale = 2;
+    Ctx->WidthByte = (Width % 8 == 0)? (Width / 8 ): (Width / 8 + 1);
+    Ctx->HeightByte = Height;    
+    Ctx->BandStart = 0;
+    Ctx->BandHeight = Height;
+    Ctx->Sparse = NULL;
+    Ctx->ImageRed = NULL;
+    Ctx->SparseRed = NULL;
+    Ctx->TriColor = 0;
+    Ctx->GlyphCache = NULL;
+    Ctx->TextCache = NULL;
+//    printf("WidthByte = %d, HeightByte = %d\r\n", Ctx->WidthByte, Ctx->HeightByte);
 //    printf(" EPD_WIDTH / 8 = %d\r\n",  122 / 8);
    
-    Paint.Rotate = Rotate;
-    Paint.Mirror = MIRROR_NONE;
+    Ctx->Rotate = Rotate;
+    Ctx->Mirror = MIRROR_NONE;
     
     if(Rotate == ROTATE_0 || Rotate == ROTATE_180) {
-        Paint.Width = Width;
-        Paint.Height = Height;
+        Ctx->Width = Width;
+        Ctx->Height = Height;
     } else {
-        Paint.Width = Height;
-        Paint.Height = Width;
+        Ctx->Width = Height;
+        Ctx->Height = Width;
     }
+    PaintCtx_ResetClip(Ctx);
 }
 
 /******************************************************************************
@@ -122,9 +132,47 @@ function: Select Image
 parameter:
     image : Pointer to the image cache
 ******************************************************************************/
-void Paint_SelectImage(UBYTE *image)
+void PaintCtx_SelectImage(PaintContext *Ctx, UBYTE *image)
+{
+    Ctx->Image = image;
+    Ctx->Sparse = NULL;
+}
+
+/******************************************************************************
+function: Select a strip buffer holding only some memory rows of the image
+parameter:
+    image  : Strip buffer, (Yend - Ystart) rows of WidthByte bytes
+    Ystart : First memory row held by the strip
+    Yend   : Last memory row held by the strip (not included)
+info:
+    The image keeps its full size; the clip stack is reset to the part of
+    the image inside the strip, so every primitive can be drawn as usual
+    and only lands in the strip. Passing the whole height selects a full
+    image again. The strip is the only plane drawn into: of a tri-colour
+    image, SelectBand takes the black plane and SelectBandRed the red one.
+******************************************************************************/
+static void PaintCtx_Band(PaintContext *Ctx, UWORD Ystart, UWORD Yend)
+{
+    Ctx->Image = NULL;
+    Ctx->Sparse = NULL;
+    Ctx->ImageRed = NULL;
+    Ctx->SparseRed = NULL;
+    Ctx->BandStart = Ystart;
+    Ctx->BandHeight = Yend - Ystart;
+    PaintCtx_ResetClip(Ctx);
+}
+
+void PaintCtx_SelectBand(PaintContext *Ctx, UBYTE *image, UWORD Ystart, UWORD Yend)
 {
-    Paint.Image = image;
+    PaintCtx_Band(Ctx, Ystart, Yend);
+    Ctx->Image = image;
+}
+
+void PaintCtx_SelectBandRed(PaintContext *Ctx, UBYTE *image, UWORD Ystart, UWORD Yend)
+{
+    PaintCtx_Band(Ctx, Ystart, Yend);
+    Ctx->ImageRed = image;
+    Ctx->TriColor = 1;
 }
 
 /******************************************************************************
@@ -132,11 +180,11 @@ function: Select Image Rotate
 parameter:
     Rotate : 0,90,180,270
 ******************************************************************************/
-void Paint_SetRotate(UWORD Rotate)
+void PaintCtx_SetRotate(PaintContext *Ctx, UWORD Rotate)
 {
     if(Rotate == ROTATE_0 || Rotate == ROTATE_90 || Rotate == ROTATE_180 || Rotate == ROTATE_270) {
         // Debug("Set image Rotate %d\r\n", Rotate);
-        Paint.Rotate = Rotate;
+        Ctx->Rotate = Rotate;
     } else {
         Debug("rotate = 0, 90, 180, 270\r\n");
     }
@@ -147,31 +195,31 @@ function:	Select Image mirror
 parameter:
     mirror   :Not mirror,Horizontal mirror,Vertical mirror,Origin mirror
 ******************************************************************************/
-void Paint_SetMirroring(UBYTE mirror)
+void PaintCtx_SetMirroring(PaintContext *Ctx, UBYTE mirror)
 {
     if(mirror == MIRROR_NONE || mirror == MIRROR_HORIZONTAL || 
         mirror == MIRROR_VERTICAL || mirror == MIRROR_ORIGIN) {
         // Debug("mirror image x:%s, y:%s\r\n",(mirror & 0x01)? "mirror":"none", ((mirror >> 1) & 0x01)? "mirror":"none");
-        Paint.Mirror = mirror;
+        Ctx->Mirror = mirror;
     } else {
         Debug("mirror should be MIRROR_NONE, MIRROR_HORIZONTAL, \
         MIRROR_VERTICAL or MIRROR_ORIGIN\r\n");
     }    
 }
 
-void Paint_SetScale(UBYTE scale)
+void PaintCtx_SetScale(PaintContext *Ctx, UBYTE scale)
 {
     if(scale == 2){
-        Paint.Scale = scale;
-        Paint.WidthByte = (Paint.WidthMemory % 8 == 0)? (Paint.WidthMemory / 8 ): (Paint.WidthMemory / 8 + 1);
+        Ctx->Scale = scale;
+        Ctx->WidthByte = (Ctx->WidthMemory % 8 == 0)? (Ctx->WidthMemory / 8 ): (Ctx->WidthMemory / 8 + 1);
     }
 	else if(scale == 4) {
-        Paint.Scale = scale;
-        Paint.WidthByte = (Paint.WidthMemory % 4 == 0)? (Paint.WidthMemory / 4 ): (Paint.WidthMemory / 4 + 1);
+        Ctx->Scale = scale;
+        Ctx->WidthByte = (Ctx->WidthMemory % 4 == 0)? (Ctx->WidthMemory / 4 ): (Ctx->WidthMemory / 4 + 1);
     }
 	else if(scale == 7) {//Only applicable with 5in65 e-Paper
-		Paint.Scale = 7;
-		Paint.WidthByte = (Paint.WidthMemory % 2 == 0)? (Paint.WidthMemory / 2 ): (Paint.WidthMemory / 2 + 1);
+		Ctx->Scale = 7;
+		Ctx->WidthByte = (Ctx->WidthMemory % 2 == 0)? (Ctx->WidthMemory / 2 ): (Ctx->WidthMemory / 2 + 1);
 	}
 	else {
         Debug("Set Scale Input parameter error\r\n");
@@ -179,465 +227,2904 @@ void Paint_SetScale(UBYTE scale)
     }
 }
 /******************************************************************************
-function: Draw Pixels
-parameter:
-    Xpoint : At point X
-    Ypoint : At point Y
-    Color  : Painted colors
+function: Reset the clip stack to the whole image
 ******************************************************************************/
-void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+void PaintCtx_ResetClip(PaintContext *Ctx)
 {
-    if(Xpoint > Paint.Width || Ypoint > Paint.Height){
-        Debug("Exceeding display boundaries\r\n");
-        return;
-    }      
-    UWORD X, Y;
-    switch(Paint.Rotate) {
-    case 0:
-        X = Xpoint;
-        Y = Ypoint;  
-        break;
-    case 90:
-        X = Paint.WidthMemory - Ypoint - 1;
-        Y = Xpoint;
-        break;
-    case 180:
-        X = Paint.WidthMemory - Xpoint - 1;
-        Y = Paint.HeightMemory - Ypoint - 1;
-        break;
-    case 270:
-        X = Ypoint;
-        Y = Paint.HeightMemory - Xpoint - 1;
-        break;
-    default:
-        return;
-    }
-    
-    switch(Paint.Mirror) {
-    case MIRROR_NONE:
-        break;
-    case MIRROR_HORIZONTAL:
-        X = Paint.WidthMemory - X - 1;
-        break;
-    case MIRROR_VERTICAL:
-        Y = Paint.HeightMemory - Y - 1;
-        break;
-    case MIRROR_ORIGIN:
-        X = Paint.WidthMemory - X - 1;
-        Y = Paint.HeightMemory - Y - 1;
-        break;
-    default:
-        return;
-    }
+    Ctx->ClipDepth = 0;
+    Ctx->ClipOverflow = 0;
+    Ctx->Clip[0].Xstart = 0;
+    Ctx->Clip[0].Ystart = 0;
+    Ctx->Clip[0].Xend = Ctx->Width;
+    Ctx->Clip[0].Yend = Ctx->Height;
 
-    if(X > Paint.WidthMemory || Y > Paint.HeightMemory){
-        Debug("Exceeding display boundaries\r\n");
-        return;
-    }
-    
-    if(Paint.Scale == 2){
-        UDOUBLE Addr = X / 8 + Y * Paint.WidthByte;
-        UBYTE Rdata = Paint.Image[Addr];
-        if(Color == BLACK)
-            Paint.Image[Addr] = Rdata & ~(0x80 >> (X % 8));
-        else
-            Paint.Image[Addr] = Rdata | (0x80 >> (X % 8));
-    }else if(Paint.Scale == 4){
-        UDOUBLE Addr = X / 4 + Y * Paint.WidthByte;
-        Color = Color % 4;//Guaranteed color scale is 4  --- 0~3
-        UBYTE Rdata = Paint.Image[Addr];
-        
-        Rdata = Rdata & (~(0xC0 >> ((X % 4)*2)));
-        Paint.Image[Addr] = Rdata | ((Color << 6) >> ((X % 4)*2));
-    }else if(Paint.Scale == 7 || Paint.Scale == 16){
-		UDOUBLE Addr = X / 2  + Y * Paint.WidthByte;
-		UBYTE Rdata = Paint.Image[Addr];
-		Rdata = Rdata & (~(0xF0 >> ((X % 2)*4)));//Clear first, then set value
-		Paint.Image[Addr] = Rdata | ((Color << 4) >> ((X % 2)*4));
-		// printf("Add =  %d ,data = %d\r\n",Addr,Rdata);	
+    //A strip buffer can never be drawn outside of its rows
+    if (Ctx->BandStart != 0 || Ctx->BandHeight != Ctx->HeightMemory) {
+        PaintCtx_PushBand(Ctx, Ctx->BandStart, Ctx->BandStart + Ctx->BandHeight);
+        Ctx->Clip[0] = Ctx->Clip[1];
+        Ctx->ClipDepth = 0;
     }
 }
 
 /******************************************************************************
-function: Clear the color of the picture
+function: Restrict drawing to a window, intersected with the current clip
 parameter:
-    Color : Painted colors
+    Xstart : x starting point
+    Ystart : Y starting point
+    Xend   : x end point (not included)
+    Yend   : y end point (not included)
+info:
+    On a full stack the window is not applied and the push is only
+    counted, so that the matching pop leaves the outer windows in place.
 ******************************************************************************/
-void Paint_Clear(UWORD Color)
+void PaintCtx_PushClip(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
 {
-    if(Paint.Scale == 2) {
-		for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-			for (UWORD X = 0; X < Paint.WidthByte; X++ ) {//8 pixel =  1 byte
-				UDOUBLE Addr = X + Y*Paint.WidthByte;
-				Paint.Image[Addr] = Color;
-			}
-		}
-    }else if(Paint.Scale == 4) {
-        for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-            for (UWORD X = 0; X < Paint.WidthByte; X++ ) {
-                UDOUBLE Addr = X + Y*Paint.WidthByte;
-                Paint.Image[Addr] = (Color<<6)|(Color<<4)|(Color<<2)|Color;
-            }
-        }
-    }else if(Paint.Scale == 7 || Paint.Scale == 16) {
-		for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-			for (UWORD X = 0; X < Paint.WidthByte; X++ ) {
-				UDOUBLE Addr = X + Y*Paint.WidthByte;
-				Paint.Image[Addr] = (Color<<4)|Color;
-			}
-		}		
-	}
+    if (Ctx->ClipDepth + 1 >= PAINT_CLIP_DEPTH) {
+        Debug("Paint_PushClip clip stack is full\r\n");
+        Ctx->ClipOverflow++;
+        return;
+    }
+    const PAINT_RECT *Top = &Ctx->Clip[Ctx->ClipDepth];
+    PAINT_RECT *Clip = &Ctx->Clip[++Ctx->ClipDepth];
+    Clip->Xstart = Xstart > Top->Xstart ? Xstart : Top->Xstart;
+    Clip->Ystart = Ystart > Top->Ystart ? Ystart : Top->Ystart;
+    Clip->Xend = Xend < Top->Xend ? Xend : Top->Xend;
+    Clip->Yend = Yend < Top->Yend ? Yend : Top->Yend;
+    //An empty window keeps Xstart >= Xend, every primitive then draws nothing
+    if (Clip->Xend < Clip->Xstart)
+        Clip->Xend = Clip->Xstart;
+    if (Clip->Yend < Clip->Ystart)
+        Clip->Yend = Clip->Ystart;
 }
 
 /******************************************************************************
-function: Clear the color of a window
-parameter:
-    Xstart : x starting point
-    Ystart : Y starting point
-    Xend   : x end point
-    Yend   : y end point
-    Color  : Painted colors
+function: Restore the clip window that was active before the last push
 ******************************************************************************/
-void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+void PaintCtx_PopClip(PaintContext *Ctx)
 {
-    UWORD X, Y;
-    for (Y = Ystart; Y < Yend; Y++) {
-        for (X = Xstart; X < Xend; X++) {//8 pixel =  1 byte
-            Paint_SetPixel(X, Y, Color);
-        }
-    }
+    if (Ctx->ClipOverflow > 0)
+        Ctx->ClipOverflow--;
+    else if (Ctx->ClipDepth > 0)
+        Ctx->ClipDepth--;
 }
 
 /******************************************************************************
-function: Draw Point(Xpoint, Ypoint) Fill the color
+function: Restrict drawing to a band of memory rows
 parameter:
-    Xpoint		: The Xpoint coordinate of the point
-    Ypoint		: The Ypoint coordinate of the point
-    Color		: Painted color
-    Dot_Pixel	: point size
-    Dot_Style	: point Style
+    Ystart : First memory row
+    Yend   : Last memory row (not included)
+info:
+    Memory rows are the rows of the image buffer, whatever the rotation.
+    Bands on different rows never share a byte, so several contexts on
+    the same image can render their own band at the same time.
 ******************************************************************************/
-void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color,
-                     DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
+void PaintCtx_PushBand(PaintContext *Ctx, UWORD Ystart, UWORD Yend)
 {
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
-        Debug("Paint_DrawPoint Input exceeds the normal display range\r\n");
-        return;
-    }
+    //Memory rows run along logical y for 0/180 and logical x for 90/270
+    UBYTE Flip = (Ctx->Rotate == ROTATE_180 || Ctx->Rotate == ROTATE_270) ^
+                 ((Ctx->Mirror & MIRROR_VERTICAL) ? 1 : 0);
+    UWORD Start = Flip ? Ctx->HeightMemory - Yend : Ystart;
+    UWORD End = Flip ? Ctx->HeightMemory - Ystart : Yend;
 
-    int16_t XDir_Num , YDir_Num;
-    if (Dot_Style == DOT_FILL_AROUND) {
-        for (XDir_Num = 0; XDir_Num < 2 * Dot_Pixel - 1; XDir_Num++) {
-            for (YDir_Num = 0; YDir_Num < 2 * Dot_Pixel - 1; YDir_Num++) {
-                if(Xpoint + XDir_Num - Dot_Pixel < 0 || Ypoint + YDir_Num - Dot_Pixel < 0)
-                    break;
-                // printf("x = %d, y = %d\r\n", Xpoint + XDir_Num - Dot_Pixel, Ypoint + YDir_Num - Dot_Pixel);
-                Paint_SetPixel(Xpoint + XDir_Num - Dot_Pixel, Ypoint + YDir_Num - Dot_Pixel, Color);
-            }
-        }
-    } else {
-        for (XDir_Num = 0; XDir_Num <  Dot_Pixel; XDir_Num++) {
-            for (YDir_Num = 0; YDir_Num <  Dot_Pixel; YDir_Num++) {
-                Paint_SetPixel(Xpoint + XDir_Num - 1, Ypoint + YDir_Num - 1, Color);
-            }
-        }
-    }
+    if (Ctx->Rotate == ROTATE_0 || Ctx->Rotate == ROTATE_180)
+        PaintCtx_PushClip(Ctx, 0, Start, Ctx->Width, End);
+    else
+        PaintCtx_PushClip(Ctx, Start, 0, End, Ctx->Height);
 }
 
 /******************************************************************************
-function: Draw a line of arbitrary slope
+function: Fill pixels X0..X1 (both included) of a 1-bit memory row
 parameter:
-    Xstart ：Starting Xpoint point coordinates
-    Ystart ：Starting Xpoint point coordinates
-    Xend   ：End point Xpoint coordinate
-    Yend   ：End point Ypoint coordinate
-    Color  ：The color of the line segment
-    Line_width : Line width
-    Line_Style: Solid and dotted lines
+    Row  : First byte of the memory row
+    Fill : 0x00 for black, 0xFF for white
 ******************************************************************************/
-void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
-                    UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
+static void Paint_FillRow(UBYTE *Row, UWORD X0, UWORD X1, UBYTE Fill)
 {
-    if (Xstart > Paint.Width || Ystart > Paint.Height ||
-        Xend > Paint.Width || Yend > Paint.Height) {
-        Debug("Paint_DrawLine Input exceeds the normal display range\r\n");
+    UWORD Byte0 = X0 / 8, Byte1 = X1 / 8;
+    UBYTE Mask0 = 0xFF >> (X0 % 8);
+    UBYTE Mask1 = 0xFF << (7 - X1 % 8);
+
+    if (Byte0 == Byte1) {
+        Mask0 &= Mask1;
+        Row[Byte0] = (Row[Byte0] & ~Mask0) | (Fill & Mask0);
         return;
     }
+    Row[Byte0] = (Row[Byte0] & ~Mask0) | (Fill & Mask0);
+    if (Byte1 > Byte0 + 1)
+        memset(Row + Byte0 + 1, Fill, Byte1 - Byte0 - 1);
+    Row[Byte1] = (Row[Byte1] & ~Mask1) | (Fill & Mask1);
+}
 
-    UWORD Xpoint = Xstart;
-    UWORD Ypoint = Ystart;
-    int dx = (int)Xend - (int)Xstart >= 0 ? Xend - Xstart : Xstart - Xend;
-    int dy = (int)Yend - (int)Ystart <= 0 ? Yend - Ystart : Ystart - Yend;
+/******************************************************************************
+function: Attach storage to a sparse plane
+parameter:
+    Sparse   : Plane to initialize
+    RowHead  : One entry per memory row of the image
+    Runs     : Run pool
+    Capacity : Number of runs in the pool, the plane turns dense beyond it
+info:
+    The row count is not known here: the runs are chained and the rows
+    emptied when the plane is attached to an image. Until then the pool
+    hands out no runs.
+******************************************************************************/
+void PaintSparse_Init(PAINT_SPARSE *Sparse, UWORD *RowHead, PAINT_RUN *Runs, UWORD Capacity)
+{
+    Sparse->RowHead = RowHead;
+    Sparse->Runs = Runs;
+    Sparse->Capacity = Capacity;
+    Sparse->Count = 0;
+    Sparse->Free = PAINT_RUN_NONE;
+    Sparse->Dense = NULL;
+}
 
-    // Increment direction, 1 is positive, -1 is counter;
-    int XAddway = Xstart < Xend ? 1 : -1;
-    int YAddway = Ystart < Yend ? 1 : -1;
+static void PaintSparse_Empty(PAINT_SPARSE *Sparse, UWORD Rows)
+{
+    for (UWORD Y = 0; Y < Rows; Y++)
+        Sparse->RowHead[Y] = PAINT_RUN_NONE;
+    //Unused runs are chained through Next
+    for (UWORD i = 0; i < Sparse->Capacity; i++)
+        Sparse->Runs[i].Next = (i + 1 < Sparse->Capacity) ? i + 1 : PAINT_RUN_NONE;
+    Sparse->Free = Sparse->Capacity ? 0 : PAINT_RUN_NONE;
+    Sparse->Count = 0;
+}
 
-    //Cumulative error
-    int Esp = dx + dy;
-    char Dotted_Len = 0;
+static UWORD PaintSparse_Alloc(PAINT_SPARSE *Sparse, UWORD Xstart, UWORD Xend, UWORD Next)
+{
+    UWORD Index = Sparse->Free;
+    if (Index == PAINT_RUN_NONE)
+        return PAINT_RUN_NONE;
+    Sparse->Free = Sparse->Runs[Index].Next;
+    Sparse->Runs[Index].Xstart = Xstart;
+    Sparse->Runs[Index].Xend = Xend;
+    Sparse->Runs[Index].Next = Next;
+    Sparse->Count++;
+    return Index;
+}
 
-    for (;;) {
-        Dotted_Len++;
-        //Painted dotted line, 2 point is really virtual
-        if (Line_Style == LINE_STYLE_DOTTED && Dotted_Len % 3 == 0) {
-            //Debug("LINE_DOTTED\r\n");
-            Paint_DrawPoint(Xpoint, Ypoint, IMAGE_BACKGROUND, Line_width, DOT_STYLE_DFT);
-            Dotted_Len = 0;
-        } else {
-            Paint_DrawPoint(Xpoint, Ypoint, Color, Line_width, DOT_STYLE_DFT);
-        }
-        if (2 * Esp >= dy) {
-            if (Xpoint == Xend)
-                break;
-            Esp += dy;
-            Xpoint += XAddway;
-        }
-        if (2 * Esp <= dx) {
-            if (Ypoint == Yend)
-                break;
-            Esp += dx;
-            Ypoint += YAddway;
-        }
-    }
+static void PaintSparse_Release(PAINT_SPARSE *Sparse, UWORD Index)
+{
+    Sparse->Runs[Index].Next = Sparse->Free;
+    Sparse->Free = Index;
+    Sparse->Count--;
 }
 
 /******************************************************************************
-function: Draw a rectangle
-parameter:
-    Xstart ：Rectangular  Starting Xpoint point coordinates
-    Ystart ：Rectangular  Starting Xpoint point coordinates
-    Xend   ：Rectangular  End point Xpoint coordinate
-    Yend   ：Rectangular  End point Ypoint coordinate
-    Color  ：The color of the Rectangular segment
-    Line_width: Line width
-    Draw_Fill : Whether to fill the inside of the rectangle
+function: Add ink pixels [Xstart, Xend) to a row, merging touching runs
+return:
+    0 if the pool is full
 ******************************************************************************/
-void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
-                         UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+static UBYTE PaintSparse_Set(PAINT_SPARSE *Sparse, UWORD Y, UWORD Xstart, UWORD Xend)
 {
-    if (Xstart > Paint.Width || Ystart > Paint.Height ||
-        Xend > Paint.Width || Yend > Paint.Height) {
-        Debug("Input exceeds the normal display range\r\n");
-        return;
+    PAINT_RUN *Runs = Sparse->Runs;
+    UWORD *Link = &Sparse->RowHead[Y];
+    while (*Link != PAINT_RUN_NONE && Runs[*Link].Xend < Xstart)
+        Link = &Runs[*Link].Next;
+
+    if (*Link == PAINT_RUN_NONE || Runs[*Link].Xstart > Xend) {
+        UWORD Index = PaintSparse_Alloc(Sparse, Xstart, Xend, *Link);
+        if (Index == PAINT_RUN_NONE)
+            return 0;
+        *Link = Index;
+        return 1;
     }
 
-    if (Draw_Fill) {
-        UWORD Ypoint;
-        for(Ypoint = Ystart; Ypoint < Yend; Ypoint++) {
-            Paint_DrawLine(Xstart, Ypoint, Xend, Ypoint, Color , Line_width, LINE_STYLE_SOLID);
-        }
-    } else {
-        Paint_DrawLine(Xstart, Ystart, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
-        Paint_DrawLine(Xstart, Ystart, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
-        Paint_DrawLine(Xend, Yend, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
-        Paint_DrawLine(Xend, Yend, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
+    PAINT_RUN *Run = &Runs[*Link];
+    if (Xstart < Run->Xstart)
+        Run->Xstart = Xstart;
+    if (Xend > Run->Xend)
+        Run->Xend = Xend;
+    while (Run->Next != PAINT_RUN_NONE && Runs[Run->Next].Xstart <= Run->Xend) {
+        UWORD Index = Run->Next;
+        if (Runs[Index].Xend > Run->Xend)
+            Run->Xend = Runs[Index].Xend;
+        Run->Next = Runs[Index].Next;
+        PaintSparse_Release(Sparse, Index);
     }
+    return 1;
 }
 
 /******************************************************************************
-function: Use the 8-point method to draw a circle of the
-            specified size at the specified position->
-parameter:
-    X_Center  ：Center X coordinate
-    Y_Center  ：Center Y coordinate
-    Radius    ：circle Radius
-    Color     ：The color of the ：circle segment
-    Line_width: Line width
-    Draw_Fill : Whether to fill the inside of the Circle
+function: Turn pixels [Xstart, Xend) of a row back to white
+return:
+    0 if a run had to be split and the pool is full
 ******************************************************************************/
-void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
-                      UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+static UBYTE PaintSparse_Erase(PAINT_SPARSE *Sparse, UWORD Y, UWORD Xstart, UWORD Xend)
 {
-    if (X_Center > Paint.Width || Y_Center >= Paint.Height) {
-        Debug("Paint_DrawCircle Input exceeds the normal display range\r\n");
-        return;
-    }
-
-    //Draw a circle from(0, R) as a starting point
-    int16_t XCurrent, YCurrent;
-    XCurrent = 0;
-    YCurrent = Radius;
-
-    //Cumulative error,judge the next point of the logo
-    int16_t Esp = 3 - (Radius << 1 );
-
-    int16_t sCountY;
-    if (Draw_Fill == DRAW_FILL_FULL) {
-        while (XCurrent <= YCurrent ) { //Realistic circles
-            for (sCountY = XCurrent; sCountY <= YCurrent; sCountY ++ ) {
-                Paint_DrawPoint(X_Center + XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//1
-                Paint_DrawPoint(X_Center - XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//2
-                Paint_DrawPoint(X_Center - sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//3
-                Paint_DrawPoint(X_Center - sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//4
-                Paint_DrawPoint(X_Center - XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//5
-                Paint_DrawPoint(X_Center + XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//6
-                Paint_DrawPoint(X_Center + sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//7
-                Paint_DrawPoint(X_Center + sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-            }
-            if (Esp < 0 )
-                Esp += 4 * XCurrent + 6;
-            else {
-                Esp += 10 + 4 * (XCurrent - YCurrent );
-                YCurrent --;
-            }
-            XCurrent ++;
+    PAINT_RUN *Runs = Sparse->Runs;
+    UWORD *Link = &Sparse->RowHead[Y];
+    while (*Link != PAINT_RUN_NONE) {
+        PAINT_RUN *Run = &Runs[*Link];
+        if (Run->Xend <= Xstart) {
+            Link = &Run->Next;
+        } else if (Run->Xstart >= Xend) {
+            break;
+        } else if (Run->Xstart < Xstart && Run->Xend > Xend) {
+            UWORD Index = PaintSparse_Alloc(Sparse, Xend, Run->Xend, Run->Next);
+            if (Index == PAINT_RUN_NONE)
+                return 0;
+            Run->Xend = Xstart;
+            Run->Next = Index;
+            break;
+        } else if (Run->Xstart < Xstart) {
+            Run->Xend = Xstart;
+            Link = &Run->Next;
+        } else if (Run->Xend > Xend) {
+            Run->Xstart = Xend;
+            break;
+        } else {
+            UWORD Index = *Link;
+            *Link = Run->Next;
+            PaintSparse_Release(Sparse, Index);
         }
-    } else { //Draw a hollow circle
-        while (XCurrent <= YCurrent ) {
-            Paint_DrawPoint(X_Center + XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);//1
-            Paint_DrawPoint(X_Center - XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);//2
-            Paint_DrawPoint(X_Center - YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);//3
-            Paint_DrawPoint(X_Center - YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);//4
-            Paint_DrawPoint(X_Center - XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);//5
-            Paint_DrawPoint(X_Center + XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);//6
-            Paint_DrawPoint(X_Center + YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);//7
-            Paint_DrawPoint(X_Center + YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);//0
+    }
+    return 1;
+}
 
-            if (Esp < 0 )
-                Esp += 4 * XCurrent + 6;
-            else {
-                Esp += 10 + 4 * (XCurrent - YCurrent );
-                YCurrent --;
-            }
-            XCurrent ++;
-        }
+/******************************************************************************
+function: Expand memory rows of a sparse plane into 1-bit rows
+******************************************************************************/
+static void PaintSparse_Expand(const PAINT_SPARSE *Sparse, UWORD WidthByte, UWORD Ystart, UWORD Rows, UBYTE *Buffer)
+{
+    memset(Buffer, 0xFF, (UDOUBLE)WidthByte * Rows);
+    for (UWORD Y = 0; Y < Rows; Y++) {
+        UBYTE *Row = Buffer + (UDOUBLE)Y * WidthByte;
+        for (UWORD i = Sparse->RowHead[Ystart + Y]; i != PAINT_RUN_NONE; i = Sparse->Runs[i].Next)
+            Paint_FillRow(Row, Sparse->Runs[i].Xstart, Sparse->Runs[i].Xend - 1, 0x00);
     }
 }
+
 /******************************************************************************
-function: Draw a solid five-pointed star
+function: Replace a sparse plane by a dense image holding the same pixels
 parameter:
-    X_Center  : Center X coordinate
-    Y_Center  : Center Y coordinate
-    Size      : Star size (radius from center to outer point)
-    Color     : Star color
+    Red : 1 for the red plane of a tri-colour image
+return:
+    0 if the dense image cannot be allocated, the plane then stays sparse
 ******************************************************************************/
-void Paint_DrawStar(UWORD X_Center, UWORD Y_Center, UWORD Size, UWORD Color)
+static UBYTE PaintCtx_Densify(PaintContext *Ctx, UBYTE Red)
 {
-    if (X_Center > Paint.Width || Y_Center >= Paint.Height) {
-        Debug("Paint_DrawStar Input exceeds the normal display range\r\n");
-        return;
+    PAINT_SPARSE *Sparse = Red ? Ctx->SparseRed : Ctx->Sparse;
+    UBYTE *Image = (UBYTE *)malloc((UDOUBLE)Ctx->WidthByte * Ctx->HeightMemory);
+    if (Image == NULL) {
+        Debug("Paint sparse plane is full and cannot be made dense\r\n");
+        return 0;
     }
-
-    // Calculate the 5 outer points of the star
-    UWORD points_x[5], points_y[5];
-    for(int i = 0; i < 5; i++) {
-        float angle = i * 72 - 90; // Start at -90 degrees, increment by 72
-        float rad = angle * M_PI / 180;
-        points_x[i] = X_Center + Size * cos(rad);
-        points_y[i] = Y_Center + Size * sin(rad);
+    PaintSparse_Expand(Sparse, Ctx->WidthByte, 0, Ctx->HeightMemory, Image);
+    Sparse->Dense = Image;
+    if (Red) {
+        Ctx->ImageRed = Image;
+        Ctx->SparseRed = NULL;
+    } else {
+        Ctx->Image = Image;
+        Ctx->Sparse = NULL;
     }
+    return 1;
+}
 
-    // Calculate inner points of the star
-    UWORD inner_x[5], inner_y[5];
-    float inner_size = Size * 0.382; // Golden ratio for classic star shape
-    for(int i = 0; i < 5; i++) {
-        float angle = (i * 72 + 36) - 90; // Offset by 36 degrees
-        float rad = angle * M_PI / 180;
-        inner_x[i] = X_Center + inner_size * cos(rad);
-        inner_y[i] = Y_Center + inner_size * sin(rad);
-    }
+/******************************************************************************
+function: Bytes written for a color into the black and the red plane
+info:
+    Without a red plane RED is drawn as BLACK, as on a two-colour panel.
+    On a tri-colour image RED clears the black plane and sets the red
+    one, BLACK and WHITE clear the red plane.
+******************************************************************************/
+static UBYTE PaintCtx_BlackFill(const PaintContext *Ctx, UWORD Color)
+{
+    return (Color == BLACK || (Color == RED && !Ctx->TriColor)) ? 0x00 : 0xFF;
+}
 
-    // Draw the filled star by drawing triangles
-    for(int i = 0; i < 5; i++) {
-        int next = (i + 1) % 5;
-        // Draw triangle between outer points and center
-        Paint_DrawLine(points_x[i], points_y[i], points_x[next], points_y[next], Color, DOT_PIXEL_1X1, LINE_STYLE_SOLID);
-        Paint_DrawLine(points_x[i], points_y[i], inner_x[i], inner_y[i], Color, DOT_PIXEL_1X1, LINE_STYLE_SOLID);
-        Paint_DrawLine(points_x[next], points_y[next], inner_x[i], inner_y[i], Color, DOT_PIXEL_1X1, LINE_STYLE_SOLID);
-        Paint_DrawLine(X_Center, Y_Center, inner_x[i], inner_y[i], Color, DOT_PIXEL_1X1, LINE_STYLE_SOLID);
-    }
+static UBYTE Paint_RedFill(UWORD Color)
+{
+    return (Color == RED) ? 0x00 : 0xFF;
 }
+
 /******************************************************************************
-function: Show English characters
+function: Write memory pixels [Xstart, Xend) of row Y into one plane
 parameter:
-    Xpoint           ：X coordinate
-    Ypoint           ：Y coordinate
-    Acsii_Char       ：To display the English characters
-    Font             ：A structure pointer that displays a character size
-    Color_Foreground : Select the foreground color
-    Color_Background : Select the background color
+    Red  : 1 for the red plane
+    Fill : 0x00 or 0xFF
+info:
+    Dense planes are written a byte at a time, sparse planes get or lose
+    a run. Planes without storage (the other plane of a strip) are skipped.
 ******************************************************************************/
-void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
-                    sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+static void PaintCtx_PlaneSpan(PaintContext *Ctx, UBYTE Red, UWORD Xstart, UWORD Xend, UWORD Y, UBYTE Fill)
 {
-    UWORD Page, Column;
-
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
-        Debug("Paint_DrawChar Input exceeds the normal display range\r\n");
-        return;
+    PAINT_SPARSE *Sparse = Red ? Ctx->SparseRed : Ctx->Sparse;
+    if (Sparse) {
+        UBYTE Done = Fill ? PaintSparse_Erase(Sparse, Y, Xstart, Xend)
+                          : PaintSparse_Set(Sparse, Y, Xstart, Xend);
+        //Out of runs: drop the span only if no dense image can be had
+        if (Done || !PaintCtx_Densify(Ctx, Red))
+            return;
     }
-
-    uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
-    const unsigned char *ptr = &Font->table[Char_Offset];
-
-    for (Page = 0; Page < Font->Height; Page ++ ) {
-        for (Column = 0; Column < Font->Width; Column ++ ) {
-
-            //To determine whether the font background color and screen background color is consistent
-            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                if (*ptr & (0x80 >> (Column % 8)))
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
-                    // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-            } else {
-                if (*ptr & (0x80 >> (Column % 8))) {
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
-                    // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                } else {
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Background);
-                    // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                }
-            }
-            //One pixel is 8 bits
-            if (Column % 8 == 7)
-                ptr++;
-        }// Write a line
-        if (Font->Width % 8 != 0)
-            ptr++;
-    }// Write all
+    UBYTE *Image = Red ? Ctx->ImageRed : Ctx->Image;
+    if (Image)
+        Paint_FillRow(Image + (UDOUBLE)(Y - Ctx->BandStart) * Ctx->WidthByte, Xstart, Xend - 1, Fill);
 }
 
 /******************************************************************************
-function:	Display the string
+function: Write a span of memory row Y into every plane of a 1-bit image
+parameter:
+    Xstart : Memory x starting point
+    Xend   : Memory x end point (not included)
+    Y      : Memory row
+    Color  : WHITE, BLACK or RED
+******************************************************************************/
+static void PaintCtx_Span(PaintContext *Ctx, UWORD Xstart, UWORD Xend, UWORD Y, UWORD Color)
+{
+    PaintCtx_PlaneSpan(Ctx, 0, Xstart, Xend, Y, PaintCtx_BlackFill(Ctx, Color));
+    if (Ctx->TriColor)
+        PaintCtx_PlaneSpan(Ctx, 1, Xstart, Xend, Y, Paint_RedFill(Color));
+}
+
+/******************************************************************************
+function: 2-bit code written for a color into a scale 4 image
+******************************************************************************/
+static UBYTE PaintCtx_Code4(const PaintContext *Ctx, UWORD Color)
+{
+    if (Color == RED)
+        return Ctx->TriColor ? PACKED_RED : BLACK;
+    return Color % 4;//Guaranteed color scale is 4  --- 0~3
+}
+
+/******************************************************************************
+function: Clear the red plane of a tri-colour image
+******************************************************************************/
+static void PaintCtx_ClearRed(PaintContext *Ctx, UBYTE Fill)
+{
+    if (Ctx->SparseRed) {
+        if (Fill == 0xFF) {
+            PaintSparse_Empty(Ctx->SparseRed, Ctx->HeightMemory);
+            return;
+        }
+        if (!PaintCtx_Densify(Ctx, 1))
+            return;
+    }
+    if (Ctx->ImageRed)
+        memset(Ctx->ImageRed, Fill, (UDOUBLE)Ctx->BandHeight * Ctx->WidthByte);
+}
+
+/******************************************************************************
+function: Attach a red plane, making the image tri-colour
+parameter:
+    image  : Dense red plane, the same size as the image
+    Sparse : Or a sparse red plane initialized by PaintSparse_Init
+info:
+    Both may be NULL for a context that only describes a tri-colour image
+    rendered strip by strip. A sparse plane starts out empty, a dense one
+    is cleared along with the black plane by PaintCtx_Clear.
+    A 2-bit image (scale 4) needs no red plane: with both NULL it becomes
+    a packed tri-colour image where RED is stored as PACKED_RED, and
+    ReadRows/ReadRedRows split the two planes out of it.
+******************************************************************************/
+void PaintCtx_SetRedImage(PaintContext *Ctx, UBYTE *image, PAINT_SPARSE *Sparse)
+{
+    Ctx->ImageRed = image;
+    Ctx->SparseRed = Sparse;
+    if (Sparse)
+        PaintSparse_Empty(Sparse, Ctx->HeightMemory);
+    Ctx->TriColor = 1;
+}
+
+/******************************************************************************
+function: Attach storage to a glyph cache
+parameter:
+    Cache : Cache to initialize, empty
+    Slots : Storage for Count decoded glyphs, about 136 bytes each
+    Count : Number of slots; a handful covers the digits of a readout
+******************************************************************************/
+void PaintGlyphCache_Init(PAINT_GLYPH_CACHE *Cache, PAINT_GLYPH_SLOT *Slots, UWORD Count)
+{
+    Cache->Slots = Slots;
+    Cache->Count = Count;
+    Cache->Clock = 0;
+    Cache->Hits = 0;
+    Cache->Misses = 0;
+    for (UWORD i = 0; i < Count; i++) {
+        Slots[i].Source = NULL;
+        Slots[i].Used = 0;
+        Slots[i].Form = GLYPH_FORM_ROWS;
+    }
+}
+
+/******************************************************************************
+function: Keep the glyphs of FONT_ENCODING_ROWS fonts decoded in a cache
+parameter:
+    Cache : Initialized by PaintGlyphCache_Init, or NULL to decode the
+            glyph every time it is drawn
+******************************************************************************/
+void PaintCtx_SetGlyphCache(PaintContext *Ctx, PAINT_GLYPH_CACHE *Cache)
+{
+    Ctx->GlyphCache = Cache;
+}
+
+/******************************************************************************
+function: Attach storage to a text-run cache
+parameter:
+    Cache      : Cache to initialize, empty
+    Runs       : Count run descriptors
+    Pool       : Storage for the bitmaps; a run takes Height rows of
+                 (Width + 31) / 32 words, plus its string. The first Count
+                 words keep the keys of runs seen once.
+    Pool_Bytes : Size of Pool
+******************************************************************************/
+void PaintTextCache_Init(PAINT_TEXT_CACHE *Cache, PAINT_TEXT_RUN *Runs, UWORD Count, UDOUBLE *Pool, UDOUBLE Pool_Bytes)
+{
+    UDOUBLE Words = Pool_Bytes / 4;
+    Cache->Runs = Runs;
+    Cache->Count = Count;
+    Cache->Seen = Pool;
+    Cache->SeenCount = Count < Words ? Count : Words;
+    Cache->SeenNext = 0;
+    memset(Cache->Seen, 0, Cache->SeenCount * 4);
+    Cache->Pool = Pool + Cache->SeenCount;
+    Cache->PoolWords = Words - Cache->SeenCount;
+    Cache->PoolUsed = 0;
+    Cache->Clock = 0;
+    Cache->Hits = 0;
+    Cache->Misses = 0;
+    Cache->Evictions = 0;
+    Cache->Bypassed = 0;
+    Cache->Declined = 0;
+    Cache->PeakBytes = 0;
+    memset(Runs, 0, Count * sizeof(PAINT_TEXT_RUN));
+}
+
+/******************************************************************************
+function: Blit strings drawn before from a text-run cache
+parameter:
+    Cache : Initialized by PaintTextCache_Init, or NULL to draw every
+            string glyph by glyph
+info:
+    Used for strings and text box lines on 1-bit images at ROTATE_0, or at
+    ROTATE_180 with MIRROR_HORIZONTAL; the cache belongs to this context
+    only.
+******************************************************************************/
+void PaintCtx_SetTextCache(PaintContext *Ctx, PAINT_TEXT_CACHE *Cache)
+{
+    Ctx->TextCache = Cache;
+}
+
+/******************************************************************************
+function: Create a sparse image
+parameter:
+    Sparse : Plane initialized by PaintSparse_Init, with Height row heads
+    Width, Height, Rotate, Color : As for PaintCtx_NewImage
+info:
+    Sparse images are 1 bit per pixel and start out white; Color only
+    sets the image color used to clear strips and dirty regions.
+******************************************************************************/
+void PaintCtx_NewSparseImage(PaintContext *Ctx, PAINT_SPARSE *Sparse, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color)
+{
+    PaintCtx_NewImage(Ctx, NULL, Width, Height, Rotate, Color);
+    PaintSparse_Empty(Sparse, Height);
+    Ctx->Sparse = Sparse;
+}
+
+/******************************************************************************
+function: Gather the bits at even positions of a word into its low half
+******************************************************************************/
+static UDOUBLE Paint_GatherEven(UDOUBLE Bits)
+{
+    Bits &= 0x55555555;
+    Bits = (Bits | (Bits >> 1)) & 0x33333333;
+    Bits = (Bits | (Bits >> 2)) & 0x0F0F0F0F;
+    Bits = (Bits | (Bits >> 4)) & 0x00FF00FF;
+    Bits = (Bits | (Bits >> 8)) & 0x0000FFFF;
+    return Bits;
+}
+
+/******************************************************************************
+function: Split one row of a packed tri-colour image into a 1-bit plane
+parameter:
+    Packed : Row of 2-bit codes
+    Pixels : Pixels in the row
+    Red    : 1 for the red plane, 0 for the black one
+    Plane  : Receives (Pixels + 7) / 8 bytes, bit 1 = white
+info:
+    16 pixels are split at a time: with h and l the bits of a code, the
+    black plane keeps h | l (only PACKED_BLACK is 00) and the red plane
+    h | ~l (only PACKED_RED is 01). Both land on the low bit of each
+    pair, which is then gathered into two bytes.
+******************************************************************************/
+static void Paint_SplitPacked(const UBYTE *Packed, UWORD Pixels, UBYTE Red, UBYTE *Plane)
+{
+    UWORD X = 0;
+    for (; X + 16 <= Pixels; X += 16, Packed += 4) {
+        UDOUBLE Word = ((UDOUBLE)Packed[0] << 24) | ((UDOUBLE)Packed[1] << 16) |
+                       ((UDOUBLE)Packed[2] << 8) | Packed[3];
+        UDOUBLE Bits = Paint_GatherEven((Word >> 1) | (Red ? ~Word : Word));
+        *Plane++ = Bits >> 8;
+        *Plane++ = Bits;
+    }
+    //Leftover pixels one at a time, the padding bits stay white
+    for (UWORD i = 0; X < Pixels; X++, i++) {
+        UBYTE Code = (Packed[i / 4] >> (6 - (i % 4) * 2)) & 0x03;
+        if (i % 8 == 0)
+            Plane[i / 8] = 0xFF;
+        if (Code == (Red ? PACKED_RED : PACKED_BLACK))
+            Plane[i / 8] &= ~(0x80 >> (i % 8));
+    }
+}
+
+/******************************************************************************
+function: Copy memory rows of the image, whatever its storage
+parameter:
+    Ystart : First memory row
+    Rows   : Number of rows
+    Buffer : Receives Rows * WidthByte bytes, ready to be sent to the panel
+info:
+    ReadRows reads the black plane, ReadRedRows the red plane of a
+    tri-colour image; a plane without storage reads as white. The planes
+    of a packed image are split out of it, Buffer then holds rows of
+    (WidthMemory + 7) / 8 bytes.
+******************************************************************************/
+static void PaintCtx_ReadPlane(PaintContext *Ctx, UBYTE Red, UWORD Ystart, UWORD Rows, UBYTE *Buffer)
+{
+    PAINT_SPARSE *Sparse = Red ? Ctx->SparseRed : Ctx->Sparse;
+    UBYTE *Image = Red ? Ctx->ImageRed : Ctx->Image;
+    if (Ctx->Scale == 4 && Ctx->Image) {
+        UWORD Plane_Bytes = (Ctx->WidthMemory + 7) / 8;
+        for (UWORD y = 0; y < Rows; y++)
+            Paint_SplitPacked(Ctx->Image + (UDOUBLE)(Ystart + y - Ctx->BandStart) * Ctx->WidthByte,
+                              Ctx->WidthMemory, Red, Buffer + (UDOUBLE)y * Plane_Bytes);
+    } else if (Sparse)
+        PaintSparse_Expand(Sparse, Ctx->WidthByte, Ystart, Rows, Buffer);
+    else if (Image)
+        memcpy(Buffer, Image + (UDOUBLE)(Ystart - Ctx->BandStart) * Ctx->WidthByte,
+               (UDOUBLE)Rows * Ctx->WidthByte);
+    else
+        memset(Buffer, 0xFF, (UDOUBLE)Rows * Ctx->WidthByte);
+}
+
+void PaintCtx_ReadRows(PaintContext *Ctx, UWORD Ystart, UWORD Rows, UBYTE *Buffer)
+{
+    PaintCtx_ReadPlane(Ctx, 0, Ystart, Rows, Buffer);
+}
+
+void PaintCtx_ReadRedRows(PaintContext *Ctx, UWORD Ystart, UWORD Rows, UBYTE *Buffer)
+{
+    PaintCtx_ReadPlane(Ctx, 1, Ystart, Rows, Buffer);
+}
+
+/******************************************************************************
+function: Write a pixel that is known to be inside the clip window
+parameter:
+    Xpoint : At point X
+    Ypoint : At point Y
+    Color  : Painted colors
+******************************************************************************/
+static void PaintCtx_PutPixel(PaintContext *Ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    UWORD X, Y;
+    switch(Ctx->Rotate) {
+    case 0:
+        X = Xpoint;
+        Y = Ypoint;  
+        break;
+    case 90:
+        X = Ctx->WidthMemory - Ypoint - 1;
+        Y = Xpoint;
+        break;
+    case 180:
+        X = Ctx->WidthMemory - Xpoint - 1;
+        Y = Ctx->HeightMemory - Ypoint - 1;
+        break;
+    case 270:
+        X = Ypoint;
+        Y = Ctx->HeightMemory - Xpoint - 1;
+        break;
+    default:
+        return;
+    }
+    
+    switch(Ctx->Mirror) {
+    case MIRROR_NONE:
+        break;
+    case MIRROR_HORIZONTAL:
+        X = Ctx->WidthMemory - X - 1;
+        break;
+    case MIRROR_VERTICAL:
+        Y = Ctx->HeightMemory - Y - 1;
+        break;
+    case MIRROR_ORIGIN:
+        X = Ctx->WidthMemory - X - 1;
+        Y = Ctx->HeightMemory - Y - 1;
+        break;
+    default:
+        return;
+    }
+
+    if(Ctx->Scale == 2){
+        PaintCtx_Span(Ctx, X, X + 1, Y, Color);
+        return;
+    }
+    Y -= Ctx->BandStart;
+    if(Ctx->Scale == 4){
+        UDOUBLE Addr = X / 4 + Y * Ctx->WidthByte;
+        Color = PaintCtx_Code4(Ctx, Color);
+        UBYTE Rdata = Ctx->Image[Addr];
+        
+        Rdata = Rdata & (~(0xC0 >> ((X % 4)*2)));
+        Ctx->Image[Addr] = Rdata | ((Color << 6) >> ((X % 4)*2));
+    }else if(Ctx->Scale == 7 || Ctx->Scale == 16){
+		UDOUBLE Addr = X / 2  + Y * Ctx->WidthByte;
+		if (Color == RED)
+			Color = BLACK;
+		UBYTE Rdata = Ctx->Image[Addr];
+		Rdata = Rdata & (~(0xF0 >> ((X % 2)*4)));//Clear first, then set value
+		Ctx->Image[Addr] = Rdata | ((Color << 4) >> ((X % 2)*4));
+		// printf("Add =  %d ,data = %d\r\n",Addr,Rdata);	
+    }
+}
+
+/******************************************************************************
+function: Draw Pixels
+parameter:
+    Xpoint : At point X
+    Ypoint : At point Y
+    Color  : Painted colors
+info:
+    Pixels outside the clip window are dropped silently.
+******************************************************************************/
+void PaintCtx_SetPixel(PaintContext *Ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    const PAINT_RECT *Clip = &Ctx->Clip[Ctx->ClipDepth];
+    if (Xpoint < Clip->Xstart || Xpoint >= Clip->Xend ||
+        Ypoint < Clip->Ystart || Ypoint >= Clip->Yend)
+        return;
+    PaintCtx_PutPixel(Ctx, Xpoint, Ypoint, Color);
+}
+
+/******************************************************************************
+function: Fill a horizontal run of pixels on one row
+parameter:
+    Xstart : x starting point
+    Xend   : x end point (not included)
+    Ypoint : row
+    Color  : Painted colors
+info:
+    The run is clipped once against the clip window. For ROTATE_0/180 at
+    scale 2 and 4 the row is contiguous in memory, so the span is written
+    a byte at a time with edge masks.
+******************************************************************************/
+static void PaintCtx_FillSpan(PaintContext *Ctx, int Xstart, int Xend, int Ypoint, UWORD Color)
+{
+    const PAINT_RECT *Clip = &Ctx->Clip[Ctx->ClipDepth];
+    if (Xstart < Clip->Xstart)
+        Xstart = Clip->Xstart;
+    if (Xend > Clip->Xend)
+        Xend = Clip->Xend;
+    if (Xstart >= Xend || Ypoint < Clip->Ystart || Ypoint >= Clip->Yend)
+        return;
+
+    if ((Ctx->Scale != 2 && Ctx->Scale != 4) || (Ctx->Rotate != ROTATE_0 && Ctx->Rotate != ROTATE_180)) {
+        for (int X = Xstart; X < Xend; X++)
+            PaintCtx_PutPixel(Ctx, X, Ypoint, Color);
+        return;
+    }
+
+    //Map the span into memory space; 180 and mirroring only flip the axes
+    int X0 = Xstart, X1 = Xend - 1, Y = Ypoint;
+    UBYTE Flip_X = (Ctx->Rotate == ROTATE_180) ^ ((Ctx->Mirror & MIRROR_HORIZONTAL) ? 1 : 0);
+    UBYTE Flip_Y = (Ctx->Rotate == ROTATE_180) ^ ((Ctx->Mirror & MIRROR_VERTICAL) ? 1 : 0);
+    if (Flip_X) {
+        X0 = Ctx->WidthMemory - 1 - (Xend - 1);
+        X1 = Ctx->WidthMemory - 1 - Xstart;
+    }
+    if (Flip_Y)
+        Y = Ctx->HeightMemory - 1 - Ypoint;
+
+    if (Ctx->Scale == 4) {
+        //Two bits per pixel: the same row fill works on bit positions
+        UBYTE *Row = Ctx->Image + (UDOUBLE)(Y - Ctx->BandStart) * Ctx->WidthByte;
+        Paint_FillRow(Row, X0 * 2, X1 * 2 + 1, PaintCtx_Code4(Ctx, Color) * 0x55);
+        return;
+    }
+    PaintCtx_Span(Ctx, X0, X1 + 1, Y, Color);
+}
+
+/******************************************************************************
+function: Fill a rectangle of pixels, clipped to the clip window
+parameter:
+    Xstart : x starting point
+    Ystart : Y starting point
+    Xend   : x end point (not included)
+    Yend   : y end point (not included)
+    Color  : Painted colors
+******************************************************************************/
+static void PaintCtx_FillRect(PaintContext *Ctx, int Xstart, int Ystart, int Xend, int Yend, UWORD Color)
+{
+    const PAINT_RECT *Clip = &Ctx->Clip[Ctx->ClipDepth];
+    if (Ystart < Clip->Ystart)
+        Ystart = Clip->Ystart;
+    if (Yend > Clip->Yend)
+        Yend = Clip->Yend;
+    for (int Y = Ystart; Y < Yend; Y++)
+        PaintCtx_FillSpan(Ctx, Xstart, Xend, Y, Color);
+}
+
+/******************************************************************************
+function: Clear the color of the picture
+parameter:
+    Color : Painted colors
+******************************************************************************/
+void PaintCtx_Clear(PaintContext *Ctx, UWORD Color)
+{
+    if (Ctx->TriColor)
+        PaintCtx_ClearRed(Ctx, Paint_RedFill(Color));
+    if (Ctx->Scale == 4)
+        Color = PaintCtx_Code4(Ctx, Color);
+    else if (Color == RED)
+        Color = PaintCtx_BlackFill(Ctx, Color);
+    if (Ctx->Sparse) {
+        if (Color == WHITE) {
+            PaintSparse_Empty(Ctx->Sparse, Ctx->HeightMemory);
+            return;
+        }
+        if (!PaintCtx_Densify(Ctx, 0))
+            return;
+    }
+    if (Ctx->Image == NULL)
+        return;
+    if(Ctx->Scale == 2) {
+		for (UWORD Y = 0; Y < Ctx->BandHeight; Y++) {
+			for (UWORD X = 0; X < Ctx->WidthByte; X++ ) {//8 pixel =  1 byte
+				UDOUBLE Addr = X + Y*Ctx->WidthByte;
+				Ctx->Image[Addr] = Color;
+			}
+		}
+    }else if(Ctx->Scale == 4) {
+        for (UWORD Y = 0; Y < Ctx->BandHeight; Y++) {
+            for (UWORD X = 0; X < Ctx->WidthByte; X++ ) {
+                UDOUBLE Addr = X + Y*Ctx->WidthByte;
+                Ctx->Image[Addr] = (Color<<6)|(Color<<4)|(Color<<2)|Color;
+            }
+        }
+    }else if(Ctx->Scale == 7 || Ctx->Scale == 16) {
+		for (UWORD Y = 0; Y < Ctx->BandHeight; Y++) {
+			for (UWORD X = 0; X < Ctx->WidthByte; X++ ) {
+				UDOUBLE Addr = X + Y*Ctx->WidthByte;
+				Ctx->Image[Addr] = (Color<<4)|Color;
+			}
+		}		
+	}
+}
+
+/******************************************************************************
+function: Clear the color of a window
+parameter:
+    Xstart : x starting point
+    Ystart : Y starting point
+    Xend   : x end point
+    Yend   : y end point
+    Color  : Painted colors
+******************************************************************************/
+void PaintCtx_ClearWindows(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+{
+    PaintCtx_FillRect(Ctx, Xstart, Ystart, Xend, Yend, Color);
+}
+
+/******************************************************************************
+function: Draw Point(Xpoint, Ypoint) Fill the color
+parameter:
+    Xpoint		: The Xpoint coordinate of the point
+    Ypoint		: The Ypoint coordinate of the point
+    Color		: Painted color
+    Dot_Pixel	: point size
+    Dot_Style	: point Style
+info:
+    The dot is a square; it is intersected with the clip window and
+    filled span by span.
+******************************************************************************/
+void PaintCtx_DrawPoint(PaintContext *Ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color,
+                     DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
+{
+    if (Dot_Style == DOT_FILL_AROUND) {
+        PaintCtx_FillRect(Ctx, Xpoint - Dot_Pixel, Ypoint - Dot_Pixel,
+                       Xpoint + Dot_Pixel - 1, Ypoint + Dot_Pixel - 1, Color);
+    } else {
+        PaintCtx_FillRect(Ctx, Xpoint - 1, Ypoint - 1,
+                       Xpoint + Dot_Pixel - 1, Ypoint + Dot_Pixel - 1, Color);
+    }
+}
+
+/******************************************************************************
+function: Minor-axis steps of a line after a number of major-axis steps
+parameter:
+    Major   : Steps of the line along its major axis
+    Minor   : Steps of the line along its minor axis
+    Step    : Major-axis steps walked
+    X_Major : 1 if the major axis is x
+info:
+    The walk in PaintCtx_DrawLine tests the y step on the error that the
+    x step has already updated, so the two cases are not symmetrical: an
+    x-major line may take its first y step one step late.
+******************************************************************************/
+static int Paint_LineMinor(int Major, int Minor, int Step, UBYTE X_Major)
+{
+    if (Minor == 0)
+        return 0;
+    if (!X_Major)
+        return (int)(((int64_t)2 * Step * Minor + Major) / (2 * Major));
+    int Count = (int)(((int64_t)2 * (Step + 1) * Minor + Major) / (2 * Major));
+    return Count < Step ? Count : Step;
+}
+
+/******************************************************************************
+function: First major-axis step of a line after which Count minor-axis
+          steps have been walked
+parameter:
+    Major   : Steps of the line along its major axis
+    Minor   : Steps of the line along its minor axis
+    Count   : Minor-axis steps
+    X_Major : 1 if the major axis is x
+return:
+    Major + 1 if the line never gets that far
+******************************************************************************/
+static int Paint_LineFirst(int Major, int Minor, int Count, UBYTE X_Major)
+{
+    if (Count <= 0)
+        return 0;
+    if (Minor == 0 || Count > Minor + 1)
+        return Major + 1;
+    //The inverse of Paint_LineMinor, rounded up. Minor + 1 steps are where
+    //an x-major walk stops short of its end point.
+    int64_t Need = (int64_t)2 * Major * Count - Major - (X_Major ? 2 * Minor : 0);
+    int Step = Need <= 0 ? 0 : (int)((Need + 2 * Minor - 1) / (2 * Minor));
+    return X_Major && Step < Count ? Count : Step;
+}
+
+/******************************************************************************
+function: Draw a line of arbitrary slope
+parameter:
+    Xstart ：Starting Xpoint point coordinates
+    Ystart ：Starting Xpoint point coordinates
+    Xend   ：End point Xpoint coordinate
+    Yend   ：End point Ypoint coordinate
+    Color  ：The color of the line segment
+    Line_width : Line width
+    Line_Style: Solid and dotted lines
+info:
+    The steps whose dot reaches the clip window are worked out from the
+    line before walking it. The walk starts at the first of them with the
+    error and dotted phase it has there, so a clipped line lights exactly
+    the pixels of the whole line.
+******************************************************************************/
+void PaintCtx_DrawLine(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                    UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
+{
+    int dx = (int)Xend - (int)Xstart >= 0 ? Xend - Xstart : Xstart - Xend;
+    int dy = (int)Yend - (int)Ystart <= 0 ? Yend - Ystart : Ystart - Yend;
+
+    // Increment direction, 1 is positive, -1 is counter;
+    int XAddway = Xstart < Xend ? 1 : -1;
+    int YAddway = Ystart < Yend ? 1 : -1;
+
+    //A dot at (x, y) covers [x - Line_width, x + Line_width - 2], so only
+    //the dots in [Xmin, Xmax] x [Ymin, Ymax] reach the clip window
+    const PAINT_RECT *Clip = &Ctx->Clip[Ctx->ClipDepth];
+    int Xmin = Clip->Xstart - Line_width + 2, Xmax = Clip->Xend + Line_width - 1;
+    int Ymin = Clip->Ystart - Line_width + 2, Ymax = Clip->Yend + Line_width - 1;
+    int X_In = XAddway > 0 ? Xmin - Xstart : Xstart - Xmax;
+    int X_Out = XAddway > 0 ? Xmax - Xstart : Xstart - Xmin;
+    int Y_In = YAddway > 0 ? Ymin - Ystart : Ystart - Ymax;
+    int Y_Out = YAddway > 0 ? Ymax - Ystart : Ystart - Ymin;
+
+    //Steps along the major axis inside the window on both axes
+    UBYTE X_Major = dx >= -dy;
+    int Major = X_Major ? dx : -dy, Minor = X_Major ? -dy : dx;
+    int Step_In = X_Major ? X_In : Y_In, Step_Out = X_Major ? X_Out : Y_Out;
+    int Minor_In = X_Major ? Y_In : X_In, Minor_Out = X_Major ? Y_Out : X_Out;
+    if (Minor_Out > Minor)
+        Minor_Out = Minor;
+    int First = Paint_LineFirst(Major, Minor, Minor_In, X_Major);
+    int Last = Paint_LineFirst(Major, Minor, Minor_Out + 1, X_Major) - 1;
+    if (Step_In < First)
+        Step_In = First;
+    if (Step_Out > Last)
+        Step_Out = Last;
+    if (Step_Out > Major)
+        Step_Out = Major;
+    if (Step_In > Step_Out)
+        return;
+
+    //Cumulative error, advanced to Step_In: each x step adds dy, each y step dx
+    int Minor_Steps = Paint_LineMinor(Major, Minor, Step_In, X_Major);
+    int X_Steps = X_Major ? Step_In : Minor_Steps;
+    int Y_Steps = X_Major ? Minor_Steps : Step_In;
+    int Xpoint = Xstart + X_Steps * XAddway;
+    int Ypoint = Ystart + Y_Steps * YAddway;
+    int Esp = dx + dy + (int)((int64_t)X_Steps * dy + (int64_t)Y_Steps * dx);
+    char Dotted_Len = Step_In % 3;
+
+    for (int Step = Step_In; Step <= Step_Out; Step++) {
+        Dotted_Len++;
+        //Painted dotted line, 2 point is really virtual
+        if (Line_Style == LINE_STYLE_DOTTED && Dotted_Len % 3 == 0) {
+            //Debug("LINE_DOTTED\r\n");
+            PaintCtx_DrawPoint(Ctx, Xpoint, Ypoint, IMAGE_BACKGROUND, Line_width, DOT_STYLE_DFT);
+            Dotted_Len = 0;
+        } else if (Line_width == DOT_PIXEL_1X1) {
+            PaintCtx_PutPixel(Ctx, Xpoint - 1, Ypoint - 1, Color);
+        } else {
+            PaintCtx_DrawPoint(Ctx, Xpoint, Ypoint, Color, Line_width, DOT_STYLE_DFT);
+        }
+        if (2 * Esp >= dy) {
+            if (Xpoint == Xend)
+                break;
+            Esp += dy;
+            Xpoint += XAddway;
+        }
+        if (2 * Esp <= dx) {
+            if (Ypoint == Yend)
+                break;
+            Esp += dx;
+            Ypoint += YAddway;
+        }
+    }
+}
+
+/******************************************************************************
+function: Draw a rectangle
+parameter:
+    Xstart ：Rectangular  Starting Xpoint point coordinates
+    Ystart ：Rectangular  Starting Xpoint point coordinates
+    Xend   ：Rectangular  End point Xpoint coordinate
+    Yend   ：Rectangular  End point Ypoint coordinate
+    Color  ：The color of the Rectangular segment
+    Line_width: Line width
+    Draw_Fill : Whether to fill the inside of the rectangle
+******************************************************************************/
+void PaintCtx_DrawRectangle(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                         UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    if (Draw_Fill) {
+        //Same pixels as one line per row from Ystart to Yend - 1
+        if (Yend > Ystart)
+            PaintCtx_FillRect(Ctx, Xstart - Line_width, Ystart - Line_width,
+                           Xend + Line_width - 1, Yend + Line_width - 2, Color);
+    } else {
+        PaintCtx_DrawLine(Ctx, Xstart, Ystart, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
+        PaintCtx_DrawLine(Ctx, Xstart, Ystart, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
+        PaintCtx_DrawLine(Ctx, Xend, Yend, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
+        PaintCtx_DrawLine(Ctx, Xend, Yend, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
+    }
+}
+
+/******************************************************************************
+function: Use the 8-point method to draw a circle of the
+            specified size at the specified position->
+parameter:
+    X_Center  ：Center X coordinate
+    Y_Center  ：Center Y coordinate
+    Radius    ：circle Radius
+    Color     ：The color of the ：circle segment
+    Line_width: Line width
+    Draw_Fill : Whether to fill the inside of the Circle
+******************************************************************************/
+void PaintCtx_DrawCircle(PaintContext *Ctx, UWORD X_Center, UWORD Y_Center, UWORD Radius,
+                      UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    //Draw a circle from(0, R) as a starting point
+    int16_t XCurrent, YCurrent;
+    XCurrent = 0;
+    YCurrent = Radius;
+
+    //Cumulative error,judge the next point of the logo
+    int16_t Esp = 3 - (Radius << 1 );
+
+    if (Draw_Fill == DRAW_FILL_FULL) {
+        //Rows +-XCurrent span +-YCurrent, rows +-YCurrent span +-XCurrent.
+        //Dots of size 1 land one pixel up and left of their coordinate.
+        int Xc = X_Center - 1, Yc = Y_Center - 1;
+        while (XCurrent <= YCurrent ) { //Realistic circles
+            PaintCtx_FillSpan(Ctx, Xc - YCurrent, Xc + YCurrent + 1, Yc + XCurrent, Color);
+            PaintCtx_FillSpan(Ctx, Xc - YCurrent, Xc + YCurrent + 1, Yc - XCurrent, Color);
+            PaintCtx_FillSpan(Ctx, Xc - XCurrent, Xc + XCurrent + 1, Yc + YCurrent, Color);
+            PaintCtx_FillSpan(Ctx, Xc - XCurrent, Xc + XCurrent + 1, Yc - YCurrent, Color);
+            if (Esp < 0 )
+                Esp += 4 * XCurrent + 6;
+            else {
+                Esp += 10 + 4 * (XCurrent - YCurrent );
+                YCurrent --;
+            }
+            XCurrent ++;
+        }
+    } else { //Draw a hollow circle
+        while (XCurrent <= YCurrent ) {
+            PaintCtx_DrawPoint(Ctx, X_Center + XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);//1
+            PaintCtx_DrawPoint(Ctx, X_Center - XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);//2
+            PaintCtx_DrawPoint(Ctx, X_Center - YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);//3
+            PaintCtx_DrawPoint(Ctx, X_Center - YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);//4
+            PaintCtx_DrawPoint(Ctx, X_Center - XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);//5
+            PaintCtx_DrawPoint(Ctx, X_Center + XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);//6
+            PaintCtx_DrawPoint(Ctx, X_Center + YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);//7
+            PaintCtx_DrawPoint(Ctx, X_Center + YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);//0
+
+            if (Esp < 0 )
+                Esp += 4 * XCurrent + 6;
+            else {
+                Esp += 10 + 4 * (XCurrent - YCurrent );
+                YCurrent --;
+            }
+            XCurrent ++;
+        }
+    }
+}
+/******************************************************************************
+function: Fill a polygon with a scanline active-edge-table rasterizer
+parameter:
+    Points    : Polygon vertices, the last point connects back to the first
+    Count     : Number of vertices (3 - POLYGON_MAX_EDGES)
+    Color     : Fill color
+    Fill_Rule : FILL_RULE_EVEN_ODD or FILL_RULE_NON_ZERO
+info:
+    Edges are walked in 16.16 fixed point and sampled at pixel centers,
+    so polygons sharing an edge never overlap or leave a gap.
+******************************************************************************/
+typedef struct {
+    int32_t X;      //16.16 x at the center of the current scanline
+    int32_t DxDy;   //16.16 x step per scanline
+    int16_t Ytop;   //First scanline covered
+    int16_t Ybottom;//Last scanline covered + 1
+    int8_t Dir;     //+1 downward edge, -1 upward edge
+} POLYGON_EDGE;
+
+void PaintCtx_FillPolygon(PaintContext *Ctx, const PAINT_POINT *Points, UWORD Count, UWORD Color, FILL_RULE Fill_Rule)
+{
+    if (Count < 3 || Count > POLYGON_MAX_EDGES) {
+        Debug("Paint_FillPolygon Input vertex count out of range\r\n");
+        return;
+    }
+
+    POLYGON_EDGE Edge[POLYGON_MAX_EDGES];
+    UBYTE Active[POLYGON_MAX_EDGES];
+    UWORD Edge_Num = 0, Active_Num = 0, Next = 0;
+
+    //Build the edge table, horizontal edges never cross a sample point
+    for (UWORD i = 0; i < Count; i++) {
+        const PAINT_POINT *P0 = &Points[i];
+        const PAINT_POINT *P1 = &Points[(i + 1) % Count];
+        if (P0->Y == P1->Y)
+            continue;
+
+        POLYGON_EDGE *E = &Edge[Edge_Num++];
+        if (P0->Y < P1->Y) {
+            E->Dir = 1;
+        } else {
+            const PAINT_POINT *T = P0;
+            P0 = P1;
+            P1 = T;
+            E->Dir = -1;
+        }
+        E->Ytop = P0->Y;
+        E->Ybottom = P1->Y;
+        E->DxDy = ((int32_t)(P1->X - P0->X) << 16) / (P1->Y - P0->Y);
+        E->X = ((int32_t)P0->X << 16) + E->DxDy / 2;
+    }
+    if (Edge_Num == 0)
+        return;
+
+    //Sort the edge table by first scanline
+    for (UWORD i = 1; i < Edge_Num; i++) {
+        POLYGON_EDGE Key = Edge[i];
+        int j = i - 1;
+        while (j >= 0 && Edge[j].Ytop > Key.Ytop) {
+            Edge[j + 1] = Edge[j];
+            j--;
+        }
+        Edge[j + 1] = Key;
+    }
+
+    int Ybottom = Edge[0].Ybottom;
+    for (UWORD i = 1; i < Edge_Num; i++)
+        if (Edge[i].Ybottom > Ybottom)
+            Ybottom = Edge[i].Ybottom;
+    const PAINT_RECT *Clip = &Ctx->Clip[Ctx->ClipDepth];
+    if (Ybottom > Clip->Yend)
+        Ybottom = Clip->Yend;
+
+    int Ypoint = Edge[0].Ytop < Clip->Ystart ? Clip->Ystart : Edge[0].Ytop;
+    for (; Ypoint < Ybottom; Ypoint++) {
+        //Retire finished edges
+        UWORD Keep = 0;
+        for (UWORD i = 0; i < Active_Num; i++)
+            if (Edge[Active[i]].Ybottom > Ypoint)
+                Active[Keep++] = Active[i];
+        Active_Num = Keep;
+
+        //Activate edges starting on this scanline (or above a clipped top)
+        while (Next < Edge_Num && Edge[Next].Ytop <= Ypoint) {
+            POLYGON_EDGE *E = &Edge[Next];
+            if (E->Ybottom > Ypoint) {
+                E->X += (int32_t)((int64_t)E->DxDy * (Ypoint - E->Ytop));
+                Active[Active_Num++] = Next;
+            }
+            Next++;
+        }
+        if (Active_Num == 0) {
+            if (Next >= Edge_Num)
+                break;
+            continue;
+        }
+
+        //Keep the active list ordered by x, it is nearly sorted already
+        for (UWORD i = 1; i < Active_Num; i++) {
+            UBYTE Key = Active[i];
+            int j = i - 1;
+            while (j >= 0 && Edge[Active[j]].X > Edge[Key].X) {
+                Active[j + 1] = Active[j];
+                j--;
+            }
+            Active[j + 1] = Key;
+        }
+
+        //Walk the crossings and emit the inside spans
+        int Winding = 0;
+        for (UWORD i = 0; i + 1 < Active_Num; i++) {
+            const POLYGON_EDGE *E = &Edge[Active[i]];
+            Winding += (Fill_Rule == FILL_RULE_NON_ZERO) ? E->Dir : 1;
+            UBYTE Inside = (Fill_Rule == FILL_RULE_NON_ZERO) ? (Winding != 0) : (Winding & 1);
+            if (Inside) {
+                int Xstart = (E->X + 0x7FFF) >> 16;
+                int Xend = (Edge[Active[i + 1]].X + 0x7FFF) >> 16;
+                PaintCtx_FillSpan(Ctx, Xstart, Xend, Ypoint, Color);
+            }
+        }
+
+        for (UWORD i = 0; i < Active_Num; i++)
+            Edge[Active[i]].X += Edge[Active[i]].DxDy;
+    }
+}
+
+/******************************************************************************
+function: Draw a solid five-pointed star
+parameter:
+    X_Center  : Center X coordinate
+    Y_Center  : Center Y coordinate
+    Size      : Star size (radius from center to outer point)
+    Color     : Star color
+******************************************************************************/
+void PaintCtx_DrawStar(PaintContext *Ctx, UWORD X_Center, UWORD Y_Center, UWORD Size, UWORD Color)
+{
+    if (X_Center > Ctx->Width || Y_Center >= Ctx->Height) {
+        Debug("Paint_DrawStar Input exceeds the normal display range\r\n");
+        return;
+    }
+
+    //Alternate outer and inner points, starting at the top (-90 degrees)
+    PAINT_POINT Points[10];
+    float inner_size = Size * 0.382; // Golden ratio for classic star shape
+    for (int i = 0; i < 10; i++) {
+        float radius = (i % 2) ? inner_size : Size;
+        float rad = (i * 36 - 90) * M_PI / 180;
+        Points[i].X = X_Center + lroundf(radius * cos(rad));
+        Points[i].Y = Y_Center + lroundf(radius * sin(rad));
+    }
+
+    PaintCtx_FillPolygon(Ctx, Points, 10, Color, FILL_RULE_NON_ZERO);
+}
+/******************************************************************************
+function: Merge a left-aligned row of up to 32 pixels into a memory row
+parameter:
+    Row   : First byte of the memory row
+    X     : Memory x of the first pixel
+    Mask  : Pixels to write, MSB is the pixel at X
+    Value : New pixel values under Mask (1 = white)
+******************************************************************************/
+static void Paint_BlitBits(UBYTE *Row, UWORD X, UDOUBLE Mask, UDOUBLE Value)
+{
+    uint64_t M = ((uint64_t)Mask << 32) >> (X % 8);
+    uint64_t V = ((uint64_t)Value << 32) >> (X % 8);
+    UBYTE *p = Row + X / 8;
+    for (int Shift = 56; M != 0; Shift -= 8, p++) {
+        UBYTE m = M >> Shift;
+        if (m)
+            *p = (*p & ~m) | ((V >> Shift) & m);
+        M &= ~((uint64_t)0xFF << Shift);
+    }
+}
+
+static UDOUBLE Paint_ReverseBits(UDOUBLE v)
+{
+    v = ((v >> 1) & 0x55555555) | ((v & 0x55555555) << 1);
+    v = ((v >> 2) & 0x33333333) | ((v & 0x33333333) << 2);
+    v = ((v >> 4) & 0x0F0F0F0F) | ((v & 0x0F0F0F0F) << 4);
+    v = ((v >> 8) & 0x00FF00FF) | ((v & 0x00FF00FF) << 8);
+    return (v >> 16) | (v << 16);
+}
+
+/**
+ * Bitmap of one character, for both font formats
+**/
+typedef struct {
+    const UBYTE *Bitmap;    //First byte of the glyph
+    UWORD Stride;           //Bits from one bitmap row to the next
+    UWORD Width;            //Bitmap size
+    UWORD Height;
+    UWORD Left;             //Bitmap position inside the character cell
+    UWORD Top;
+    UWORD Advance;          //Cell width
+    UWORD Rows;             //Cell height, Font->Height
+    UWORD Style;            //TEXT_BOLD, TEXT_OUTLINE and TEXT_UNDERLINE drawn, see Paint_StyleGlyph
+    UWORD Underline;        //Cell row of the underline
+    UWORD Pad;              //Columns the bitmap was moved right by Paint_FitGlyph
+} PAINT_GLYPH;
+
+//Index of Code in Font->Glyphs, -1 when the font has no glyph for it
+static int Paint_GlyphIndex(const sFONT* Font, UDOUBLE Code)
+{
+    if (Code < Font->First || Code > Font->Last) {
+        //Code points past the ASCII block: binary search of the ranges
+        int Low = 0, High = (int)Font->RangeCount - 1;
+        while (Low <= High) {
+            int Mid = (Low + High) / 2;
+            const sRANGE *Range = &Font->Ranges[Mid];
+            if (Code < Range->First)
+                High = Mid - 1;
+            else if (Code >= Range->First + Range->Count)
+                Low = Mid + 1;
+            else
+                return Range->Index + (Code - Range->First);
+        }
+        return -1;
+    }
+    UBYTE Bit = Code - Font->First;
+    if (Font->Map == NULL)
+        return Bit;
+
+    //Subset: the glyph's rank among the codes present
+    const uint32_t *Map = Font->Map;
+    if (!(Map[Bit / 32] & ((uint32_t)1 << (Bit % 32))))
+        return -1;
+    int Index = __builtin_popcount(Map[Bit / 32] & (((uint32_t)1 << (Bit % 32)) - 1));
+    for (UBYTE i = 0; i < Bit / 32; i++)
+        Index += __builtin_popcount(Map[i]);
+    return Index;
+}
+
+/******************************************************************************
+function: Look up the bitmap of a character
+parameter:
+    Font  : Font to look in
+    Code  : Unicode code point
+    Glyph : Filled with the bitmap and metrics
+info:
+    A monospaced font is a proportional one whose bitmaps fill the cell,
+    with rows padded to whole bytes. Its table stops at 0x7F, which holds
+    the degree sign, so U+00B0 is drawn from there. A character the font
+    lacks is drawn as the font's Fallback glyph, or as an empty cell a
+    space wide.
+******************************************************************************/
+static void Paint_FindGlyph(const sFONT* Font, UDOUBLE Code, PAINT_GLYPH *Glyph)
+{
+    memset(Glyph, 0, sizeof(PAINT_GLYPH));
+    Glyph->Rows = Font->Height;
+
+    if (Font->Glyphs == NULL) {
+        UWORD Row_Bytes = (Font->Width + 7) / 8;
+        Glyph->Advance = Font->Width;
+        if (Code == 0xB0)
+            Code = 0x7F;
+        if (Code < ' ' || Code > 0x7F) {
+            if (Font->Fallback < ' ' || Font->Fallback > 0x7F)
+                return;
+            Code = Font->Fallback;
+        }
+        Glyph->Bitmap = Font->table + (UDOUBLE)(Code - ' ') * Font->Height * Row_Bytes;
+        Glyph->Stride = Row_Bytes * 8;
+        Glyph->Width = Font->Width;
+        Glyph->Height = Font->Height;
+        return;
+    }
+
+    int Index = Paint_GlyphIndex(Font, Code);
+    if (Index < 0 && Font->Fallback)
+        Index = Paint_GlyphIndex(Font, Font->Fallback);
+    if (Index < 0) {
+        Index = Paint_GlyphIndex(Font, ' ');
+        if (Index >= 0)
+            Glyph->Advance = Font->Glyphs[Index].Advance;
+        return;
+    }
+    const sGLYPH *Metrics = &Font->Glyphs[Index];
+    Glyph->Bitmap = Font->table + Metrics->Offset;
+    Glyph->Stride = Metrics->Width;
+    Glyph->Width = Metrics->Width;
+    Glyph->Height = Metrics->Height;
+    Glyph->Left = Metrics->Left;
+    Glyph->Top = Metrics->Top;
+    Glyph->Advance = Metrics->Advance;
+}
+
+//Advance of one character, the one Paint_FindGlyph gives it
+static UWORD Paint_CharWidth(const sFONT* Font, UDOUBLE Code)
+{
+    if (Font->Glyphs == NULL)
+        return Font->Width;
+    int Index = Paint_GlyphIndex(Font, Code);
+    if (Index < 0 && Font->Fallback)
+        Index = Paint_GlyphIndex(Font, Font->Fallback);
+    if (Index < 0)
+        Index = Paint_GlyphIndex(Font, ' ');
+    return Index < 0 ? 0 : Font->Glyphs[Index].Advance;
+}
+
+//Whether a character gets a tabular cell
+static UBYTE Paint_IsDigit(UDOUBLE Code)
+{
+    return Code >= '0' && Code <= '9';
+}
+
+//Cell of a digit with TEXT_TABULAR: the widest digit of the font
+static UWORD Paint_DigitWidth(const sFONT* Font)
+{
+    UWORD Width = 0;
+    for (UDOUBLE Code = '0'; Code <= '9'; Code++) {
+        UWORD Char_Width = Paint_CharWidth(Font, Code);
+        if (Char_Width > Width)
+            Width = Char_Width;
+    }
+    return Width;
+}
+
+/******************************************************************************
+function: Centre a digit in its tabular cell
+parameter:
+    Code  : Character of the glyph
+    Glyph : Glyph found by Paint_FindGlyph, updated in place
+    Digit : Cell of a digit, from the pen of the line; 0 without
+            TEXT_TABULAR
+info:
+    With TEXT_TABULAR every digit is drawn in a cell as wide as the widest
+    one, its bitmap centred in it, so that numbers of as many digits take
+    the same room whatever they read.
+******************************************************************************/
+static void Paint_FitGlyph(UDOUBLE Code, PAINT_GLYPH *Glyph, UWORD Digit)
+{
+    if (Digit <= Glyph->Advance || !Paint_IsDigit(Code))
+        return;
+    Glyph->Pad = (Digit - Glyph->Advance) / 2;
+    Glyph->Left += Glyph->Pad;
+    Glyph->Advance = Digit;
+}
+
+//Kerning between two characters, 0 for pairs the font does not list
+static int Paint_Kerning(const sFONT* Font, UDOUBLE Left, UDOUBLE Right)
+{
+    if (Font->KernCount == 0 || Left == 0 || Left > 0xFFFF || Right > 0xFFFF)
+        return 0;
+    UDOUBLE Key = Left << 16 | Right;
+    int Low = 0, High = (int)Font->KernCount - 1;
+    while (Low <= High) {
+        int Mid = (Low + High) / 2;
+        const sKERN *Pair = &Font->Kerning[Mid];
+        UDOUBLE Pair_Key = (UDOUBLE)Pair->Left << 16 | Pair->Right;
+        if (Key < Pair_Key)
+            High = Mid - 1;
+        else if (Key > Pair_Key)
+            Low = Mid + 1;
+        else
+            return Pair->Adjust;
+    }
+    return 0;
+}
+
+/******************************************************************************
+function: Cell row of the underline of a font
+info:
+    The underline goes one row below the baseline, the bottom of 'H',
+    or on the last row of the cell when there is no room below.
+******************************************************************************/
+static UWORD Paint_UnderlineRow(const sFONT* Font)
+{
+    PAINT_GLYPH Letter;
+    Paint_FindGlyph(Font, 'H', &Letter);
+    int Baseline = Letter.Top + Letter.Height;
+    //The monospaced tables fill the cell, their ink shows where 'H' ends
+    while (Font->Glyphs == NULL && Baseline > 0) {
+        const UBYTE *Row = Letter.Bitmap + (UDOUBLE)(Baseline - 1) * (Letter.Stride / 8);
+        UBYTE Ink = 0;
+        for (UWORD i = 0; i < Letter.Stride / 8; i++)
+            Ink |= Row[i];
+        if (Ink)
+            break;
+        Baseline--;
+    }
+    return Baseline < Font->Height ? Baseline : Font->Height - 1;
+}
+
+/**
+ * Position along a line of text being laid out
+**/
+typedef struct {
+    const sFONT *Font;
+    UWORD Digit;        //Cell of a digit with TEXT_TABULAR, 0 without
+    UWORD Underline;    //Cell row of the underline with TEXT_UNDERLINE
+    UDOUBLE Prev;       //Last character placed, for kerning
+    UDOUBLE X;          //End of the last cell
+    UDOUBLE End;        //End of the cell before the last one
+} PAINT_PEN;
+
+static void Paint_PenStart(PAINT_PEN *Pen, const sFONT* Font, UWORD Flags)
+{
+    Pen->Font = Font;
+    Pen->Digit = (Flags & TEXT_TABULAR) ? Paint_DigitWidth(Font) : 0;
+    Pen->Underline = (Flags & TEXT_UNDERLINE) ? Paint_UnderlineRow(Font) : 0;
+    Pen->Prev = 0;
+    Pen->X = 0;
+    Pen->End = 0;
+}
+
+/******************************************************************************
+function: Place the next character of a line
+parameter:
+    Pen  : Position on the line, moved past the character
+    Code : Character placed
+return:
+    Left of its cell, from the start of the line
+info:
+    The kerning of the pair it makes with the character before moves the
+    cell first, never in front of the line; tabular digits are not kerned,
+    so a reading keeps its width. Every width and position of text is
+    taken from here, so that measuring, breaking lines and drawing agree.
+******************************************************************************/
+static UDOUBLE Paint_PenNext(PAINT_PEN *Pen, UDOUBLE Code)
+{
+    int Kern = 0;
+    if (!Pen->Digit || !(Paint_IsDigit(Pen->Prev) || Paint_IsDigit(Code)))
+        Kern = Paint_Kerning(Pen->Font, Pen->Prev, Code);
+    Pen->End = Pen->X;
+    if (Kern < 0 && (UDOUBLE)-Kern > Pen->X)
+        Pen->X = 0;
+    else
+        Pen->X += Kern;
+    UDOUBLE Left = Pen->X;
+    if (Pen->Digit && Paint_IsDigit(Code))
+        Pen->X += Pen->Digit;
+    else
+        Pen->X += Paint_CharWidth(Pen->Font, Code);
+    Pen->Prev = Code;
+    return Left;
+}
+
+/******************************************************************************
+function: Decode the next character of a UTF-8 string
+parameter:
+    pString : String position, moved past the character
+info:
+    Returns the code point, or 0 at the end of the string without moving.
+    A byte that does not start a valid sequence (stray continuation byte,
+    overlong form, surrogate, truncated sequence) is taken as a Latin-1
+    character on its own, so legacy 8-bit text still draws.
+******************************************************************************/
+static UDOUBLE Paint_NextChar(const char **pString)
+{
+    const UBYTE *p = (const UBYTE *)*pString;
+    UDOUBLE Code = p[0];
+    if (Code < 0x80) {
+        if (Code)
+            (*pString)++;
+        return Code;
+    }
+
+    UBYTE Length;
+    UDOUBLE Min;
+    if ((Code & 0xE0) == 0xC0) {
+        Length = 2, Min = 0x80, Code &= 0x1F;
+    } else if ((Code & 0xF0) == 0xE0) {
+        Length = 3, Min = 0x800, Code &= 0x0F;
+    } else if ((Code & 0xF8) == 0xF0) {
+        Length = 4, Min = 0x10000, Code &= 0x07;
+    } else {
+        (*pString)++;
+        return p[0];
+    }
+    for (UBYTE i = 1; i < Length; i++) {
+        if ((p[i] & 0xC0) != 0x80) {
+            (*pString)++;
+            return p[0];
+        }
+        Code = (Code << 6) | (p[i] & 0x3F);
+    }
+    if (Code < Min || Code > 0x10FFFF || (Code >= 0xD800 && Code <= 0xDFFF)) {
+        (*pString)++;
+        return p[0];
+    }
+    *pString += Length;
+    return Code;
+}
+
+//Glyph row starting at bitmap bit Bit, leftmost pixel in the top bit;
+//bits past the glyph width are not cleared
+static UDOUBLE Paint_GlyphRow(const PAINT_GLYPH *Glyph, UDOUBLE Bit)
+{
+    const UBYTE *ptr = Glyph->Bitmap + Bit / 8;
+    UBYTE Shift = Bit % 8;
+    UBYTE Bytes = (Shift + Glyph->Width + 7) / 8;
+    UDOUBLE Bits = 0;
+    for (UBYTE i = 0; i < Bytes && i < 4; i++)
+        Bits |= (UDOUBLE)ptr[i] << (24 - 8 * i);
+    //A fifth byte only when the row straddles it
+    if (Shift)
+        Bits = (Bits << Shift) | (Bytes > 4 ? ptr[4] >> (8 - Shift) : 0);
+    return Bits;
+}
+
+//32 pixels of a glyph row from cell column Column on, leftmost in the
+//top bit; pixels outside the bitmap are 0
+static UDOUBLE Paint_InkBits(const PAINT_GLYPH *Glyph, int Column, int Row)
+{
+    int Skip = Column - Glyph->Left;
+    Row -= Glyph->Top;
+    if (Row < 0 || Row >= Glyph->Height || Skip >= Glyph->Width || Skip <= -32)
+        return 0;
+
+    //Only the rest of the row is read
+    PAINT_GLYPH Part = *Glyph;
+    UDOUBLE Bit = (UDOUBLE)Row * Glyph->Stride;
+    if (Skip > 0) {
+        Part.Width -= Skip;
+        Bit += Skip;
+    }
+    UDOUBLE Bits = Paint_GlyphRow(&Part, Bit);
+    if (Part.Width < 32)
+        Bits &= ~(0xFFFFFFFF >> Part.Width);
+    return Skip < 0 ? Bits >> -Skip : Bits;
+}
+
+//Row of a glyph that fits in 32 columns, placed in its cell; Glyph_Mask
+//covers the glyph width
+static inline UDOUBLE Paint_LineBits(const PAINT_GLYPH *Glyph, int Row, UDOUBLE Glyph_Mask)
+{
+    Row -= Glyph->Top;
+    if (Row < 0 || Row >= Glyph->Height)
+        return 0;
+    return (Paint_GlyphRow(Glyph, (UDOUBLE)Row * Glyph->Stride) & Glyph_Mask) >> Glyph->Left;
+}
+
+//The 32 columns from Column on that lie inside a cell Width wide
+static UDOUBLE Paint_CellMask(int Width, int Column)
+{
+    int Inside = Width - Column;
+    UDOUBLE Mask = Inside >= 32 ? 0xFFFFFFFF : Inside > 0 ? ~(0xFFFFFFFF >> Inside) : 0;
+    if (Column < 0)
+        Mask = -Column >= 32 ? 0 : Mask & (0xFFFFFFFF >> -Column);
+    return Mask;
+}
+
+/******************************************************************************
+function: Prepare a glyph to be drawn in the styles of Flags
+parameter:
+    Pen   : Pen the line was started with, its rows of the styles
+    Glyph : Found by Paint_FindGlyph
+    Flags : TEXT_* flags, only the styles matter
+******************************************************************************/
+static void Paint_StyleGlyph(const PAINT_PEN *Pen, PAINT_GLYPH *Glyph, UWORD Flags)
+{
+    Glyph->Style = Flags & (TEXT_BOLD | TEXT_OUTLINE | TEXT_UNDERLINE);
+    Glyph->Underline = Pen->Underline;
+}
+
+/******************************************************************************
+function: Styled row of a glyph cell up to 32 pixels wide
+parameter:
+    Row       : Cell row
+    Up        : Ink of the row above, as from Paint_InkBits at column 0
+    Bits      : Ink of the row
+    Down      : Ink of the row below
+    Cell_Mask : Columns of the cell
+info:
+    Bold ORs every row with itself shifted one pixel right. Outline keeps
+    the pixels next to the (bold) ink, across and diagonally, that are
+    not ink themselves. Both stay inside the cell. The underline is a
+    whole row of the cell. Drawing a row thus takes the row below it
+    too, one glyph row fetch a row when they are taken in order.
+******************************************************************************/
+static inline UDOUBLE Paint_StyleRow(const PAINT_GLYPH *Glyph, int Row, UDOUBLE Up, UDOUBLE Bits, UDOUBLE Down,
+                                     UDOUBLE Cell_Mask)
+{
+    if (Glyph->Style & TEXT_BOLD) {
+        Up |= Up >> 1;
+        Bits |= Bits >> 1;
+        Down |= Down >> 1;
+    }
+    Bits &= Cell_Mask;
+    if (Glyph->Style & TEXT_OUTLINE) {
+        UDOUBLE Near = (Up | Bits | Down) & Cell_Mask;
+        Bits = (Near | Near >> 1 | Near << 1) & ~Bits & Cell_Mask;
+    }
+    if ((Glyph->Style & TEXT_UNDERLINE) && Row == Glyph->Underline)
+        Bits |= Cell_Mask;
+    return Bits;
+}
+
+//Bold ink of 32 columns from Column on, inside the cell
+static UDOUBLE Paint_BoldBits(const PAINT_GLYPH *Glyph, int Column, int Row)
+{
+    UDOUBLE Bits = Paint_InkBits(Glyph, Column, Row);
+    if (Glyph->Style & TEXT_BOLD)
+        Bits |= Paint_InkBits(Glyph, Column - 1, Row);
+    return Bits & Paint_CellMask(Glyph->Advance, Column);
+}
+
+//32 pixels of a cell row from cell column Column on, leftmost in the top
+//bit, in the glyph's style; pixels outside the cell are 0 when styled.
+//Cells of any width, the same pixels as Paint_StyleRow
+static UDOUBLE Paint_CellBits(const PAINT_GLYPH *Glyph, int Column, int Row)
+{
+    if (Glyph->Style == 0)
+        return Paint_InkBits(Glyph, Column, Row);
+    if (Row < 0 || Row >= Glyph->Rows)
+        return 0;
+
+    UDOUBLE Mask = Paint_CellMask(Glyph->Advance, Column);
+    UDOUBLE Bits = Paint_BoldBits(Glyph, Column, Row);
+    if (Glyph->Style & TEXT_OUTLINE) {
+        UDOUBLE Near = 0;
+        for (int y = Row - 1; y <= Row + 1; y++)
+            Near |= Paint_BoldBits(Glyph, Column - 1, y) | Paint_BoldBits(Glyph, Column, y) |
+                    Paint_BoldBits(Glyph, Column + 1, y);
+        Bits = Near & ~Bits & Mask;
+    }
+    if ((Glyph->Style & TEXT_UNDERLINE) && Row == Glyph->Underline)
+        Bits |= Mask;
+    return Bits;
+}
+
+/******************************************************************************
+function: Expand a FONT_ENCODING_ROWS glyph
+parameter:
+    Glyph : Glyph in the font table, at most 32 x GLYPH_ROWS pixels
+    Bits  : One row of 4 bytes per glyph row
+******************************************************************************/
+static void Paint_UnpackGlyph(const PAINT_GLYPH *Glyph, UBYTE *Bits)
+{
+    UDOUBLE Glyph_Mask = Glyph->Width >= 32 ? 0xFFFFFFFF : ~(0xFFFFFFFF >> Glyph->Width);
+    UDOUBLE Bit = 0, Row = 0;
+    for (UWORD y = 0; y < Glyph->Height; y++, Bits += 4) {
+        UBYTE Repeat = Glyph->Bitmap[Bit / 8] & (0x80 >> (Bit % 8));
+        Bit++;
+        if (!Repeat) {
+            Row = Paint_GlyphRow(Glyph, Bit) & Glyph_Mask;
+            Bit += Glyph->Width;
+        }
+        Bits[0] = Row >> 24;
+        Bits[1] = Row >> 16;
+        Bits[2] = Row >> 8;
+        Bits[3] = Row;
+    }
+}
+
+/******************************************************************************
+function: Look a glyph up in the cache
+parameter:
+    Source : Bitmap of the glyph in the font table
+    Form   : GLYPH_FORM_* wanted
+    Slot   : The slot holding it, or the one to fill
+return:
+    1 when the slot already holds the glyph
+info:
+    A glyph not found replaces the least recently used slot; the slots
+    are few, so they are simply searched in order.
+******************************************************************************/
+static UBYTE Paint_CacheLookup(PAINT_GLYPH_CACHE *Cache, const UBYTE *Source, UBYTE Form,
+                               PAINT_GLYPH_SLOT **Slot)
+{
+    PAINT_GLYPH_SLOT *Oldest = Cache->Slots;
+    Cache->Clock++;
+    for (UWORD i = 0; i < Cache->Count; i++) {
+        PAINT_GLYPH_SLOT *Found = &Cache->Slots[i];
+        if (Found->Source == Source && Found->Form == Form) {
+            Found->Used = Cache->Clock;
+            Cache->Hits++;
+            *Slot = Found;
+            return 1;
+        }
+        if (Found->Used < Oldest->Used)
+            Oldest = Found;
+    }
+    Cache->Misses++;
+    Oldest->Source = Source;
+    Oldest->Form = Form;
+    Oldest->Used = Cache->Clock;
+    *Slot = Oldest;
+    return 0;
+}
+
+/******************************************************************************
+function: Decoded bitmap of a FONT_ENCODING_ROWS glyph
+parameter:
+    Glyph   : Glyph in the font table
+    Scratch : GLYPH_ROWS * 4 bytes, used when the context has no cache
+info:
+    A glyph found in the cache is not decoded again.
+******************************************************************************/
+static const UBYTE *Paint_DecodeGlyph(PaintContext *Ctx, const PAINT_GLYPH *Glyph, UBYTE *Scratch)
+{
+    PAINT_GLYPH_CACHE *Cache = Ctx->GlyphCache;
+    PAINT_GLYPH_SLOT *Slot;
+    if (Cache == NULL || Cache->Count == 0) {
+        Paint_UnpackGlyph(Glyph, Scratch);
+        return Scratch;
+    }
+    if (!Paint_CacheLookup(Cache, Glyph->Bitmap, GLYPH_FORM_ROWS, &Slot))
+        Paint_UnpackGlyph(Glyph, Slot->Bits);
+    return Slot->Bits;
+}
+
+/******************************************************************************
+function: Transpose a 32 x 32 bit matrix in place
+parameter:
+    Rows : Row i holds pixel j in bit 31 - j; afterwards row j holds
+           pixel i in bit 31 - i
+info:
+    Swaps ever smaller blocks across the diagonal, 16 x 16 first, so it
+    takes 5 passes of 16 word exchanges instead of 1024 bit moves.
+******************************************************************************/
+static void Paint_Transpose32(UDOUBLE *Rows)
+{
+    UDOUBLE Mask = 0x0000FFFF;
+    for (int j = 16; j != 0; j >>= 1, Mask ^= Mask << j) {
+        for (int k = 0; k < 32; k = (k + j + 1) & ~j) {
+            UDOUBLE t = (Rows[k] ^ (Rows[k + j] >> j)) & Mask;
+            Rows[k] ^= t;
+            Rows[k + j] ^= t << j;
+        }
+    }
+}
+
+/******************************************************************************
+function: Columns of a glyph cell, for ROTATE_90/270
+parameter:
+    Glyph    : Glyph found by Paint_FindGlyph, inside a 32 x 32 cell
+    Height   : Cell height
+    Reversed : Bottom pixel of a column in the top bit, shifted so that
+               the cell fills the top Height bits
+    Scratch  : GLYPH_ROWS * 4 bytes, used when the context has no cache
+return:
+    4 bytes per cell column, as GLYPH_FORM_COLUMNS(_REVERSED)
+info:
+    Built on first use and kept in the glyph cache like a decoded glyph;
+    a styled glyph is built in Scratch every time, its rows are styled
+    before they are turned, and so is a tabular digit moved in its cell.
+******************************************************************************/
+static const UBYTE *PaintCtx_GlyphColumns(PaintContext *Ctx, const sFONT* Font, const PAINT_GLYPH *Glyph,
+                                          UWORD Height, UBYTE Reversed, UBYTE *Scratch)
+{
+    PAINT_GLYPH_CACHE *Cache = Ctx->GlyphCache;
+    PAINT_GLYPH_SLOT *Slot = NULL;
+    UDOUBLE Cell[32];
+    if (Glyph->Width && !Glyph->Style && !Glyph->Pad && Cache && Cache->Count &&
+        Paint_CacheLookup(Cache, Glyph->Bitmap,
+                          Reversed ? GLYPH_FORM_COLUMNS_REVERSED : GLYPH_FORM_COLUMNS, &Slot))
+        return Slot->Bits;
+
+    //Cell rows, a compressed glyph is decoded into Scratch first
+    PAINT_GLYPH Rows = *Glyph;
+    if (Font->Encoding == FONT_ENCODING_ROWS && Glyph->Width) {
+        Paint_UnpackGlyph(Glyph, Scratch);
+        Rows.Bitmap = Scratch;
+        Rows.Stride = 32;
+    }
+    UDOUBLE Glyph_Mask = Rows.Width >= 32 ? 0xFFFFFFFF : ~(0xFFFFFFFF >> Rows.Width);
+    for (UWORD y = 0; y < 32; y++) {
+        Cell[y] = 0;
+        if ((UWORD)(y - Rows.Top) < Rows.Height)
+            Cell[y] = (Paint_GlyphRow(&Rows, (UDOUBLE)(y - Rows.Top) * Rows.Stride) & Glyph_Mask) >> Rows.Left;
+    }
+    if (Glyph->Style) {
+        UDOUBLE Cell_Mask = Paint_CellMask(Glyph->Advance, 0), Up = 0;
+        for (UWORD y = 0; y < 32; y++) {
+            UDOUBLE Bits = Cell[y];
+            Cell[y] = y < Glyph->Rows ? Paint_StyleRow(Glyph, y, Up, Bits, y < 31 ? Cell[y + 1] : 0, Cell_Mask) : 0;
+            Up = Bits;
+        }
+    }
+    Paint_Transpose32(Cell);
+
+    UBYTE *Columns = Slot ? Slot->Bits : Scratch;
+    for (UWORD x = 0; x < 32; x++) {
+        UDOUBLE Column = Reversed ? Paint_ReverseBits(Cell[x]) << (32 - Height) : Cell[x];
+        Columns[4 * x] = Column >> 24;
+        Columns[4 * x + 1] = Column >> 16;
+        Columns[4 * x + 2] = Column >> 8;
+        Columns[4 * x + 3] = Column;
+    }
+    return Columns;
+}
+
+/******************************************************************************
+function: Point a glyph of a FONT_ENCODING_ROWS font at its decoded rows
+parameter:
+    Glyph   : Glyph found by Paint_FindGlyph, updated in place
+    Scratch : GLYPH_ROWS * 4 bytes, see Paint_DecodeGlyph
+info:
+    A glyph too large to decode is drawn empty.
+******************************************************************************/
+static void PaintCtx_LoadGlyph(PaintContext *Ctx, const sFONT* Font, PAINT_GLYPH *Glyph, UBYTE *Scratch)
+{
+    if (Font->Encoding != FONT_ENCODING_ROWS || Glyph->Width == 0)
+        return;
+    if (Glyph->Width > 32 || Glyph->Height > GLYPH_ROWS) {
+        Debug("Paint_DrawChar Compressed glyph too large\r\n");
+        Glyph->Width = 0;
+        Glyph->Height = 0;
+        return;
+    }
+    Glyph->Bitmap = Paint_DecodeGlyph(Ctx, Glyph, Scratch);
+    Glyph->Stride = 32;
+}
+
+/******************************************************************************
+function: Show one character
+parameter:
+    Xpoint           ：X coordinate
+    Ypoint           ：Y coordinate
+    Code             ：Unicode code point of the character
+    Pen              ：Pen the line was started with, for the font and the
+                       rows of the styles
+    Flags            ：TEXT_* styles and TEXT_TABULAR
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    The character cell is its advance wide and Font->Height high, see
+    Paint_FitGlyph for tabular digits; with a proportional font only the glyph's bitmap is read, the rest of the
+    cell is background.
+    Glyphs of a FONT_ENCODING_ROWS font are decoded first, through the
+    context's glyph cache when it has one.
+    For ROTATE_0/180 at scale 2 every cell row is shifted into place and
+    merged into the framebuffer bytes directly. For ROTATE_90/270 a cell
+    column runs along a memory row, so the cell is transposed first, or
+    taken from the glyph cache, and then merged the same way a column at
+    a time. Other cases go through Paint_SetPixel.
+    Styles are applied to each row on its way, see Paint_StyleRow.
+******************************************************************************/
+static void PaintCtx_DrawCode(PaintContext *Ctx, UWORD Xpoint, UWORD Ypoint, UDOUBLE Code,
+                             const PAINT_PEN *Pen, UWORD Flags, UWORD Color_Foreground, UWORD Color_Background)
+{
+    const sFONT *Font = Pen->Font;
+    UWORD Page, Column;
+    PAINT_GLYPH Glyph;
+    Paint_FindGlyph(Font, Code, &Glyph);
+    Paint_FitGlyph(Code, &Glyph, Pen->Digit);
+    Paint_StyleGlyph(Pen, &Glyph, Flags);
+    UWORD Cell_Width = Glyph.Advance;
+    if (Flags & TEXT_INVERSE) {
+        UWORD Color = Color_Foreground;
+        Color_Foreground = Color_Background;
+        Color_Background = Color;
+    }
+
+    //Part of the glyph cell inside the clip window
+    const PAINT_RECT *Clip = &Ctx->Clip[Ctx->ClipDepth];
+    int Column_Start = Clip->Xstart > Xpoint ? Clip->Xstart - Xpoint : 0;
+    int Column_End = Xpoint + Cell_Width > Clip->Xend ? Clip->Xend - Xpoint : Cell_Width;
+    int Page_Start = Clip->Ystart > Ypoint ? Clip->Ystart - Ypoint : 0;
+    int Page_End = Ypoint + Font->Height > Clip->Yend ? Clip->Yend - Ypoint : Font->Height;
+    if (Column_Start >= Column_End || Page_Start >= Page_End)
+        return;
+
+    UBYTE Scratch[GLYPH_ROWS * 4];
+    if (Ctx->Scale == 2 && (Ctx->Rotate == ROTATE_90 || Ctx->Rotate == ROTATE_270) &&
+        Cell_Width <= 32 && Glyph.Left + Glyph.Width <= 32 && Font->Height <= 32 &&
+        !Ctx->Sparse && !Ctx->SparseRed) {
+        //Logical y runs along memory x, logical x along memory y
+        UBYTE Flip_X = (Ctx->Rotate == ROTATE_90) ^ ((Ctx->Mirror & MIRROR_HORIZONTAL) ? 1 : 0);
+        UBYTE Flip_Y = (Ctx->Rotate == ROTATE_270) ^ ((Ctx->Mirror & MIRROR_VERTICAL) ? 1 : 0);
+        UDOUBLE Page_Mask = (0xFFFFFFFF >> Page_Start) &
+                            (Page_End == 32 ? 0xFFFFFFFF : ~(0xFFFFFFFF >> Page_End));
+        UDOUBLE Fore = PaintCtx_BlackFill(Ctx, Color_Foreground) ? 0xFFFFFFFF : 0;
+        UDOUBLE Back = PaintCtx_BlackFill(Ctx, Color_Background) ? 0xFFFFFFFF : 0;
+        UDOUBLE Fore_Red = Paint_RedFill(Color_Foreground) ? 0xFFFFFFFF : 0;
+        UDOUBLE Back_Red = Paint_RedFill(Color_Background) ? 0xFFFFFFFF : 0;
+        UWORD X = Ypoint;
+        if (Flip_X) {
+            X = Ctx->WidthMemory - Ypoint - Font->Height;
+            Page_Mask = Paint_ReverseBits(Page_Mask) << (32 - Font->Height);
+        }
+
+        const UBYTE *Columns = PaintCtx_GlyphColumns(Ctx, Font, &Glyph, Font->Height, Flip_X, Scratch);
+        for (Column = Column_Start; Column < Column_End; Column ++ ) {
+            const UBYTE *p = Columns + 4 * Column;
+            UDOUBLE Bits = ((UDOUBLE)p[0] << 24 | (UDOUBLE)p[1] << 16 | (UDOUBLE)p[2] << 8 | p[3]) & Page_Mask;
+
+            UWORD Y = Flip_Y ? Ctx->HeightMemory - 1 - (Xpoint + Column) : Xpoint + Column;
+            UDOUBLE Offset = (UDOUBLE)(Y - Ctx->BandStart) * Ctx->WidthByte;
+            UDOUBLE Mask = (FONT_BACKGROUND == Color_Background) ? Bits : Page_Mask;
+            if (Ctx->Image)
+                Paint_BlitBits(Ctx->Image + Offset, X, Mask, (Bits & Fore) | (~Bits & Back));
+            if (Ctx->ImageRed && Ctx->TriColor)
+                Paint_BlitBits(Ctx->ImageRed + Offset, X, Mask, (Bits & Fore_Red) | (~Bits & Back_Red));
+        }
+        return;
+    }
+
+    //Compressed glyphs are drawn from their decoded rows
+    PaintCtx_LoadGlyph(Ctx, Font, &Glyph, Scratch);
+
+    if (Ctx->Scale == 2 && (Ctx->Rotate == ROTATE_0 || Ctx->Rotate == ROTATE_180) &&
+        Cell_Width <= 32 && Glyph.Left + Glyph.Width <= 32 && !Ctx->Sparse && !Ctx->SparseRed) {
+        UBYTE Flip_X = (Ctx->Rotate == ROTATE_180) ^ ((Ctx->Mirror & MIRROR_HORIZONTAL) ? 1 : 0);
+        UBYTE Flip_Y = (Ctx->Rotate == ROTATE_180) ^ ((Ctx->Mirror & MIRROR_VERTICAL) ? 1 : 0);
+        UDOUBLE Column_Mask = (0xFFFFFFFF >> Column_Start) &
+                              (Column_End == 32 ? 0xFFFFFFFF : ~(0xFFFFFFFF >> Column_End));
+        UDOUBLE Fore = PaintCtx_BlackFill(Ctx, Color_Foreground) ? 0xFFFFFFFF : 0;
+        UDOUBLE Back = PaintCtx_BlackFill(Ctx, Color_Background) ? 0xFFFFFFFF : 0;
+        UDOUBLE Fore_Red = Paint_RedFill(Color_Foreground) ? 0xFFFFFFFF : 0;
+        UDOUBLE Back_Red = Paint_RedFill(Color_Background) ? 0xFFFFFFFF : 0;
+        UWORD X = Xpoint;
+        if (Flip_X) {
+            X = Ctx->WidthMemory - Xpoint - Cell_Width;
+            Column_Mask = Paint_ReverseBits(Column_Mask) << (32 - Cell_Width);
+        }
+
+        UDOUBLE Glyph_Mask = Glyph.Width >= 32 ? 0xFFFFFFFF : ~(0xFFFFFFFF >> Glyph.Width);
+        UDOUBLE Bit = Page_Start > Glyph.Top ? (UDOUBLE)(Page_Start - Glyph.Top) * Glyph.Stride : 0;
+        //A styled row needs its neighbours, which are carried along
+        UDOUBLE Cell_Mask = Paint_CellMask(Cell_Width, 0);
+        UDOUBLE Up = 0, Ink = 0;
+        if (Glyph.Style) {
+            Up = Paint_LineBits(&Glyph, Page_Start - 1, Glyph_Mask);
+            Ink = Paint_LineBits(&Glyph, Page_Start, Glyph_Mask);
+        }
+
+        for (Page = Page_Start; Page < Page_End; Page ++ ) {
+            UDOUBLE Bits = 0;
+            if (Glyph.Style) {
+                UDOUBLE Down = Paint_LineBits(&Glyph, Page + 1, Glyph_Mask);
+                Bits = Paint_StyleRow(&Glyph, Page, Up, Ink, Down, Cell_Mask);
+                Up = Ink;
+                Ink = Down;
+            } else if ((UWORD)(Page - Glyph.Top) < Glyph.Height) {
+                Bits = (Paint_GlyphRow(&Glyph, Bit) & Glyph_Mask) >> Glyph.Left;
+                Bit += Glyph.Stride;
+            }
+            if (Flip_X)
+                Bits = Paint_ReverseBits(Bits) << (32 - Cell_Width);
+            Bits &= Column_Mask;
+
+            UWORD Y = Flip_Y ? Ctx->HeightMemory - 1 - (Ypoint + Page) : Ypoint + Page;
+            UDOUBLE Offset = (UDOUBLE)(Y - Ctx->BandStart) * Ctx->WidthByte;
+            //Same background as the screen: only the set bits are painted
+            UDOUBLE Mask = (FONT_BACKGROUND == Color_Background) ? Bits : Column_Mask;
+            if (Ctx->Image)
+                Paint_BlitBits(Ctx->Image + Offset, X, Mask, (Bits & Fore) | (~Bits & Back));
+            if (Ctx->ImageRed && Ctx->TriColor)
+                Paint_BlitBits(Ctx->ImageRed + Offset, X, Mask, (Bits & Fore_Red) | (~Bits & Back_Red));
+        }
+        return;
+    }
+
+    for (Page = Page_Start; Page < Page_End; Page ++ ) {
+        UDOUBLE Bits = 0;
+        for (Column = Column_Start; Column < Column_End; Column ++ ) {
+            //32 pixels of the row at a time
+            if ((Column - Column_Start) % 32 == 0)
+                Bits = Paint_CellBits(&Glyph, Column, Page);
+            UBYTE Set = (Bits & (0x80000000 >> ((Column - Column_Start) % 32))) != 0;
+
+            //To determine whether the font background color and screen background color is consistent
+            if (Set)
+                PaintCtx_PutPixel(Ctx, Xpoint + Column, Ypoint + Page, Color_Foreground);
+            else if (FONT_BACKGROUND != Color_Background)
+                PaintCtx_PutPixel(Ctx, Xpoint + Column, Ypoint + Page, Color_Background);
+        }// Write a line
+    }// Write all
+}
+
+//A single byte is taken as a Latin-1 character
+void PaintCtx_DrawChar(PaintContext *Ctx, UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                    sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    PAINT_PEN Pen;
+    Paint_PenStart(&Pen, Font, 0);
+    PaintCtx_DrawCode(Ctx, Xpoint, Ypoint, (UBYTE)Acsii_Char, &Pen, 0, Color_Foreground, Color_Background);
+}
+
+/******************************************************************************
+function: Block corners of a scaled glyph row that change color
+parameter:
+    Column    : First of the 32 cell columns
+    Row       : Glyph row
+    Cell_Mask : Columns inside the cell
+    Corners   : Top left, top right, bottom left and bottom right corners
+                that take the other color
+return:
+    The pixels
+info:
+    A corner takes the color of its two neighbours when they agree and
+    the opposite two do not (Scale2x), which fills in the steps of
+    diagonal edges and cuts off lone corners. Top and bottom corners on
+    one side never both apply.
+******************************************************************************/
+static UDOUBLE Paint_CellCorners(const PAINT_GLYPH *Glyph, int Column, int Row, UDOUBLE Cell_Mask,
+                                 UDOUBLE *Corners)
+{
+    UDOUBLE P = Paint_CellBits(Glyph, Column, Row) & Cell_Mask;
+    UDOUBLE T = Paint_CellBits(Glyph, Column, Row - 1) & Cell_Mask;
+    UDOUBLE B = Paint_CellBits(Glyph, Column, Row + 1) & Cell_Mask;
+    UDOUBLE L = Paint_CellBits(Glyph, Column - 1, Row);
+    UDOUBLE R = Paint_CellBits(Glyph, Column + 1, Row) & (Cell_Mask << 1);
+    Corners[0] = ~(T ^ L) & (T ^ R) & (L ^ B) & (T ^ P) & Cell_Mask;
+    Corners[1] = ~(T ^ R) & (T ^ L) & (R ^ B) & (T ^ P) & Cell_Mask;
+    Corners[2] = ~(B ^ L) & (B ^ R) & (L ^ T) & (B ^ P) & Cell_Mask;
+    Corners[3] = ~(B ^ R) & (B ^ L) & (R ^ T) & (B ^ P) & Cell_Mask;
+    return P;
+}
+
+/**
+ * One row of a scaled glyph being turned into spans
+**/
+typedef struct {
+    PaintContext *Ctx;
+    int Xpoint;         //Left of the cell
+    int Y;              //Top row and number of rows of the spans
+    int Rows;
+    UWORD Fore;
+    UWORD Back;
+    UBYTE Fill_Back;    //Background runs are drawn too
+    int Start;          //Run being collected, from Xpoint + Start
+    UBYTE Set;
+} PAINT_SCALED_ROW;
+
+//End the current run at X and fill it
+static void Paint_ScaledFill(PAINT_SCALED_ROW *Row, int X)
+{
+    if (X > Row->Start && (Row->Set || Row->Fill_Back))
+        PaintCtx_FillRect(Row->Ctx, Row->Xpoint + Row->Start, Row->Y, Row->Xpoint + X, Row->Y + Row->Rows,
+                          Row->Set ? Row->Fore : Row->Back);
+    Row->Start = X;
+}
+
+//Continue the row with pixels of Set from X on
+static void Paint_ScaledRun(PAINT_SCALED_ROW *Row, int X, UBYTE Set)
+{
+    if (Set == Row->Set)
+        return;
+    Paint_ScaledFill(Row, X);
+    Row->Set = Set;
+}
+
+/******************************************************************************
+function: Show one character enlarged by a whole factor
+parameter:
+    Xpoint           ：X coordinate
+    Ypoint           ：Y coordinate
+    Code             ：Unicode code point of the character
+    Pen              ：Pen the line was started with, for the font and the
+                       rows of the styles
+    Factor           ：Every font pixel becomes Factor x Factor pixels
+    Flags            ：TEXT_SMOOTH to round off diagonal edges, styles and
+                       TEXT_TABULAR
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    Each glyph row is scanned 32 pixels at a time for the columns where
+    the color changes, and every run between them is filled as one span
+    Factor times as long and Factor rows high.
+    With TEXT_SMOOTH a block corner may take the other color as a
+    triangle of Factor - 1 pixels, see Paint_CellCorners; the rows of
+    such a block differ and are filled one by one.
+    Styles are applied to the font pixels, before they are enlarged. At
+    factor 1 the character is blitted like an unscaled one.
+******************************************************************************/
+static void PaintCtx_DrawCodeScaled(PaintContext *Ctx, UWORD Xpoint, UWORD Ypoint, UDOUBLE Code,
+                                    const PAINT_PEN *Pen, UBYTE Factor, UWORD Flags,
+                                    UWORD Color_Foreground, UWORD Color_Background)
+{
+    const sFONT *Font = Pen->Font;
+    PAINT_GLYPH Glyph;
+    if (Factor <= 1) {
+        if (Factor)
+            PaintCtx_DrawCode(Ctx, Xpoint, Ypoint, Code, Pen, Flags, Color_Foreground, Color_Background);
+        return;
+    }
+    Paint_FindGlyph(Font, Code, &Glyph);
+    Paint_FitGlyph(Code, &Glyph, Pen->Digit);
+    Paint_StyleGlyph(Pen, &Glyph, Flags);
+    int Cell_Width = Glyph.Advance;
+    if (Flags & TEXT_INVERSE) {
+        UWORD Color = Color_Foreground;
+        Color_Foreground = Color_Background;
+        Color_Background = Color;
+    }
+    UBYTE Smooth = (Flags & TEXT_SMOOTH) && Factor > 1;
+
+    //Font rows that reach into the clip window
+    const PAINT_RECT *Clip = &Ctx->Clip[Ctx->ClipDepth];
+    int Page_Start = Clip->Ystart > Ypoint ? (Clip->Ystart - Ypoint) / Factor : 0;
+    int Page_End = Font->Height;
+    if (Ypoint + Font->Height * Factor > Clip->Yend)
+        Page_End = Clip->Yend > Ypoint ? (Clip->Yend - Ypoint + Factor - 1) / Factor : 0;
+    if (Page_Start >= Page_End || Xpoint >= Clip->Xend || Xpoint + Cell_Width * Factor <= Clip->Xstart)
+        return;
+
+    UBYTE Scratch[GLYPH_ROWS * 4];
+    PaintCtx_LoadGlyph(Ctx, Font, &Glyph, Scratch);
+
+    PAINT_SCALED_ROW Row;
+    Row.Ctx = Ctx;
+    Row.Xpoint = Xpoint;
+    Row.Fore = Color_Foreground;
+    Row.Back = Color_Background;
+    Row.Fill_Back = FONT_BACKGROUND != Color_Background;
+
+    for (int Page = Page_Start; Page < Page_End; Page++) {
+        //Without corners to fill, the rows of a block are alike
+        Row.Rows = Factor;
+        for (int Column = 0; Smooth && Column < Cell_Width && Row.Rows > 1; Column += 32) {
+            UDOUBLE Cell_Mask = Cell_Width - Column >= 32 ? 0xFFFFFFFF : ~(0xFFFFFFFF >> (Cell_Width - Column));
+            UDOUBLE Corners[4];
+            Paint_CellCorners(&Glyph, Column, Page, Cell_Mask, Corners);
+            if (Corners[0] | Corners[1] | Corners[2] | Corners[3])
+                Row.Rows = 1;
+        }
+
+        for (int Sub = 0; Sub < Factor; Sub += Row.Rows) {
+            Row.Y = Ypoint + Page * Factor + Sub;
+            Row.Start = 0;
+            Row.Set = 0;
+            for (int Column = 0; Column < Cell_Width; Column += 32) {
+                UDOUBLE Cell_Mask = Cell_Width - Column >= 32 ? 0xFFFFFFFF : ~(0xFFFFFFFF >> (Cell_Width - Column));
+                UDOUBLE Corners[4] = {0, 0, 0, 0};
+                UDOUBLE Set = Row.Rows == 1 ? Paint_CellCorners(&Glyph, Column, Page, Cell_Mask, Corners)
+                                            : Paint_CellBits(&Glyph, Column, Page) & Cell_Mask;
+                //Top corners cover Factor - 1 - Sub pixels of this row, bottom ones Sub
+                if (Sub == Factor - 1)
+                    Corners[0] = Corners[1] = 0;
+                if (Sub == 0)
+                    Corners[2] = Corners[3] = 0;
+
+                UDOUBLE Stops = Corners[0] | Corners[1] | Corners[2] | Corners[3];
+                for (int i = 0; i < 32; i++) {
+                    //Next column that starts a new run or has a corner
+                    UDOUBLE Change = ((Row.Set ? ~Set : Set) | Stops) & Cell_Mask & (0xFFFFFFFF >> i);
+                    if (Change == 0)
+                        break;
+                    i = __builtin_clz(Change);
+                    UDOUBLE Bit = 0x80000000 >> i;
+                    UBYTE Pixel = (Set & Bit) != 0;
+                    int X = (Column + i) * Factor;
+                    int Left_Len = (Corners[0] & Bit) ? Factor - 1 - Sub : (Corners[2] & Bit) ? Sub : 0;
+                    int Right_Len = (Corners[1] & Bit) ? Factor - 1 - Sub : (Corners[3] & Bit) ? Sub : 0;
+                    if (Left_Len)
+                        Paint_ScaledRun(&Row, X, !Pixel);
+                    Paint_ScaledRun(&Row, X + Left_Len, Pixel);
+                    if (Right_Len)
+                        Paint_ScaledRun(&Row, X + Factor - Right_Len, !Pixel);
+                }
+            }
+            Paint_ScaledFill(&Row, Cell_Width * Factor);
+        }
+    }
+}
+
+//A single byte is taken as a Latin-1 character
+void PaintCtx_DrawCharScaled(PaintContext *Ctx, UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                             sFONT* Font, UBYTE Factor, UWORD Flags,
+                             UWORD Color_Foreground, UWORD Color_Background)
+{
+    PAINT_PEN Pen;
+    Paint_PenStart(&Pen, Font, Flags);
+    PaintCtx_DrawCodeScaled(Ctx, Xpoint, Ypoint, (UBYTE)Acsii_Char, &Pen, Factor, Flags,
+                            Color_Foreground, Color_Background);
+}
+
+/******************************************************************************
+function: Draw a character at its place on a line
+parameter:
+    Xstart : Start of the line
+    Glyph  : Character, its cell and where it is on the line
+    Pen    : Pen of the line, placed at the character; its End is the
+             end of the cell before it
+    Factor : Scale factor, 0 for the font size
+info:
+    Kerning opens a gap between two cells or lets one cover the other.
+    With an opaque background the gap is filled, and a cell kerned into
+    the one before has the rest of it filled and the character drawn over
+    it without background, which would hide that character's ink; the
+    pixels are then those of the run drawn at once.
+******************************************************************************/
+static void PaintCtx_DrawPlaced(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, const PAINT_GLYPH_POS *Glyph,
+                                const PAINT_PEN *Pen, UBYTE Factor, UWORD Flags,
+                                UWORD Color_Foreground, UWORD Color_Background)
+{
+    UDOUBLE End = Pen->End;
+    UWORD Scale = Factor ? Factor : 1;
+    UDOUBLE Xpoint = Xstart + (UDOUBLE)Glyph->X * Scale;
+    if (End != Glyph->X && (Color_Background != FONT_BACKGROUND || (Flags & TEXT_INVERSE))) {
+        if (Flags & TEXT_INVERSE) {
+            UWORD Color = Color_Foreground;
+            Color_Foreground = Color_Background;
+            Color_Background = Color;
+            Flags &= ~TEXT_INVERSE;
+        }
+        if (Color_Background != FONT_BACKGROUND) {
+            UDOUBLE Cell_End = Glyph->X + Glyph->Width;
+            UDOUBLE Fill = End < Cell_End ? End : Cell_End;
+            PaintCtx_FillRect(Ctx, Xstart + Fill * Scale, Ystart, Xstart + Cell_End * Scale,
+                              Ystart + Pen->Font->Height * Scale, Color_Background);
+            Color_Background = FONT_BACKGROUND;
+        }
+    }
+    if (Factor)
+        PaintCtx_DrawCodeScaled(Ctx, Xpoint, Ystart, Glyph->Code, Pen, Factor, Flags,
+                                Color_Foreground, Color_Background);
+    else
+        PaintCtx_DrawCode(Ctx, Xpoint, Ystart, Glyph->Code, Pen, Flags, Color_Foreground, Color_Background);
+}
+
+/******************************************************************************
+function: Draw Len bytes of a UTF-8 string on one line, glyph by glyph
+parameter:
+    Factor : Scale factor, 0 for the font size
+    Flags  : TEXT_* styles, TEXT_TABULAR, and TEXT_SMOOTH for scaled text
+info:
+    Characters starting past the clip window are skipped.
+******************************************************************************/
+static void PaintCtx_DrawGlyphs(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, const char *pString, UWORD Len,
+                                sFONT* Font, UBYTE Factor, UWORD Flags,
+                                UWORD Color_Foreground, UWORD Color_Background)
+{
+    const char *End = pString + Len;
+    UWORD Scale = Factor ? Factor : 1;
+    PAINT_PEN Pen;
+    Paint_PenStart(&Pen, Font, Flags);
+    PAINT_GLYPH_POS Glyph;
+    while (pString < End) {
+        Glyph.Code = Paint_NextChar(&pString);
+        UDOUBLE Left = Paint_PenNext(&Pen, Glyph.Code);
+        if (Xstart + Left * Scale >= Ctx->Clip[Ctx->ClipDepth].Xend)
+            break;
+        Glyph.X = Left;
+        Glyph.Width = Pen.X - Left;
+        PaintCtx_DrawPlaced(Ctx, Xstart, Ystart, &Glyph, &Pen, Factor, Flags,
+                            Color_Foreground, Color_Background);
+    }
+}
+
+//Width of Len bytes of a UTF-8 string on one line, at the font size
+static UDOUBLE Paint_RunWidth(const char *pString, UWORD Len, const sFONT* Font, UWORD Flags)
+{
+    const char *End = pString + Len;
+    PAINT_PEN Pen;
+    Paint_PenStart(&Pen, Font, Flags);
+    while (pString < End)
+        Paint_PenNext(&Pen, Paint_NextChar(&pString));
+    return Pen.X;
+}
+
+//FNV-1a hash of a text run
+static UDOUBLE Paint_HashText(const char *pString, UWORD Len)
+{
+    UDOUBLE Hash = 2166136261u;
+    for (UWORD i = 0; i < Len; i++)
+        Hash = (Hash ^ (UBYTE)pString[i]) * 16777619u;
+    return Hash;
+}
+
+/******************************************************************************
+function: Admit a run to the text-run cache on its second use
+parameter:
+    Key : Hash of the run, its font and the way it is drawn
+return:
+    1 if the run was seen once before; it is then forgotten as seen
+info:
+    The runs seen once are kept in a ring as long as the run table, so a
+    string drawn on every frame is admitted on the second frame, while a
+    reading that changes every time never takes room in the pool.
+******************************************************************************/
+static UBYTE PaintTextCache_Admit(PAINT_TEXT_CACHE *Cache, UDOUBLE Key)
+{
+    if (Cache->SeenCount == 0)
+        return 1;
+    Key = Key ? Key : 1;
+    for (UWORD i = 0; i < Cache->SeenCount; i++) {
+        if (Cache->Seen[i] == Key) {
+            Cache->Seen[i] = 0;
+            return 1;
+        }
+    }
+    Cache->Seen[Cache->SeenNext] = Key;
+    Cache->SeenNext = (Cache->SeenNext + 1) % Cache->SeenCount;
+    Cache->Declined++;
+    return 0;
+}
+
+//Drop a run and close the gap it leaves in the pool
+static void PaintTextCache_Evict(PAINT_TEXT_CACHE *Cache, PAINT_TEXT_RUN *Run)
+{
+    UDOUBLE End = Run->Offset + Run->Size;
+    memmove(Cache->Pool + Run->Offset, Cache->Pool + End, (Cache->PoolUsed - End) * 4);
+    for (UWORD i = 0; i < Cache->Count; i++)
+        if (Cache->Runs[i].Font && Cache->Runs[i].Offset > Run->Offset)
+            Cache->Runs[i].Offset -= Run->Size;
+    Cache->PoolUsed -= Run->Size;
+    Run->Font = NULL;
+    Cache->Evictions++;
+}
+
+//First column from Column on whose bit is Set, End if there is none before it
+static int Paint_NextBit(const UDOUBLE *Bits, int Column, int End, UBYTE Set)
+{
+    while (Column < End) {
+        UDOUBLE Word = (Set ? Bits[Column / 32] : ~Bits[Column / 32]) << (Column % 32);
+        if (Word) {
+            Column += __builtin_clz(Word);
+            return Column < End ? Column : End;
+        }
+        Column = (Column / 32 + 1) * 32;
+    }
+    return End;
+}
+
+/******************************************************************************
+function: Write columns [Column_Start, Column_End) of a text run row into one plane
+parameter:
+    Red    : 1 for the red plane
+    X, Y   : Memory position of column 0
+    Bits   : Row of the run, ink set
+    Fore   : 0x00 or 0xFF, written for the ink
+    Back   : 0x00 or 0xFF, written for the rest when Opaque
+******************************************************************************/
+static void PaintCtx_RunRow(PaintContext *Ctx, UBYTE Red, UWORD X, UWORD Y, const UDOUBLE *Bits,
+                            int Column_Start, int Column_End, UBYTE Fore, UBYTE Back, UBYTE Opaque)
+{
+    if (Red ? Ctx->SparseRed : Ctx->Sparse) {
+        //The background as one span, then every stretch of ink over it
+        if (Opaque)
+            PaintCtx_PlaneSpan(Ctx, Red, X + Column_Start, X + Column_End, Y, Back);
+        if (Opaque && Fore == Back)
+            return;
+        int Column = Column_Start;
+        while ((Column = Paint_NextBit(Bits, Column, Column_End, 1)) < Column_End) {
+            int Start = Column;
+            Column = Paint_NextBit(Bits, Column, Column_End, 0);
+            PaintCtx_PlaneSpan(Ctx, Red, X + Start, X + Column, Y, Fore);
+        }
+        return;
+    }
+
+    UBYTE *Image = Red ? Ctx->ImageRed : Ctx->Image;
+    if (Image == NULL)
+        return;
+    UBYTE *Row = Image + (UDOUBLE)(Y - Ctx->BandStart) * Ctx->WidthByte;
+    UDOUBLE Fore_Bits = Fore ? 0xFFFFFFFF : 0, Back_Bits = Back ? 0xFFFFFFFF : 0;
+    for (int Word = Column_Start / 32; Word * 32 < Column_End; Word++) {
+        UDOUBLE Mask = 0xFFFFFFFF;
+        if (Word * 32 < Column_Start)
+            Mask >>= Column_Start - Word * 32;
+        if (Word * 32 + 32 > Column_End)
+            Mask &= ~(0xFFFFFFFF >> (Column_End - Word * 32));
+        UDOUBLE Ink = Bits[Word] & Mask;
+        Paint_BlitBits(Row, X + Word * 32, Opaque ? Mask : Ink, (Ink & Fore_Bits) | (~Ink & Back_Bits));
+    }
+}
+
+/******************************************************************************
+function: Draw a string on one line from the context's text-run cache
+parameter:
+    Xstart, Ystart : Top left of the run
+    pString, Len   : UTF-8 bytes of the run
+    Layout         : The run laid out by PaintLayout_String, or NULL to
+                     place its characters here
+    Factor, Flags  : As for PaintCtx_DrawStringScaled, Factor 0 for the
+                     font size
+    Room           : Widest run to draw, a wider one is left to the caller
+return:
+    0 when the run has to be drawn glyph by glyph instead
+info:
+    A run not found is left to the caller the first time it is seen. The
+    second time it is rasterized with the glyph functions into the pool,
+    through a context of its own, and then blitted like one that was
+    found: a row at a time, merged a word at a time into dense planes or
+    as spans of ink into sparse ones. Room is made by dropping the least
+    recently used runs; the pool is kept packed, so a run that fits in
+    the pool always finds room. Mirroring along x would reverse the bits
+    and is left to the glyph path.
+******************************************************************************/
+static UBYTE PaintCtx_DrawRunCached(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, const char *pString, UWORD Len,
+                                    const PAINT_LAYOUT *Layout, sFONT* Font, UBYTE Factor, UWORD Flags, UWORD Room,
+                                    UWORD Color_Foreground, UWORD Color_Background)
+{
+    PAINT_TEXT_CACHE *Cache = Ctx->TextCache;
+    UBYTE Flip_X = (Ctx->Rotate == ROTATE_180) ^ ((Ctx->Mirror & MIRROR_HORIZONTAL) ? 1 : 0);
+    if (Cache == NULL || Cache->Count == 0 || Len == 0 || Ctx->Scale != 2 || Flip_X ||
+        Ctx->Rotate == ROTATE_90 || Ctx->Rotate == ROTATE_270)
+        return 0;
+    //Inverse text is the same ink in swapped colors
+    if (Flags & TEXT_INVERSE) {
+        UWORD Color = Color_Foreground;
+        Color_Foreground = Color_Background;
+        Color_Background = Color;
+        Flags &= ~TEXT_INVERSE;
+    }
+
+    UDOUBLE Hash = Paint_HashText(pString, Len);
+    PAINT_TEXT_RUN *Run = NULL, *Free = NULL;
+    Cache->Clock++;
+    for (UWORD i = 0; i < Cache->Count && Run == NULL; i++) {
+        PAINT_TEXT_RUN *Found = &Cache->Runs[i];
+        if (Found->Font == NULL) {
+            Free = Free ? Free : Found;
+        } else if (Found->Font == Font && Found->Hash == Hash && Found->Len == Len &&
+                   Found->Factor == Factor && Found->Flags == Flags &&
+                   memcmp(Cache->Pool + Found->Offset + Found->Size - (Len + 3) / 4, pString, Len) == 0) {
+            Run = Found;
+        }
+    }
+
+    UDOUBLE Words;
+    if (Run) {
+        if (Run->Width > Room)
+            return 0;
+        Words = (Run->Width + 31) / 32;
+        Cache->Hits++;
+    } else {
+        UDOUBLE Key = Hash ^ ((UDOUBLE)(uintptr_t)Font * 31 + Factor) * 16777619u ^ Flags;
+        if (!PaintTextCache_Admit(Cache, Key))
+            return 0;
+
+        //Size of the run, and of the bitmap and string it takes in the pool
+        UWORD Scale = Factor ? Factor : 1;
+        UDOUBLE Width = (Layout ? Layout->Width : Paint_RunWidth(pString, Len, Font, Flags)) * Scale;
+        if (Width > Room)
+            return 0;
+        Words = (Width + 31) / 32;
+        UDOUBLE Height = (UDOUBLE)Font->Height * Scale;
+        UDOUBLE Size = Height * Words + (Len + 3) / 4;
+        if (Width == 0 || Width > 0x7FFF || Height > 0xFFFF || Size > Cache->PoolWords) {
+            Cache->Bypassed++;
+            return 0;
+        }
+
+        while (Free == NULL || Cache->PoolWords - Cache->PoolUsed < Size) {
+            PAINT_TEXT_RUN *Oldest = NULL;
+            for (UWORD i = 0; i < Cache->Count; i++)
+                if (Cache->Runs[i].Font && (Oldest == NULL || Cache->Runs[i].Used < Oldest->Used))
+                    Oldest = &Cache->Runs[i];
+            PaintTextCache_Evict(Cache, Oldest);
+            Free = Free ? Free : Oldest;
+        }
+        Run = Free;
+        Run->Font = Font;
+        Run->Hash = Hash;
+        Run->Offset = Cache->PoolUsed;
+        Run->Size = Size;
+        Run->Width = Width;
+        Run->Height = Height;
+        Run->Len = Len;
+        Run->Factor = Factor;
+        Run->Flags = Flags;
+        Cache->PoolUsed += Size;
+        if (Cache->PoolUsed * 4 > Cache->PeakBytes)
+            Cache->PeakBytes = Cache->PoolUsed * 4;
+        Cache->Misses++;
+
+        //Black on white into the pool, then turned into words with the ink set
+        UDOUBLE *Bits = Cache->Pool + Run->Offset;
+        PaintContext Raster;
+        PaintCtx_NewImage(&Raster, (UBYTE *)Bits, Words * 32, Height, ROTATE_0, WHITE);
+        Raster.GlyphCache = Ctx->GlyphCache;
+        PaintCtx_Clear(&Raster, WHITE);
+        if (Layout) {
+            PAINT_LAYOUT Plain = *Layout;
+            Plain.Flags = Flags;
+            PaintCtx_DrawLayout(&Raster, 0, 0, &Plain, Scale, BLACK, WHITE);
+        } else {
+            PaintCtx_DrawGlyphs(&Raster, 0, 0, pString, Len, Font, Factor, Flags, BLACK, WHITE);
+        }
+        for (UDOUBLE i = 0; i < Height * Words; i++) {
+            const UBYTE *p = (const UBYTE *)&Bits[i];
+            Bits[i] = ~((UDOUBLE)p[0] << 24 | (UDOUBLE)p[1] << 16 | (UDOUBLE)p[2] << 8 | p[3]);
+        }
+        memcpy(Bits + Height * Words, pString, Len);
+    }
+    Run->Used = Cache->Clock;
+
+    //Part of the run inside the clip window
+    const PAINT_RECT *Clip = &Ctx->Clip[Ctx->ClipDepth];
+    int Column_Start = Clip->Xstart > Xstart ? Clip->Xstart - Xstart : 0;
+    int Column_End = Xstart + Run->Width > Clip->Xend ? Clip->Xend - Xstart : Run->Width;
+    int Row_Start = Clip->Ystart > Ystart ? Clip->Ystart - Ystart : 0;
+    int Row_End = Ystart + Run->Height > Clip->Yend ? Clip->Yend - Ystart : Run->Height;
+    if (Column_Start >= Column_End || Row_Start >= Row_End)
+        return 1;
+
+    UBYTE Flip_Y = (Ctx->Rotate == ROTATE_180) ^ ((Ctx->Mirror & MIRROR_VERTICAL) ? 1 : 0);
+    UBYTE Opaque = FONT_BACKGROUND != Color_Background;
+    UBYTE Fore = PaintCtx_BlackFill(Ctx, Color_Foreground), Back = PaintCtx_BlackFill(Ctx, Color_Background);
+    UBYTE Fore_Red = Paint_RedFill(Color_Foreground), Back_Red = Paint_RedFill(Color_Background);
+    for (int Row = Row_Start; Row < Row_End; Row++) {
+        const UDOUBLE *Bits = Cache->Pool + Run->Offset + Row * Words;
+        UWORD Y = Flip_Y ? Ctx->HeightMemory - 1 - (Ystart + Row) : Ystart + Row;
+        PaintCtx_RunRow(Ctx, 0, Xstart, Y, Bits, Column_Start, Column_End, Fore, Back, Opaque);
+        if (Ctx->TriColor)
+            PaintCtx_RunRow(Ctx, 1, Xstart, Y, Bits, Column_Start, Column_End, Fore_Red, Back_Red, Opaque);
+    }
+    return 1;
+}
+
+/******************************************************************************
+function:	Display the string
+parameter:
+    Xstart           ：X coordinate
+    Ystart           ：Y coordinate
+    pString          ：UTF-8 string to be displayed
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+void PaintCtx_DrawString_EN(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, const char * pString,
+                         sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Ypoint = Ystart;
+
+    if (Xstart > Ctx->Width || Ystart > Ctx->Height) {
+        Debug("Paint_DrawString_EN Input exceeds the normal display range\r\n");
+        return;
+    }
+
+    //A string that fits on the line is one run
+    if (Ctx->TextCache && Ystart + Font->Height <= Ctx->Height) {
+        size_t Len = strlen(pString);
+        if (Len <= 0xFFFF && PaintCtx_DrawRunCached(Ctx, Xstart, Ystart, pString, Len, NULL, Font, 0, 0,
+                                                    Ctx->Width - Xstart, Color_Foreground, Color_Background))
+            return;
+    }
+
+    PAINT_GLYPH_POS Glyph;
+    PAINT_PEN Pen;
+    Paint_PenStart(&Pen, Font, 0);
+    while ((Glyph.Code = Paint_NextChar(&pString)) != 0) {
+        UDOUBLE Left = Paint_PenNext(&Pen, Glyph.Code);
+
+        //if X direction filled , reposition to(Xstart,Ypoint),Ypoint is Y direction plus the Height of the character
+        if ((Xstart + Pen.X) > Ctx->Width ) {
+            Paint_PenStart(&Pen, Font, 0);
+            Left = Paint_PenNext(&Pen, Glyph.Code);
+            Ypoint += Font->Height;
+        }
+
+        // If the Y direction is full, the rest of the string is dropped
+        if ((Ypoint  + Font->Height ) > Ctx->Height ) {
+            Debug("Paint_DrawString_EN String runs off the bottom\r\n");
+            return;
+        }
+        Glyph.X = Left;
+        Glyph.Width = Pen.X - Left;
+        PaintCtx_DrawPlaced(Ctx, Xstart, Ypoint, &Glyph, &Pen, 0, 0,
+                            Color_Foreground, Color_Background);
+    }
+}
+
+/******************************************************************************
+function:	Display a string enlarged by a whole factor
 parameter:
     Xstart           ：X coordinate
     Ystart           ：Y coordinate
-    pString          ：The first address of the English string to be displayed
+    pString          ：UTF-8 string to be displayed
     Font             ：A structure pointer that displays a character size
+    Factor           ：Every font pixel becomes Factor x Factor pixels
+    Flags            ：TEXT_SMOOTH to round off diagonal edges, styles and
+                       TEXT_TABULAR
     Color_Foreground : Select the foreground color
     Color_Background : Select the background color
+info:
+    The string stays on one line, clipped at the edge; it is
+    Paint_MeasureString() * Factor wide, or as wide as PaintLayout_String()
+    lays it out with TEXT_TABULAR, and Font->Height * Factor high.
+    At factor 1 it is drawn like Paint_DrawString_EN, so that is the way
+    to draw styled text at the font size.
 ******************************************************************************/
-void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString,
-                         sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+void PaintCtx_DrawStringScaled(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, const char * pString,
+                               sFONT* Font, UBYTE Factor, UWORD Flags,
+                               UWORD Color_Foreground, UWORD Color_Background)
 {
-    UWORD Xpoint = Xstart;
-    UWORD Ypoint = Ystart;
+    UDOUBLE Xpoint = Xstart;
 
-    if (Xstart > Paint.Width || Ystart > Paint.Height) {
-        Debug("Paint_DrawString_EN Input exceeds the normal display range\r\n");
+    if (Xstart > Ctx->Width || Ystart > Ctx->Height) {
+        Debug("Paint_DrawStringScaled Input exceeds the normal display range\r\n");
+        return;
+    }
+    if (Factor == 0)
         return;
+    if (Ctx->TextCache) {
+        size_t Len = strlen(pString);
+        if (Len <= 0xFFFF && PaintCtx_DrawRunCached(Ctx, Xstart, Ystart, pString, Len, NULL, Font, Factor, Flags,
+                                                    0xFFFF, Color_Foreground, Color_Background))
+            return;
     }
 
-    while (* pString != '\0') {
-        //if X direction filled , reposition to(Xstart,Ypoint),Ypoint is Y direction plus the Height of the character
-        if ((Xpoint + Font->Width ) > Paint.Width ) {
-            Xpoint = Xstart;
-            Ypoint += Font->Height;
+    PAINT_GLYPH_POS Glyph;
+    PAINT_PEN Pen;
+    Paint_PenStart(&Pen, Font, Flags);
+    while ((Glyph.Code = Paint_NextChar(&pString)) != 0) {
+        UDOUBLE Left = Paint_PenNext(&Pen, Glyph.Code);
+        Xpoint = Xstart + Left * Factor;
+        if (Xpoint >= Ctx->Width)
+            break;
+        Glyph.X = Left;
+        Glyph.Width = Pen.X - Left;
+        PaintCtx_DrawPlaced(Ctx, Xstart, Ystart, &Glyph, &Pen, Factor, Flags,
+                            Color_Foreground, Color_Background);
+    }
+}
+
+/******************************************************************************
+function:	Width of a string drawn on one line
+parameter:
+    pString : UTF-8 string to measure
+    Font    : Font it is drawn in
+******************************************************************************/
+UWORD Paint_MeasureString(const char * pString, sFONT* Font)
+{
+    UDOUBLE Code;
+    PAINT_PEN Pen;
+    Paint_PenStart(&Pen, Font, 0);
+    while ((Code = Paint_NextChar(&pString)) != 0)
+        Paint_PenNext(&Pen, Code);
+    return Pen.X > 0xFFFF ? 0xFFFF : Pen.X;
+}
+
+/******************************************************************************
+function:	Give a layout the positions it fills
+parameter:
+    Layout   : Layout to set up
+    Glyphs   : Room for the positions
+    Capacity : Number of positions, the most characters a layout holds
+******************************************************************************/
+void PaintLayout_Init(PAINT_LAYOUT *Layout, PAINT_GLYPH_POS *Glyphs, UWORD Capacity)
+{
+    memset(Layout, 0, sizeof(PAINT_LAYOUT));
+    Layout->Glyphs = Glyphs;
+    Layout->Capacity = Capacity;
+}
+
+/******************************************************************************
+function:	Lay out a string on one line
+parameter:
+    Layout  : Layout set up by PaintLayout_Init, filled in
+    pString : UTF-8 string
+    Font    : Font it is drawn in
+    Flags   : TEXT_TABULAR, and the styles and TEXT_SMOOTH it is drawn with
+return:
+    Width of the string, at the font size
+info:
+    Every character is looked up once, kerned against the one before it
+    and placed, so the same positions serve to measure, align and draw the
+    string, and to compare it with another one. A string with more
+    characters than the layout holds is laid out as far as it fits.
+******************************************************************************/
+UWORD PaintLayout_String(PAINT_LAYOUT *Layout, const char * pString, sFONT* Font, UWORD Flags)
+{
+    PAINT_PEN Pen;
+    const char *p = pString;
+    UDOUBLE Code;
+    Paint_PenStart(&Pen, Font, Flags);
+    Layout->Count = 0;
+    while (Layout->Count < Layout->Capacity && (Code = Paint_NextChar(&p)) != 0) {
+        PAINT_GLYPH_POS *Glyph = &Layout->Glyphs[Layout->Count++];
+        UDOUBLE Left = Paint_PenNext(&Pen, Code);
+        Glyph->Code = Code;
+        Glyph->X = Left > 0xFFFF ? 0xFFFF : Left;
+        Glyph->Width = Pen.X - Left > 0xFFFF ? 0xFFFF : Pen.X - Left;
+    }
+    Layout->Text = pString;
+    Layout->Len = p - pString > 0xFFFF ? 0xFFFF : p - pString;
+    Layout->Font = Font;
+    Layout->Flags = Flags;
+    Layout->Width = Pen.X > 0xFFFF ? 0xFFFF : Pen.X;
+    return Layout->Width;
+}
+
+/******************************************************************************
+function:	Display a laid out string
+parameter:
+    Xstart           ：X coordinate
+    Ystart           ：Y coordinate
+    Layout           ：String laid out by PaintLayout_String
+    Factor           ：Every font pixel becomes Factor x Factor pixels, 1 for the font size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    The characters are drawn at the places of the layout, clipped like
+    Paint_DrawStringScaled; with a text cache the run comes from there.
+******************************************************************************/
+void PaintCtx_DrawLayout(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, const PAINT_LAYOUT *Layout, UBYTE Factor,
+                         UWORD Color_Foreground, UWORD Color_Background)
+{
+    if (Xstart > Ctx->Width || Ystart > Ctx->Height) {
+        Debug("Paint_DrawLayout Input exceeds the normal display range\r\n");
+        return;
+    }
+    if (Factor == 0 || Layout->Count == 0)
+        return;
+    if (Ctx->TextCache && PaintCtx_DrawRunCached(Ctx, Xstart, Ystart, Layout->Text, Layout->Len, Layout, Layout->Font,
+                                                 Factor, Layout->Flags, 0xFFFF,
+                                                 Color_Foreground, Color_Background))
+        return;
+
+    //The places come from the layout, the pen only carries the font's rows
+    PAINT_PEN Pen;
+    Paint_PenStart(&Pen, Layout->Font, Layout->Flags);
+    for (UWORD i = 0; i < Layout->Count; i++) {
+        const PAINT_GLYPH_POS *Glyph = &Layout->Glyphs[i];
+        if (Xstart + (UDOUBLE)Glyph->X * Factor >= Ctx->Clip[Ctx->ClipDepth].Xend)
+            break;
+        PaintCtx_DrawPlaced(Ctx, Xstart, Ystart, Glyph, &Pen, Factor, Layout->Flags,
+                            Color_Foreground, Color_Background);
+        Pen.End = Glyph->X + Glyph->Width;
+    }
+}
+
+/******************************************************************************
+function:	Find the next line of a text box
+parameter:
+    pString : Text, advanced past the line and the spaces or newline ending it
+    Font    : Font of the text
+    Width   : Width of the box
+    Flags   : TEXT_WRAP to break the line once the box is full, TEXT_TABULAR
+    Len     : Bytes of the line, without trailing spaces
+return:
+    Width of the line
+info:
+    One pass over the characters: the last space seen is remembered, so
+    a line that overflows goes back to it instead of being measured again.
+    Spaces never overflow, they hang past the edge and are dropped.
+******************************************************************************/
+static UWORD Paint_NextLine(const char **pString, const sFONT* Font, UWORD Width, UWORD Flags, UWORD *Len)
+{
+    const char *Start = *pString, *p = Start;
+    const char *Break = NULL;
+    UDOUBLE Break_Width = 0, Ink_Width = 0;
+    PAINT_PEN Pen;
+    Paint_PenStart(&Pen, Font, Flags);
+
+    while (*p != '\0' && *p != '\n') {
+        const char *Next = p;
+        UDOUBLE Line_Width = Pen.X;
+        Paint_PenNext(&Pen, Paint_NextChar(&Next));
+        if (*p == ' ') {
+            if (p > Start && p[-1] != ' ') {
+                Break = p;
+                Break_Width = Line_Width;
+            }
+        } else if ((Flags & TEXT_WRAP) && Pen.X > Width) {
+            if (Break == NULL) {
+                //A word wider than the box is broken where it overflows
+                if (p == Start) {
+                    Line_Width = Pen.X;
+                    p = Next;
+                }
+                *Len = p - Start;
+                *pString = p;
+                return Line_Width;
+            }
+            *Len = Break - Start;
+            while (*Break == ' ')
+                Break++;
+            *pString = Break;
+            return Break_Width;
+        } else {
+            Ink_Width = Pen.X;
         }
+        p = Next;
+    }
 
-        // If the Y direction is full, reposition to(Xstart, Ystart)
-        if ((Ypoint  + Font->Height ) > Paint.Height ) {
-            Xpoint = Xstart;
-            Ypoint = Ystart;
+    //Trailing spaces are not drawn, the line ends with its last character
+    const char *End = p;
+    while (End > Start && End[-1] == ' ')
+        End--;
+    *Len = End - Start;
+    *pString = *p == '\n' ? p + 1 : p;
+    return Ink_Width > 0xFFFF ? 0xFFFF : Ink_Width;
+}
+
+/******************************************************************************
+function:	Number of lines a text box needs
+parameter:
+    pString : Text, '\n' starts a new line
+    Font    : Font of the text
+    Width   : Width of the box
+    Flags   : TEXT_* layout, only TEXT_WRAP and TEXT_TABULAR matter
+******************************************************************************/
+UWORD Paint_MeasureTextBox(const char * pString, sFONT* Font, UWORD Width, UWORD Flags)
+{
+    UWORD Lines = 0, Len;
+    while (*pString != '\0') {
+        Paint_NextLine(&pString, Font, Width, Flags, &Len);
+        Lines++;
+    }
+    return Lines;
+}
+
+/******************************************************************************
+function:	Display text inside a box
+parameter:
+    Xstart           ：X coordinate of the box
+    Ystart           ：Y coordinate of the box
+    Xend             ：End of the box, not included
+    Yend             ：End of the box, not included
+    pString          ：UTF-8 text, '\n' starts a new line
+    Font             ：A structure pointer that displays a character size
+    Flags            ：TEXT_LEFT, TEXT_CENTER or TEXT_RIGHT, with TEXT_WRAP,
+                       TEXT_ELLIPSIS and the styles
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+return:
+    Lines drawn
+info:
+    Each line is laid out and drawn as soon as its break is found.
+    Lines are drawn while they fit in full, at least the first one, and
+    everything is clipped to the box.
+******************************************************************************/
+UWORD PaintCtx_DrawTextBox(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                           const char * pString, sFONT* Font, UWORD Flags,
+                           UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Width = Xend - Xstart;
+    UWORD Glyph_Flags = Flags & (TEXT_STYLE | TEXT_TABULAR);
+    UWORD Dots_Width = Paint_RunWidth("...", 3, Font, 0);
+    UWORD Ypoint = Ystart, Lines = 0;
+
+    if (Xstart >= Xend || Ystart >= Yend)
+        return 0;
+
+    PaintCtx_PushClip(Ctx, Xstart, Ystart, Xend, Yend);
+    while (*pString != '\0' && (Lines == 0 || Ypoint + Font->Height <= Yend)) {
+        const char *Line = pString;
+        UWORD Len;
+        UDOUBLE Line_Width = Paint_NextLine(&pString, Font, Width, Flags, &Len);
+        UBYTE Last = Ypoint + 2 * Font->Height > Yend && *pString != '\0';
+        UBYTE Ellipsis = (Flags & TEXT_ELLIPSIS) && (Last || Line_Width > Width);
+
+        //Keep what fits in front of the "..."
+        if (Ellipsis) {
+            UDOUBLE Room = Width > Dots_Width ? Width - Dots_Width : 0;
+            const char *Kept = Line, *End = Line;
+            PAINT_PEN Pen;
+            Paint_PenStart(&Pen, Font, Flags);
+            Line_Width = 0;
+            while (Kept < Line + Len) {
+                const char *Next = Kept;
+                UDOUBLE Code = Paint_NextChar(&Next);
+                PAINT_PEN Try = Pen;
+                Paint_PenNext(&Try, Code);
+                if (Try.X > Room)
+                    break;
+                Pen = Try;
+                Kept = Next;
+                if (Code != ' ') {
+                    End = Kept;
+                    Line_Width = Pen.X;
+                }
+            }
+            Len = End - Line;
         }
-        Paint_DrawChar(Xpoint, Ypoint, * pString, Font, Color_Foreground, Color_Background);
 
-        //The next character of the address
-        pString ++;
+        UDOUBLE Full_Width = Ellipsis ? Line_Width + Dots_Width : Line_Width;
+        UWORD Xpoint = Xstart;
+        if (Full_Width < Width) {
+            if ((Flags & 0x03) == TEXT_CENTER)
+                Xpoint += (Width - Full_Width) / 2;
+            else if ((Flags & 0x03) == TEXT_RIGHT)
+                Xpoint += Width - Full_Width;
+        }
+        if (!PaintCtx_DrawRunCached(Ctx, Xpoint, Ypoint, Line, Len, NULL, Font, 0, Glyph_Flags, 0xFFFF,
+                                    Color_Foreground, Color_Background))
+            PaintCtx_DrawGlyphs(Ctx, Xpoint, Ypoint, Line, Len, Font, 0, Glyph_Flags,
+                                Color_Foreground, Color_Background);
+        if (Ellipsis)
+            PaintCtx_DrawGlyphs(Ctx, Xpoint + Line_Width, Ypoint, "...", 3, Font, 0, Flags & TEXT_STYLE,
+                                Color_Foreground, Color_Background);
 
-        //The next word of the abscissa increases the font of the broadband
-        Xpoint += Font->Width;
+        Ypoint += Font->Height;
+        Lines++;
     }
+    PaintCtx_PopClip(Ctx);
+    return Lines;
 }
 
 /******************************************************************************
@@ -650,36 +3137,20 @@ parameter:
     Color_Foreground : Select the foreground color
     Color_Background : Select the background color
 ******************************************************************************/
-#define  ARRAY_LEN 255
-void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber,
+void PaintCtx_DrawNum(PaintContext *Ctx, UWORD Xpoint, UWORD Ypoint, int32_t Nummber,
                    sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
 {
+    char Str[FORMAT_INT_LEN];
+    PAINT_FORMAT Fmt;
 
-    int16_t Num_Bit = 0, Str_Bit = 0;
-    uint8_t Str_Array[ARRAY_LEN] = {0}, Num_Array[ARRAY_LEN] = {0};
-    uint8_t *pStr = Str_Array;
-
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
+    if (Xpoint > Ctx->Width || Ypoint > Ctx->Height) {
         Debug("Paint_DisNum Input exceeds the normal display range\r\n");
         return;
     }
 
-    //Converts a number to a string
-    while (Nummber) {
-        Num_Array[Num_Bit] = Nummber % 10 + '0';
-        Num_Bit++;
-        Nummber /= 10;
-    }
-
-    //The string is inverted
-    while (Num_Bit > 0) {
-        Str_Array[Str_Bit] = Num_Array[Num_Bit - 1];
-        Str_Bit ++;
-        Num_Bit --;
-    }
-
-    //show
-    Paint_DrawString_EN(Xpoint, Ypoint, (const char*)pStr, Font, Color_Background, Color_Foreground);
+    PaintFormat_Init(&Fmt, Str, sizeof(Str));
+    PaintFormat_Int(&Fmt, Nummber);
+    PaintCtx_DrawString_EN(Ctx, Xpoint, Ypoint, Str, Font, Color_Foreground, Color_Background);
 }
 
 /******************************************************************************
@@ -692,18 +3163,29 @@ parameter:
     Color_Foreground : Select the foreground color
     Color_Background : Select the background color
 ******************************************************************************/
-void Paint_DrawDateTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font,
+void PaintCtx_DrawDateTime(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font,
                     UWORD Color_Foreground, UWORD Color_Background)
 {
     // Buffer to hold the formatted date and time string
-    char buffer[40];
+    char buffer[24];
+    PAINT_FORMAT Fmt;
 
     // Format the full string as MM/DD/YYYY HH:MM:SS
-    snprintf(buffer, sizeof(buffer), "%02d/%02d/%d %02d:%02d:%02d",
-             pTime->Month, pTime->Day, pTime->Year, pTime->Hour, pTime->Min, pTime->Sec);
+    PaintFormat_Init(&Fmt, buffer, sizeof(buffer));
+    PaintFormat_Digits(&Fmt, pTime->Month, 2);
+    PaintFormat_Char(&Fmt, '/');
+    PaintFormat_Digits(&Fmt, pTime->Day, 2);
+    PaintFormat_Char(&Fmt, '/');
+    PaintFormat_Int(&Fmt, pTime->Year);
+    PaintFormat_Char(&Fmt, ' ');
+    PaintFormat_Digits(&Fmt, pTime->Hour, 2);
+    PaintFormat_Char(&Fmt, ':');
+    PaintFormat_Digits(&Fmt, pTime->Min, 2);
+    PaintFormat_Char(&Fmt, ':');
+    PaintFormat_Digits(&Fmt, pTime->Sec, 2);
 
     // Draw the formatted string
-    Paint_DrawString_EN(Xstart, Ystart, buffer, Font, Color_Foreground, Color_Background);
+    PaintCtx_DrawString_EN(Ctx, Xstart, Ystart, buffer, Font, Color_Foreground, Color_Background);
 }
 
 /******************************************************************************
@@ -714,39 +3196,378 @@ info:
     Use a computer to convert the image into a corresponding array,
     and then embed the array directly into Imagedata.cpp as a .c file.
 ******************************************************************************/
-void Paint_DrawBitMap(const unsigned char* image_buffer)
+void PaintCtx_DrawBitMap(PaintContext *Ctx, const unsigned char* image_buffer)
 {
     UWORD x, y;
     UDOUBLE Addr = 0;
 
-    for (y = 0; y < Paint.HeightByte; y++) {
-        for (x = 0; x < Paint.WidthByte; x++) {//8 pixel =  1 byte
-            Addr = x + y * Paint.WidthByte;
-            Paint.Image[Addr] = (unsigned char)image_buffer[Addr];
+    //The bitmap is black and white, nothing stays red
+    if (Ctx->TriColor)
+        PaintCtx_ClearRed(Ctx, 0xFF);
+    if (Ctx->Sparse && !PaintCtx_Densify(Ctx, 0))
+        return;
+    if (Ctx->Image == NULL)
+        return;
+    for (y = 0; y < Ctx->BandHeight; y++) {
+        for (x = 0; x < Ctx->WidthByte; x++) {//8 pixel =  1 byte
+            Addr = x + y * Ctx->WidthByte;
+            Ctx->Image[Addr] = (unsigned char)image_buffer[Addr + Ctx->BandStart * Ctx->WidthByte];
         }
     }
 }
 
 /******************************************************************************
-function:	Display image
+function: Mirror the bits of a byte
+******************************************************************************/
+static UBYTE Paint_ReverseByte(UBYTE Bits)
+{
+    Bits = (Bits >> 4) | (Bits << 4);
+    Bits = ((Bits >> 2) & 0x33) | ((Bits << 2) & 0xCC);
+    Bits = ((Bits >> 1) & 0x55) | ((Bits << 1) & 0xAA);
+    return Bits;
+}
+
+/******************************************************************************
+function: Fetch 8 bits of an image row starting at any bit offset
+parameter:
+    Row     : Image row
+    Row_Len : Bytes in the row, bits outside it read as white
+    Offset  : Bit offset of the first pixel, may be negative
+******************************************************************************/
+static UBYTE Paint_FetchBits(const UBYTE *Row, int Row_Len, int Offset)
+{
+    int Byte = Offset >> 3, Shift = Offset & 7;
+    UBYTE High = (Byte >= 0 && Byte < Row_Len) ? Row[Byte] : 0xFF;
+    if (Shift == 0)
+        return High;
+    UBYTE Low = (Byte + 1 >= 0 && Byte + 1 < Row_Len) ? Row[Byte + 1] : 0xFF;
+    return (High << Shift) | (Low >> (8 - Shift));
+}
+
+/******************************************************************************
+function: Merge 8 image pixels into a byte of a plane
+parameter:
+    Dest : Plane byte
+    Bits : Image pixels, bit 1 = white
+    Mask : Pixels of the byte covered by the image
+    Mode : IMAGE_COPY, IMAGE_AND or IMAGE_OR
+******************************************************************************/
+static UBYTE Paint_MergeBits(UBYTE Dest, UBYTE Bits, UBYTE Mask, UBYTE Mode)
+{
+    if (Mode == IMAGE_AND)
+        return Dest & (Bits | ~Mask);
+    if (Mode == IMAGE_OR)
+        return Dest | (Bits & Mask);
+    return (Dest & ~Mask) | (Bits & Mask);
+}
+
+/******************************************************************************
+function: Display image
 parameter:
     image            ：Image start address
     xStart           : X starting coordinates
     yStart           : Y starting coordinates
     xEnd             ：Image width
     yEnd             : Image height
+info:
+    The image is drawn opaque, see PaintCtx_DrawImageMode.
 ******************************************************************************/
-void Paint_DrawImage(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image) 
+void PaintCtx_DrawImage(PaintContext *Ctx, const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image) 
 {
-    UWORD x, y;
-	UWORD w_byte=(W_Image%8)?(W_Image/8)+1:W_Image/8;
-    UDOUBLE Addr = 0;
-	UDOUBLE pAddr = 0;
-    for (y = 0; y < H_Image; y++) {
-        for (x = 0; x < w_byte; x++) {//8 pixel =  1 byte
-            Addr = x + y * w_byte;
-			pAddr=x+(xStart/8)+((y+yStart)*Paint.WidthByte);
-            Paint.Image[pAddr] = (unsigned char)image_buffer[Addr];
+    PaintCtx_DrawImageMode(Ctx, image_buffer, xStart, yStart, W_Image, H_Image, IMAGE_COPY);
+}
+
+/******************************************************************************
+function: Draw a 1-bit image at any position
+parameter:
+    image_buffer : Rows of (W_Image + 7) / 8 bytes, bit 1 = white
+    xStart       : X starting coordinates
+    yStart       : Y starting coordinates
+    W_Image      : Image width
+    H_Image      : Image height
+    Mode         : IMAGE_COPY, or IMAGE_AND / IMAGE_OR to leave the white
+                   / black pixels of the image transparent
+info:
+    The image is placed like every other primitive: it follows rotation
+    and mirroring and is clipped to the clip window. At scale 2 with
+    ROTATE_0/180 and dense planes each image row is shifted onto the
+    byte grid of the plane and merged a byte at a time, aligned copies
+    are plain memcpy. Other images are drawn as runs of equal pixels.
+    Drawn pixels are black or white, nothing under them stays red.
+******************************************************************************/
+void PaintCtx_DrawImageMode(PaintContext *Ctx, const unsigned char *image_buffer, UWORD xStart, UWORD yStart,
+                            UWORD W_Image, UWORD H_Image, IMAGE_MODE Mode)
+{
+    const PAINT_RECT *Clip = &Ctx->Clip[Ctx->ClipDepth];
+    int Row_Len = (W_Image + 7) / 8;
+    int Xs = xStart > Clip->Xstart ? xStart : Clip->Xstart;
+    int Ys = yStart > Clip->Ystart ? yStart : Clip->Ystart;
+    int Xe = xStart + W_Image < Clip->Xend ? xStart + W_Image : Clip->Xend;
+    int Ye = yStart + H_Image < Clip->Yend ? yStart + H_Image : Clip->Yend;
+    if (Xs >= Xe || Ys >= Ye)
+        return;
+
+    if (Ctx->Scale != 2 || (Ctx->Rotate != ROTATE_0 && Ctx->Rotate != ROTATE_180) ||
+        Ctx->Sparse || Ctx->SparseRed) {
+        for (int Y = Ys; Y < Ye; Y++) {
+            const UBYTE *Row = image_buffer + (UDOUBLE)(Y - yStart) * Row_Len;
+            int X = Xs;
+            while (X < Xe) {
+                int Sx = X - xStart;
+                UBYTE Bit = (Row[Sx / 8] >> (7 - Sx % 8)) & 1;
+                int Run = X + 1;
+                for (Sx++; Run < Xe && ((Row[Sx / 8] >> (7 - Sx % 8)) & 1) == Bit; Sx++)
+                    Run++;
+                if (Mode == IMAGE_COPY || (Mode == IMAGE_OR) == Bit)
+                    PaintCtx_FillSpan(Ctx, X, Run, Y, Bit ? WHITE : BLACK);
+                X = Run;
+            }
+        }
+        return;
+    }
+
+    //Map the clipped window into memory space
+    UBYTE Flip_X = (Ctx->Rotate == ROTATE_180) ^ ((Ctx->Mirror & MIRROR_HORIZONTAL) ? 1 : 0);
+    UBYTE Flip_Y = (Ctx->Rotate == ROTATE_180) ^ ((Ctx->Mirror & MIRROR_VERTICAL) ? 1 : 0);
+    int X0 = Flip_X ? Ctx->WidthMemory - Xe : Xs;
+    int X1 = Flip_X ? Ctx->WidthMemory - 1 - Xs : Xe - 1;
+    int Byte0 = X0 / 8, Byte1 = X1 / 8;
+    UBYTE Mask0 = 0xFF >> (X0 % 8);
+    UBYTE Mask1 = 0xFF << (7 - X1 % 8);
+    //Bit offset in the image row of the first pixel of plane byte 0; a
+    //flipped row is read backwards from the pixel landing on its bit 7
+    int Origin = Flip_X ? Ctx->WidthMemory - 1 - xStart - 7 : -(int)xStart;
+    UBYTE Aligned = !Flip_X && xStart % 8 == 0 && Mode == IMAGE_COPY;
+
+    for (int Y = Ys; Y < Ye; Y++) {
+        const UBYTE *Row = image_buffer + (UDOUBLE)(Y - yStart) * Row_Len;
+        int My = Flip_Y ? Ctx->HeightMemory - 1 - Y : Y;
+        UDOUBLE Offset = (UDOUBLE)(My - Ctx->BandStart) * Ctx->WidthByte;
+        UBYTE *Dest = Ctx->Image ? Ctx->Image + Offset : NULL;
+        UBYTE *Red = (Ctx->TriColor && Ctx->ImageRed) ? Ctx->ImageRed + Offset : NULL;
+        for (int Byte = Byte0; Byte <= Byte1; Byte++) {
+            UBYTE Mask = 0xFF;
+            if (Byte == Byte0)
+                Mask &= Mask0;
+            if (Byte == Byte1)
+                Mask &= Mask1;
+            if (Aligned && Mask == 0xFF && Byte < Byte1) {
+                //Whole bytes of an aligned image are copied as they are
+                int Count = Byte1 - Byte;
+                if (Dest)
+                    memcpy(Dest + Byte, Row + Byte - xStart / 8, Count);
+                if (Red)
+                    memset(Red + Byte, 0xFF, Count);
+                Byte += Count - 1;
+                continue;
+            }
+            int Bit_Offset = Flip_X ? Origin - Byte * 8 : Origin + Byte * 8;
+            UBYTE Bits = Paint_FetchBits(Row, Row_Len, Bit_Offset);
+            if (Flip_X)
+                Bits = Paint_ReverseByte(Bits);
+            if (Dest)
+                Dest[Byte] = Paint_MergeBits(Dest[Byte], Bits, Mask, Mode);
+            //Every drawn pixel leaves the red plane
+            if (Red)
+                Red[Byte] |= Mask & (Mode == IMAGE_AND ? ~Bits : Mode == IMAGE_OR ? Bits : 0xFF);
         }
     }
 }
+
+/******************************************************************************
+function: Default context
+info:
+    The Paint_* functions draw into the global Paint context, as before.
+    Code that renders several images at once uses PaintCtx_* with its own
+    PaintContext instead.
+******************************************************************************/
+void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color)
+{
+    PaintCtx_NewImage(&Paint, image, Width, Height, Rotate, Color);
+}
+
+void Paint_SelectImage(UBYTE *image)
+{
+    PaintCtx_SelectImage(&Paint, image);
+}
+
+void Paint_SelectBand(UBYTE *image, UWORD Ystart, UWORD Yend)
+{
+    PaintCtx_SelectBand(&Paint, image, Ystart, Yend);
+}
+
+void Paint_NewSparseImage(PAINT_SPARSE *Sparse, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color)
+{
+    PaintCtx_NewSparseImage(&Paint, Sparse, Width, Height, Rotate, Color);
+}
+
+void Paint_ReadRows(UWORD Ystart, UWORD Rows, UBYTE *Buffer)
+{
+    PaintCtx_ReadRows(&Paint, Ystart, Rows, Buffer);
+}
+
+void Paint_SelectBandRed(UBYTE *image, UWORD Ystart, UWORD Yend)
+{
+    PaintCtx_SelectBandRed(&Paint, image, Ystart, Yend);
+}
+
+void Paint_SetRedImage(UBYTE *image, PAINT_SPARSE *Sparse)
+{
+    PaintCtx_SetRedImage(&Paint, image, Sparse);
+}
+
+void Paint_SetGlyphCache(PAINT_GLYPH_CACHE *Cache)
+{
+    PaintCtx_SetGlyphCache(&Paint, Cache);
+}
+
+void Paint_SetTextCache(PAINT_TEXT_CACHE *Cache)
+{
+    PaintCtx_SetTextCache(&Paint, Cache);
+}
+
+void Paint_ReadRedRows(UWORD Ystart, UWORD Rows, UBYTE *Buffer)
+{
+    PaintCtx_ReadRedRows(&Paint, Ystart, Rows, Buffer);
+}
+
+void Paint_SetRotate(UWORD Rotate)
+{
+    PaintCtx_SetRotate(&Paint, Rotate);
+}
+
+void Paint_SetMirroring(UBYTE mirror)
+{
+    PaintCtx_SetMirroring(&Paint, mirror);
+}
+
+void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    PaintCtx_SetPixel(&Paint, Xpoint, Ypoint, Color);
+}
+
+void Paint_SetScale(UBYTE scale)
+{
+    PaintCtx_SetScale(&Paint, scale);
+}
+
+void Paint_ResetClip(void)
+{
+    PaintCtx_ResetClip(&Paint);
+}
+
+void Paint_PushClip(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    PaintCtx_PushClip(&Paint, Xstart, Ystart, Xend, Yend);
+}
+
+void Paint_PopClip(void)
+{
+    PaintCtx_PopClip(&Paint);
+}
+
+void Paint_PushBand(UWORD Ystart, UWORD Yend)
+{
+    PaintCtx_PushBand(&Paint, Ystart, Yend);
+}
+
+void Paint_Clear(UWORD Color)
+{
+    PaintCtx_Clear(&Paint, Color);
+}
+
+void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+{
+    PaintCtx_ClearWindows(&Paint, Xstart, Ystart, Xend, Yend, Color);
+}
+
+void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_FillWay)
+{
+    PaintCtx_DrawPoint(&Paint, Xpoint, Ypoint, Color, Dot_Pixel, Dot_FillWay);
+}
+
+void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
+{
+    PaintCtx_DrawLine(&Paint, Xstart, Ystart, Xend, Yend, Color, Line_width, Line_Style);
+}
+
+void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    PaintCtx_DrawRectangle(&Paint, Xstart, Ystart, Xend, Yend, Color, Line_width, Draw_Fill);
+}
+
+void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    PaintCtx_DrawCircle(&Paint, X_Center, Y_Center, Radius, Color, Line_width, Draw_Fill);
+}
+
+void Paint_DrawStar(UWORD X_Center, UWORD Y_Center, UWORD Size, UWORD Color)
+{
+    PaintCtx_DrawStar(&Paint, X_Center, Y_Center, Size, Color);
+}
+
+void Paint_FillPolygon(const PAINT_POINT *Points, UWORD Count, UWORD Color, FILL_RULE Fill_Rule)
+{
+    PaintCtx_FillPolygon(&Paint, Points, Count, Color, Fill_Rule);
+}
+
+void Paint_DrawChar(UWORD Xstart, UWORD Ystart, const char Acsii_Char, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawChar(&Paint, Xstart, Ystart, Acsii_Char, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawString_EN(&Paint, Xstart, Ystart, pString, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawNum(&Paint, Xpoint, Ypoint, Nummber, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawDateTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawDateTime(&Paint, Xstart, Ystart, pTime, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawCharScaled(UWORD Xstart, UWORD Ystart, const char Acsii_Char, sFONT* Font, UBYTE Factor, UWORD Flags,
+                          UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawCharScaled(&Paint, Xstart, Ystart, Acsii_Char, Font, Factor, Flags, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawStringScaled(UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UBYTE Factor, UWORD Flags,
+                            UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawStringScaled(&Paint, Xstart, Ystart, pString, Font, Factor, Flags, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawLayout(UWORD Xstart, UWORD Ystart, const PAINT_LAYOUT *Layout, UBYTE Factor,
+                      UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawLayout(&Paint, Xstart, Ystart, Layout, Factor, Color_Foreground, Color_Background);
+}
+
+UWORD Paint_DrawTextBox(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, const char * pString, sFONT* Font,
+                        UWORD Flags, UWORD Color_Foreground, UWORD Color_Background)
+{
+    return PaintCtx_DrawTextBox(&Paint, Xstart, Ystart, Xend, Yend, pString, Font, Flags,
+                                Color_Foreground, Color_Background);
+}
+
+void Paint_DrawBitMap(const unsigned char* image_buffer)
+{
+    PaintCtx_DrawBitMap(&Paint, image_buffer);
+}
+
+void Paint_DrawImage(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image)
+{
+    PaintCtx_DrawImage(&Paint, image_buffer, xStart, yStart, W_Image, H_Image);
+}
+
+void Paint_DrawImageMode(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image,
+                         IMAGE_MODE Mode)
+{
+    PaintCtx_DrawImageMode(&Paint, image_buffer, xStart, yStart, W_Image, H_Image, Mode);
+}
@@ -81,7 +81,145 @@
 #include "fonts.h"
 
 /**
- * Image attributes
+ * Clip window, the end coordinates are not included
+**/
+typedef struct {
+    UWORD Xstart;
+    UWORD Ystart;
+    UWORD Xend;
+    UWORD Yend;
+} PAINT_RECT;
+#define PAINT_CLIP_DEPTH  8
+
+/**
+ * Run of ink (BLACK) pixels on one memory row of a sparse plane
+**/
+typedef struct {
+    UWORD Xstart;
+    UWORD Xend;     //Not included
+    UWORD Next;     //Next run of the row, PAINT_RUN_NONE after the last
+} PAINT_RUN;
+#define PAINT_RUN_NONE  0xFFFF
+
+/**
+ * Sparse 1-bit plane: every memory row keeps a sorted list of ink runs,
+ * all other pixels are white. The storage is supplied by the caller;
+ * when the run pool is full the plane is converted to a dense image
+ * allocated with malloc, left in Dense for the owner to free.
+**/
+typedef struct {
+    UWORD *RowHead;     //First run of every memory row
+    PAINT_RUN *Runs;
+    UWORD Capacity;
+    UWORD Count;        //Runs in use
+    UWORD Free;         //First unused run
+    UBYTE *Dense;
+} PAINT_SPARSE;
+
+/**
+ * Decoded glyph of a FONT_ENCODING_ROWS font: up to GLYPH_ROWS rows of up
+ * to 32 pixels, 4 bytes a row, leftmost pixel in the top bit.
+ * For ROTATE_90/270 a slot holds the glyph cell turned into columns
+ * instead, in the same layout.
+**/
+#define GLYPH_ROWS      32
+#define GLYPH_FORM_ROWS             0
+#define GLYPH_FORM_COLUMNS          1   //Column x of the cell, top pixel in the top bit
+#define GLYPH_FORM_COLUMNS_REVERSED 2   //Column x of the cell, bottom pixel in the top bit
+typedef struct {
+    const UBYTE *Source;    //Bitmap in the font table, NULL when free
+    UDOUBLE Used;           //Lookup clock at the last use
+    UBYTE Bits[GLYPH_ROWS * 4];
+    UBYTE Form;             //GLYPH_FORM_*
+} PAINT_GLYPH_SLOT;
+
+/**
+ * Glyphs decoded or rotated on first use and kept until they are the least
+ * recently used one. The slots are supplied by the caller; contexts that
+ * draw at the same time need caches of their own.
+**/
+typedef struct {
+    PAINT_GLYPH_SLOT *Slots;
+    UWORD Count;
+    UDOUBLE Clock;
+    UDOUBLE Hits;       //Lookups served from a slot
+    UDOUBLE Misses;     //Lookups that decoded the glyph
+} PAINT_GLYPH_CACHE;
+
+/**
+ * Rasterized text run: the ink of a string drawn on one line in one font,
+ * 1 bit per pixel, leftmost pixel in the top bit of a word, rows padded to
+ * whole words. The string follows the bitmap in the pool.
+**/
+typedef struct {
+    const sFONT *Font;  //NULL when free
+    UDOUBLE Hash;       //Of the string
+    UDOUBLE Used;       //Lookup clock at the last use
+    UDOUBLE Offset;     //First pool word of the run
+    UDOUBLE Size;       //Pool words of the run
+    UWORD Width;        //Pixels
+    UWORD Height;
+    UWORD Len;          //String bytes
+    UBYTE Factor;       //Scale factor, 0 for the font size
+    UWORD Flags;        //TEXT_* the run was drawn with
+} PAINT_TEXT_RUN;
+
+/**
+ * Text runs rasterized on their second use and blitted from then on, kept
+ * until they are the least recently used one and the pool needs their
+ * room. A run seen once is only remembered by its key, so text that keeps
+ * changing never costs more than drawing it glyph by glyph.
+ * The runs and the pool are supplied by the caller; contexts that draw at
+ * the same time need caches of their own.
+**/
+typedef struct {
+    PAINT_TEXT_RUN *Runs;
+    UWORD Count;
+    UDOUBLE *Seen;      //Keys of the last runs seen once, 0 when unused
+    UWORD SeenCount;
+    UWORD SeenNext;     //Slot the next run seen once goes to
+    UDOUBLE *Pool;
+    UDOUBLE PoolWords;
+    UDOUBLE PoolUsed;   //Words in use, the runs are kept packed from Pool
+    UDOUBLE Clock;
+    UDOUBLE Hits;       //Runs blitted from the pool
+    UDOUBLE Misses;     //Runs rasterized into the pool
+    UDOUBLE Evictions;  //Runs dropped to make room
+    UDOUBLE Bypassed;   //Runs too large for the pool, drawn glyph by glyph
+    UDOUBLE Declined;   //Runs seen for the first time, drawn glyph by glyph
+    UDOUBLE PeakBytes;  //Most of the pool ever in use
+} PAINT_TEXT_CACHE;
+
+/**
+ * Place of one character of a laid out string, in font pixels from the
+ * start of the string
+**/
+typedef struct {
+    UDOUBLE Code;       //Unicode code point
+    UWORD X;            //Left of its cell, after kerning
+    UWORD Width;        //Cell width, the advance or a tabular digit's cell
+} PAINT_GLYPH_POS;
+
+/**
+ * String laid out on one line once, to be measured and drawn from the
+ * same positions. The positions are supplied by the caller; the string
+ * is not copied and has to stay as it was until the layout is drawn.
+**/
+typedef struct {
+    PAINT_GLYPH_POS *Glyphs;
+    UWORD Capacity;
+    UWORD Count;        //Characters laid out
+    UWORD Width;        //End of the last cell
+    const char *Text;
+    UWORD Len;          //Bytes laid out, the whole string when it fitted
+    sFONT *Font;
+    UWORD Flags;        //TEXT_TABULAR, and the styles and TEXT_SMOOTH to draw it with
+} PAINT_LAYOUT;
+
+/**
+ * Image attributes, one context per image being drawn.
+ * The Paint_* functions draw into the default context Paint,
+ * PaintCtx_* take the context explicitly and are reentrant.
 **/
 typedef struct {
     UBYTE *Image;
@@ -95,8 +233,20 @@ typedef struct {
     UWORD WidthByte;
     UWORD HeightByte;
     UWORD Scale;
-} PAINT;
-extern PAINT Paint;
+    UWORD BandStart;    //First memory row held by Image
+    UWORD BandHeight;   //Number of memory rows held by Image
+    PAINT_SPARSE *Sparse;   //Set when the image is a sparse plane
+    UBYTE *ImageRed;        //Red plane of a tri-colour image, dense
+    PAINT_SPARSE *SparseRed;//or sparse
+    UBYTE TriColor;         //RED goes to the red plane instead of being black
+    PAINT_RECT Clip[PAINT_CLIP_DEPTH];
+    UBYTE ClipDepth;
+    UBYTE ClipOverflow;     //Pushes dropped on a full clip stack, popped first
+    PAINT_GLYPH_CACHE *GlyphCache;  //Optional, for FONT_ENCODING_ROWS fonts
+    PAINT_TEXT_CACHE *TextCache;    //Optional, for strings drawn again
+} PaintContext;
+typedef PaintContext PAINT;
+extern PaintContext Paint;
 
 /**
  * Display rotate
@@ -122,7 +272,7 @@ typedef enum {
 **/
 #define WHITE          0xFF
 #define BLACK          0x00
-#define RED            BLACK
+#define RED            0x0F    //Drawn as BLACK unless the image is tri-colour
 
 #define IMAGE_BACKGROUND    WHITE
 #define FONT_FOREGROUND     BLACK
@@ -133,6 +283,11 @@ typedef enum {
 #define  GRAY2 0x02
 #define  GRAY3 0x01 //gray
 #define  GRAY4 0x00 //white
+
+//2-bit codes of a packed tri-colour image (scale 4 with a red plane set)
+#define  PACKED_WHITE 0x03
+#define  PACKED_BLACK 0x00
+#define  PACKED_RED   0x01
 /**
  * The size of the point
 **/
@@ -173,6 +328,46 @@ typedef enum {
     DRAW_FILL_FULL,
 } DRAW_FILL;
 
+/**
+ * Polygon vertex and fill rule
+**/
+typedef struct {
+    int16_t X;
+    int16_t Y;
+} PAINT_POINT;
+
+typedef enum {
+    FILL_RULE_EVEN_ODD = 0,
+    FILL_RULE_NON_ZERO,
+} FILL_RULE;
+#define POLYGON_MAX_EDGES  32
+
+/**
+ * How a 1-bit image is combined with the pixels under it
+**/
+typedef enum {
+    IMAGE_COPY = 0,     //Every pixel of the image is drawn
+    IMAGE_AND,          //Only the black pixels are drawn, white ones are transparent
+    IMAGE_OR,           //Only the white pixels are drawn, black ones are transparent
+} IMAGE_MODE;
+
+/**
+ * Text layout: one alignment, optionally combined with the options, and
+ * the styles, which are drawn from the regular glyphs of the font
+**/
+#define  TEXT_LEFT      0x00
+#define  TEXT_CENTER    0x01
+#define  TEXT_RIGHT     0x02
+#define  TEXT_WRAP      0x04  //Break lines at spaces, long words where they overflow
+#define  TEXT_ELLIPSIS  0x08  //End a line that is cut off, or the last line shown, with "..."
+#define  TEXT_SMOOTH    0x10  //Scaled text: fill in the steps of diagonal edges
+#define  TEXT_BOLD      0x20  //Every stroke one pixel wider to the right
+#define  TEXT_OUTLINE   0x40  //Only the pixels around the strokes
+#define  TEXT_INVERSE   0x80  //Foreground and background swapped, the cell filled
+#define  TEXT_UNDERLINE 0x100 //A line under the baseline, across the whole cell
+#define  TEXT_STYLE     (TEXT_BOLD | TEXT_OUTLINE | TEXT_INVERSE | TEXT_UNDERLINE)
+#define  TEXT_TABULAR   0x200 //Every digit as wide as the widest, for readouts that change
+
 /**
  * Custom structure of a time attribute
 **/
@@ -189,11 +384,25 @@ extern PAINT_TIME sPaint_time;
 //init and Clear
 void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color);
 void Paint_SelectImage(UBYTE *image);
+void Paint_SelectBand(UBYTE *image, UWORD Ystart, UWORD Yend);
+void Paint_SelectBandRed(UBYTE *image, UWORD Ystart, UWORD Yend);
+void Paint_NewSparseImage(PAINT_SPARSE *Sparse, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color);
+void Paint_ReadRows(UWORD Ystart, UWORD Rows, UBYTE *Buffer);
+void Paint_SetRedImage(UBYTE *image, PAINT_SPARSE *Sparse);
+void Paint_SetGlyphCache(PAINT_GLYPH_CACHE *Cache);
+void Paint_SetTextCache(PAINT_TEXT_CACHE *Cache);
+void Paint_ReadRedRows(UWORD Ystart, UWORD Rows, UBYTE *Buffer);
 void Paint_SetRotate(UWORD Rotate);
 void Paint_SetMirroring(UBYTE mirror);
 void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color);
 void Paint_SetScale(UBYTE scale);
 
+//Clipping
+void Paint_ResetClip(void);
+void Paint_PushClip(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void Paint_PopClip(void);
+void Paint_PushBand(UWORD Ystart, UWORD Yend);
+
 void Paint_Clear(UWORD Color);
 void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
 
@@ -203,16 +412,87 @@ void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Co
 void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
 void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
 void Paint_DrawStar(UWORD X_Center, UWORD Y_Center, UWORD Size, UWORD Color);
+void Paint_FillPolygon(const PAINT_POINT *Points, UWORD Count, UWORD Color, FILL_RULE Fill_Rule);
 
 //Display string
 void Paint_DrawChar(UWORD Xstart, UWORD Ystart, const char Acsii_Char, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawDateTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawCharScaled(UWORD Xstart, UWORD Ystart, const char Acsii_Char, sFONT* Font, UBYTE Factor, UWORD Flags,
+                          UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawStringScaled(UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UBYTE Factor, UWORD Flags,
+                            UWORD Color_Foreground, UWORD Color_Background);
+UWORD Paint_MeasureString(const char * pString, sFONT* Font);
+UWORD Paint_MeasureTextBox(const char * pString, sFONT* Font, UWORD Width, UWORD Flags);
+void Paint_DrawLayout(UWORD Xstart, UWORD Ystart, const PAINT_LAYOUT *Layout, UBYTE Factor,
+                      UWORD Color_Foreground, UWORD Color_Background);
+UWORD Paint_DrawTextBox(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, const char * pString, sFONT* Font,
+                        UWORD Flags, UWORD Color_Foreground, UWORD Color_Background);
 
 //pic
 void Paint_DrawBitMap(const unsigned char* image_buffer);
-void Paint_DrawImage(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image); 
+void Paint_DrawImage(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image);
+void Paint_DrawImageMode(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image, IMAGE_MODE Mode);
+
+//Explicit context versions of all of the above
+//init and Clear
+void PaintCtx_NewImage(PaintContext *Ctx, UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color);
+void PaintCtx_SelectImage(PaintContext *Ctx, UBYTE *image);
+void PaintCtx_SelectBand(PaintContext *Ctx, UBYTE *image, UWORD Ystart, UWORD Yend);
+void PaintCtx_SelectBandRed(PaintContext *Ctx, UBYTE *image, UWORD Ystart, UWORD Yend);
+void PaintSparse_Init(PAINT_SPARSE *Sparse, UWORD *RowHead, PAINT_RUN *Runs, UWORD Capacity);
+void PaintCtx_NewSparseImage(PaintContext *Ctx, PAINT_SPARSE *Sparse, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color);
+void PaintCtx_ReadRows(PaintContext *Ctx, UWORD Ystart, UWORD Rows, UBYTE *Buffer);
+void PaintCtx_SetRedImage(PaintContext *Ctx, UBYTE *image, PAINT_SPARSE *Sparse);
+void PaintGlyphCache_Init(PAINT_GLYPH_CACHE *Cache, PAINT_GLYPH_SLOT *Slots, UWORD Count);
+void PaintCtx_SetGlyphCache(PaintContext *Ctx, PAINT_GLYPH_CACHE *Cache);
+void PaintTextCache_Init(PAINT_TEXT_CACHE *Cache, PAINT_TEXT_RUN *Runs, UWORD Count, UDOUBLE *Pool, UDOUBLE Pool_Bytes);
+void PaintCtx_SetTextCache(PaintContext *Ctx, PAINT_TEXT_CACHE *Cache);
+void PaintCtx_ReadRedRows(PaintContext *Ctx, UWORD Ystart, UWORD Rows, UBYTE *Buffer);
+void PaintCtx_SetRotate(PaintContext *Ctx, UWORD Rotate);
+void PaintCtx_SetMirroring(PaintContext *Ctx, UBYTE mirror);
+void PaintCtx_SetPixel(PaintContext *Ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color);
+void PaintCtx_SetScale(PaintContext *Ctx, UBYTE scale);
+
+//Clipping
+void PaintCtx_ResetClip(PaintContext *Ctx);
+void PaintCtx_PushClip(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void PaintCtx_PopClip(PaintContext *Ctx);
+void PaintCtx_PushBand(PaintContext *Ctx, UWORD Ystart, UWORD Yend);
+
+void PaintCtx_Clear(PaintContext *Ctx, UWORD Color);
+void PaintCtx_ClearWindows(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
+
+//Drawing
+void PaintCtx_DrawPoint(PaintContext *Ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_FillWay);
+void PaintCtx_DrawLine(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style);
+void PaintCtx_DrawRectangle(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void PaintCtx_DrawCircle(PaintContext *Ctx, UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void PaintCtx_DrawStar(PaintContext *Ctx, UWORD X_Center, UWORD Y_Center, UWORD Size, UWORD Color);
+void PaintCtx_FillPolygon(PaintContext *Ctx, const PAINT_POINT *Points, UWORD Count, UWORD Color, FILL_RULE Fill_Rule);
+
+//Display string
+void PaintCtx_DrawChar(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, const char Acsii_Char, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void PaintCtx_DrawString_EN(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void PaintCtx_DrawNum(PaintContext *Ctx, UWORD Xpoint, UWORD Ypoint, int32_t Nummber, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void PaintCtx_DrawDateTime(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void PaintCtx_DrawCharScaled(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, const char Acsii_Char, sFONT* Font,
+                             UBYTE Factor, UWORD Flags, UWORD Color_Foreground, UWORD Color_Background);
+void PaintCtx_DrawStringScaled(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font,
+                               UBYTE Factor, UWORD Flags, UWORD Color_Foreground, UWORD Color_Background);
+UWORD PaintCtx_DrawTextBox(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, const char * pString,
+                           sFONT* Font, UWORD Flags, UWORD Color_Foreground, UWORD Color_Background);
+void PaintLayout_Init(PAINT_LAYOUT *Layout, PAINT_GLYPH_POS *Glyphs, UWORD Capacity);
+UWORD PaintLayout_String(PAINT_LAYOUT *Layout, const char * pString, sFONT* Font, UWORD Flags);
+void PaintCtx_DrawLayout(PaintContext *Ctx, UWORD Xstart, UWORD Ystart, const PAINT_LAYOUT *Layout, UBYTE Factor,
+                         UWORD Color_Foreground, UWORD Color_Background);
+
+//pic
+void PaintCtx_DrawBitMap(PaintContext *Ctx, const unsigned char* image_buffer);
+void PaintCtx_DrawImage(PaintContext *Ctx, const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image);
+void PaintCtx_DrawImageMode(PaintContext *Ctx, const unsigned char *image_buffer, UWORD xStart, UWORD yStart,
+                            UWORD W_Image, UWORD H_Image, IMAGE_MODE Mode);
 
 #endif
 
@@ -30,7 +30,10 @@
 #ifndef _DEV_CONFIG_H_
 #define _DEV_CONFIG_H_
 
+//Host builds (platform native) only use the data types
+#if defined(ARDUINO)
 #include <Arduino.h>
+#endif
 #include <stdint.h>
 #include <stdio.h>
 
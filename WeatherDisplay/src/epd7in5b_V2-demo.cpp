@@ -4,22 +4,64 @@
 #include "DEV_Config.h"
 #include "EPD.h"
 #include "GUI_Paint.h"
+#include "GUI_Frame.h"
+#include "GUI_Format.h"
 #include <stdlib.h>
+#include <string.h>
 #include "config.h"
 
+// Rows per strip when the layout is streamed to the panel without frame
+// buffers (about 3 KB instead of 96 KB at 32 rows, every update is a full
+// refresh); 0 keeps two full planes and refreshes partially
+#define BAND_ROWS 0
+
+// 1 keeps both colours in one 2-bit image (96 KB) that is split into the
+// two planes while it is sent, every update is then a full refresh
+#define PACKED_IMAGE 0
+
 // Private method declarations
 void syncTimeWithNTP();
 void initializeDisplay();
 void createImageBuffers();
 void weatherDisplayDemo();
+void showLayout(bool initial);
+void sendWindow(const PAINT_RECT *rect);
 
-void drawCurrentConditions(int margin, const char* temp, const char* humidity, const char* pressure);
-void drawLocalHeader(int margin);
-void drawBorders(int margin);
+void drawCurrentConditions(PAINT_FRAME *frame, int margin, const char* temp, const char* humidity, const char* pressure);
+void drawLocalHeader(PAINT_FRAME *frame, int margin);
+void drawBorders(PAINT_FRAME *frame, int margin);
 void cleanupDisplay();
 
-UBYTE *BlackImage = NULL, *RYImage = NULL;
-UWORD Imagesize = 0;
+UBYTE *BlackImage = NULL;
+UDOUBLE Imagesize = 0;
+
+// The default Paint context draws both planes in one pass. The red plane
+// is nearly empty, so it only keeps its runs of red pixels (about 4 KB
+// instead of 48 KB) until it is too busy and turns dense
+UWORD RedRowHead[EPD_7IN5B_V2_HEIGHT];
+PAINT_RUN RedRuns[512];
+PAINT_SPARSE RedPlane;
+#if BAND_ROWS
+UBYTE *StripImage = NULL;
+#endif
+
+// The large readout font is compressed; its digits are decoded once and
+// then drawn from these slots (about 1.6 KB)
+PAINT_GLYPH_SLOT GlyphSlots[12];
+PAINT_GLYPH_CACHE GlyphCache;
+
+// Whole labels and readouts are kept rasterized here so a redraw copies
+// them row by row instead of walking their glyphs again (6 KB)
+PAINT_TEXT_RUN TextRuns[32];
+UDOUBLE TextPool[1536];
+PAINT_TEXT_CACHE TextCache;
+
+// Layout, recorded once and rendered on both cores (the sparse red plane
+// on this one), then kept as a display list so value changes only redraw
+// the area they touch
+PAINT_OP LayoutOps[48];
+PAINT_FRAME Layout;
+UWORD TempOp, HumidityOp, PressureOp;
 
 const char* ntpServer = "pool.ntp.org";
 const int daylightOffset_sec = 3600; // For daylight saving
@@ -63,10 +105,10 @@ void syncTimeWithNTP()
 void weatherDisplayDemo()
 {
   const int margin = 20;
-  Paint_SelectImage(BlackImage);
-  drawBorders(margin);
-  drawLocalHeader(margin);
-  EPD_7IN5B_V2_Display_Partial(BlackImage, 0, 0, EPD_7IN5B_V2_WIDTH, EPD_7IN5B_V2_HEIGHT);
+  PaintFrame_Init(&Layout, LayoutOps, sizeof(LayoutOps) / sizeof(LayoutOps[0]));
+  drawBorders(&Layout, margin);
+  drawLocalHeader(&Layout, margin);
+  showLayout(true);
   DEV_Delay_ms(5000);
 
   int temp = 55;
@@ -74,35 +116,30 @@ void weatherDisplayDemo()
   int pressure = 5;
   for (int i = 0; i < 5; i++)//this is the cadence of updates
   {
+    PAINT_FORMAT fmt;
     char temp_str[10];
-    sprintf(temp_str, "%d F", temp + i);
+    PaintFormat_Init(&fmt, temp_str, sizeof(temp_str));
+    PaintFormat_Value(&fmt, temp + i, 0, 0, UNIT_FAHRENHEIT);
 
     char humidity_str[20];
-    sprintf(humidity_str, "Humidity: %d%%", humidity + i);
+    PaintFormat_Init(&fmt, humidity_str, sizeof(humidity_str));
+    PaintFormat_Str(&fmt, "Humidity: ");
+    PaintFormat_Value(&fmt, humidity + i, 0, 0, UNIT_PERCENT);
 
     char pressure_str[20];
-    sprintf(pressure_str, "Pressure: %d mb", pressure + i);
-    
-    // Define the specific area for the temperature string to be updated
-    UWORD x_start = 10 + margin;
-    UWORD y_start = 70 + margin;
-    UWORD x_end = x_start + (Font32.Width * 4); // Approx. width for "XX F"
-    UWORD y_end = y_start + Font32.Height;
-    
-    // Clear just the temperature area and redraw the new value
-    Paint_ClearWindows(x_start, y_start, x_end, y_end, WHITE);
-    Paint_DrawString_EN(x_start, y_start, temp_str, &Font32, BLACK, WHITE);
-    
-    // humidity
-    Paint_ClearWindows(10 + margin, 110 + margin, 10 + margin + (Font12.Width * 15), 110 + margin + Font12.Height, WHITE);
-    Paint_DrawString_EN(10 + margin, 110 + margin, humidity_str, &Font12, BLACK, WHITE);
-
-    // pressure
-    Paint_ClearWindows(10 + margin, 130 + margin, 10 + margin + (Font12.Width * 15), 130 + margin + Font12.Height, WHITE);
-    Paint_DrawString_EN(10 + margin, 130 + margin, pressure_str, &Font12, BLACK, WHITE);
+    PaintFormat_Init(&fmt, pressure_str, sizeof(pressure_str));
+    PaintFormat_Str(&fmt, "Pressure: ");
+    PaintFormat_Value(&fmt, pressure + i, 0, 0, UNIT_MBAR);
+
+    // Only the values that changed, and whatever overlaps them, are redrawn
+    PaintFrame_SetString(&Layout, TempOp, temp_str);
+    PaintFrame_SetString(&Layout, HumidityOp, humidity_str);
+    PaintFrame_SetString(&Layout, PressureOp, pressure_str);
 
     printf("Updating to temp: %s, humidity: %s, pressure: %s\r\n", temp_str, humidity_str, pressure_str);
-    EPD_7IN5B_V2_Display_Partial(BlackImage, 0, 0, EPD_7IN5B_V2_WIDTH, EPD_7IN5B_V2_HEIGHT);
+    showLayout(false);
+    printf("Text runs: %lu hits, %lu misses, %lu of %lu bytes\r\n", (unsigned long)TextCache.Hits,
+           (unsigned long)TextCache.Misses, (unsigned long)TextCache.PoolUsed * 4, (unsigned long)TextCache.PoolWords * 4);
 
     DEV_Delay_ms(5000);
   }
@@ -111,32 +148,116 @@ void weatherDisplayDemo()
   DEV_Delay_ms(2000);
 }
 
-void drawLocalHeader(int margin)
+#if PACKED_IMAGE
+// Send both planes of the packed image a row at a time
+void sendImage()
+{
+  UBYTE row[EPD_7IN5B_V2_WIDTH / 8];
+  EPD_7IN5B_V2_Display_Begin(EPD_7IN5B_V2_PLANE_BLACK);
+  for (UWORD y = 0; y < EPD_7IN5B_V2_HEIGHT; y++) {
+    Paint_ReadRows(y, 1, row);
+    EPD_7IN5B_V2_Display_Rows(row, 1, EPD_7IN5B_V2_PLANE_BLACK);
+  }
+  EPD_7IN5B_V2_Display_Begin(EPD_7IN5B_V2_PLANE_RED);
+  for (UWORD y = 0; y < EPD_7IN5B_V2_HEIGHT; y++) {
+    Paint_ReadRedRows(y, 1, row);
+    EPD_7IN5B_V2_Display_Rows(row, 1, EPD_7IN5B_V2_PLANE_RED);
+  }
+  EPD_7IN5B_V2_Display_End();
+}
+#endif
+
+#if !BAND_ROWS && !PACKED_IMAGE
+// Send the part of the black plane that was redrawn, widened to whole
+// bytes, as a partial refresh
+void sendWindow(const PAINT_RECT *rect)
+{
+  UWORD xstart = rect->Xstart / 8 * 8;
+  UWORD xend = (rect->Xend + 7) / 8 * 8;
+  UWORD bytes = (xend - xstart) / 8, rows = rect->Yend - rect->Ystart;
+  UBYTE *window = NULL;
+  if (bytes < Paint.WidthByte && (window = (UBYTE *)malloc((UDOUBLE)bytes * rows)) == NULL)
+    printf("Failed to apply for window memory, sending whole rows...\r\n");
+  // Whole rows are already laid out as the panel takes them
+  if (window == NULL) {
+    EPD_7IN5B_V2_Display_Partial(BlackImage + (UDOUBLE)rect->Ystart * Paint.WidthByte, 0, rect->Ystart,
+                                 EPD_7IN5B_V2_WIDTH, rect->Yend);
+    return;
+  }
+  for (UWORD y = 0; y < rows; y++)
+    memcpy(window + (UDOUBLE)y * bytes, BlackImage + (UDOUBLE)(rect->Ystart + y) * Paint.WidthByte + xstart / 8, bytes);
+  EPD_7IN5B_V2_Display_Partial(window, xstart, rect->Ystart, xend, rect->Yend);
+  free(window);
+}
+#endif
+
+#if BAND_ROWS
+void sendStrip(const UBYTE *strip, UWORD ystart, UWORD yend, void *plane)
+{
+  EPD_7IN5B_V2_Display_Rows(strip, yend - ystart, *(UBYTE *)plane);
+}
+#endif
+
+// Put the layout on the panel, either strip by strip or through the
+// full planes, where only the changed values are redrawn after the first time
+void showLayout(bool initial)
 {
-  Paint_DrawString_EN(10 + margin, 10 + margin, "Local Weather", &Font16, BLACK, WHITE);
+#if BAND_ROWS
+  UBYTE plane = EPD_7IN5B_V2_PLANE_BLACK;
+  EPD_7IN5B_V2_Display_Begin(plane);
+  PaintFrame_RenderStrips(&Layout, &Paint, StripImage, BAND_ROWS, 0, sendStrip, &plane);
+  plane = EPD_7IN5B_V2_PLANE_RED;
+  EPD_7IN5B_V2_Display_Begin(plane);
+  PaintFrame_RenderStrips(&Layout, &Paint, StripImage, BAND_ROWS, 1, sendStrip, &plane);
+  EPD_7IN5B_V2_Display_End();
+#else
+  PAINT_RECT redrawn = {0, 0, EPD_7IN5B_V2_WIDTH, EPD_7IN5B_V2_HEIGHT};
+  if (initial)
+    PaintFrame_RenderParallel(&Layout, &Paint);
+  else if (!PaintFrame_Redraw(&Layout, &Paint, &redrawn))
+    return;
+#if PACKED_IMAGE
+  sendImage();
+#else
+  sendWindow(&redrawn);
+#endif
+#endif
+}
+
+void drawLocalHeader(PAINT_FRAME *frame, int margin)
+{
+  PaintFrame_DrawString_EN(frame, 10 + margin, 10 + margin, "Local Weather", &Font16P, BLACK, WHITE);
 
   // --- Add Date and Time ---
-  PAINT_TIME sPaint_time;
-  sPaint_time.Year = initialTimeInfo.tm_year + 1900; // Year is offset from 1900
-  sPaint_time.Month = initialTimeInfo.tm_mon + 1;    // Month is 0-11
-  sPaint_time.Day = initialTimeInfo.tm_mday;
-  sPaint_time.Hour = initialTimeInfo.tm_hour;
-  sPaint_time.Min = initialTimeInfo.tm_min;
-  sPaint_time.Sec = initialTimeInfo.tm_sec;
-  Paint_DrawDateTime(10 + margin, 30 + margin, &sPaint_time, &Font12, BLACK, WHITE);
+  // The text of Paint_DrawDateTime, recorded as a string
+  char date_time[24];
+  PAINT_FORMAT fmt;
+  PaintFormat_Init(&fmt, date_time, sizeof(date_time));
+  PaintFormat_Digits(&fmt, initialTimeInfo.tm_mon + 1, 2); // Month is 0-11
+  PaintFormat_Char(&fmt, '/');
+  PaintFormat_Digits(&fmt, initialTimeInfo.tm_mday, 2);
+  PaintFormat_Char(&fmt, '/');
+  PaintFormat_Int(&fmt, initialTimeInfo.tm_year + 1900);   // Year is offset from 1900
+  PaintFormat_Char(&fmt, ' ');
+  PaintFormat_Digits(&fmt, initialTimeInfo.tm_hour, 2);
+  PaintFormat_Char(&fmt, ':');
+  PaintFormat_Digits(&fmt, initialTimeInfo.tm_min, 2);
+  PaintFormat_Char(&fmt, ':');
+  PaintFormat_Digits(&fmt, initialTimeInfo.tm_sec, 2);
+  PaintFrame_DrawString_EN(frame, 10 + margin, 30 + margin, date_time, &Font12, BLACK, WHITE);
 
   // Draw static parts of current conditions once
-  drawCurrentConditions(margin, " ", " ", " ");
+  drawCurrentConditions(frame, margin, " ", " ", " ");
 }
 
-void drawBorders(int margin)
+void drawBorders(PAINT_FRAME *frame, int margin)
 {
   const int split_point = EPD_7IN5B_V2_WIDTH / 4;
 
-  Paint_DrawRectangle(margin, margin, split_point, EPD_7IN5B_V2_HEIGHT - margin,
-                      BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
-  Paint_DrawRectangle(split_point + margin, margin, EPD_7IN5B_V2_WIDTH - margin, EPD_7IN5B_V2_HEIGHT - margin,
-                      BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+  PaintFrame_DrawRectangle(frame, margin, margin, split_point, EPD_7IN5B_V2_HEIGHT - margin,
+                           BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+  PaintFrame_DrawRectangle(frame, split_point + margin, margin, EPD_7IN5B_V2_WIDTH - margin, EPD_7IN5B_V2_HEIGHT - margin,
+                           BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
   // --- Draw 5 rectangles for daily forecast ---
   int forecast_area_x_start = split_point + margin;
   int forecast_area_width = (EPD_7IN5B_V2_WIDTH - margin) - forecast_area_x_start;
@@ -144,6 +265,7 @@ void drawBorders(int margin)
 
   const char* days_of_week[] = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
   int today_wday = initialTimeInfo.tm_wday; // 0=Sun, 1=Mon, ...
+  const char* forecasts[] = {"Sunny", "Partly cloudy", "Chance of rain showers", "Thunderstorms likely in the afternoon", "Clear and cold"};
 
   for (int i = 0; i < 5; i++)
   {
@@ -151,15 +273,19 @@ void drawBorders(int margin)
     int y1 = margin;
     int x2 = x1 + daily_forecast_width;
     int y2 = EPD_7IN5B_V2_HEIGHT - margin;
-    Paint_DrawRectangle(x1, y1, x2, y2, BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+    PaintFrame_DrawRectangle(frame, x1, y1, x2, y2, BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
 
     // --- Draw Day of the Week ---
     int day_index = (today_wday + i) % 7;
     const char* day = days_of_week[day_index];
-    int string_width = strlen(day) * Font16.Width;
-    int x_text = x1 + (daily_forecast_width - string_width) / 2;
     int y_text = margin + 5; // 5 pixels padding from the top
-    Paint_DrawString_EN(x_text, y_text, day, &Font16, BLACK, WHITE);
+    UWORD emphasis = (i == 0) ? TEXT_BOLD | TEXT_UNDERLINE : 0; // today
+    PaintFrame_DrawTextBox(frame, x1, y_text, x2, y_text + Font16.Height, day, &Font16, TEXT_CENTER | emphasis, BLACK, WHITE);
+
+    // --- Forecast description, wrapped to the column ---
+    int y_desc = y_text + Font16.Height + 8;
+    PaintFrame_DrawTextBox(frame, x1 + 6, y_desc, x2 - 6, y_desc + 3 * Font12.Height, forecasts[i], &Font12,
+                           TEXT_CENTER | TEXT_WRAP | TEXT_ELLIPSIS, BLACK, WHITE);
   }
 }
 
@@ -167,36 +293,66 @@ void initializeDisplay()
 {
   printf("e-Paper Init and Clear...\r\n");
 
+#if BAND_ROWS || PACKED_IMAGE
+  EPD_7IN5B_V2_Init();
+  EPD_7IN5B_V2_Clear();
+#else
   EPD_7IN5B_V2_Init_Part();
   EPD_7IN5B_V2_Clear();
   EPD_7IN5B_V2_Display_Base_color(WHITE);
+#endif
 
   DEV_Delay_ms(1000);
 }
 
 void createImageBuffers()
 {
-  Imagesize = ((EPD_7IN5B_V2_WIDTH % 8 == 0) ? (EPD_7IN5B_V2_WIDTH / 8) : (EPD_7IN5B_V2_WIDTH / 8 + 1)) * EPD_7IN5B_V2_HEIGHT;
-  if ((BlackImage = (UBYTE *)malloc(Imagesize)) == NULL)
+  PaintGlyphCache_Init(&GlyphCache, GlyphSlots, sizeof(GlyphSlots) / sizeof(GlyphSlots[0]));
+  PaintTextCache_Init(&TextCache, TextRuns, sizeof(TextRuns) / sizeof(TextRuns[0]), TextPool, sizeof(TextPool));
+#if BAND_ROWS
+  // Only one strip is kept, the context just describes the whole image
+  Imagesize = ((EPD_7IN5B_V2_WIDTH % 8 == 0) ? (EPD_7IN5B_V2_WIDTH / 8) : (EPD_7IN5B_V2_WIDTH / 8 + 1)) * BAND_ROWS;
+  if ((StripImage = (UBYTE *)malloc(Imagesize)) == NULL)
   {
-    printf("Failed to apply for black memory...\r\n");
+    printf("Failed to apply for strip memory...\r\n");
     while (1)
       ;
   }
-  if ((RYImage = (UBYTE *)malloc(Imagesize)) == NULL)
+  printf("NewImage:StripImage\r\n");
+  Paint_NewImage(NULL, EPD_7IN5B_V2_WIDTH, EPD_7IN5B_V2_HEIGHT, 0, WHITE);
+  Paint_SetRedImage(NULL, NULL);
+  Paint_SetGlyphCache(&GlyphCache);
+  Paint_SetTextCache(&TextCache);
+  return;
+#endif
+  Imagesize = ((EPD_7IN5B_V2_WIDTH % 8 == 0) ? (EPD_7IN5B_V2_WIDTH / 8) : (EPD_7IN5B_V2_WIDTH / 8 + 1)) * EPD_7IN5B_V2_HEIGHT;
+#if PACKED_IMAGE
+  Imagesize *= 2;
+#endif
+  if ((BlackImage = (UBYTE *)malloc(Imagesize)) == NULL)
   {
-    printf("Failed to apply for red memory...\r\n");
+    printf("Failed to apply for black memory...\r\n");
     while (1)
       ;
   }
 
-  printf("NewImage:BlackImage and RYImage\r\n");
+#if PACKED_IMAGE
+  printf("NewImage:packed BlackImage\r\n");
   Paint_NewImage(BlackImage, EPD_7IN5B_V2_WIDTH, EPD_7IN5B_V2_HEIGHT, 0, WHITE);
-  Paint_NewImage(RYImage, EPD_7IN5B_V2_WIDTH, EPD_7IN5B_V2_HEIGHT, 0, WHITE);
-
-  Paint_SelectImage(BlackImage);
+  Paint_SetScale(4);
+  Paint_SetRedImage(NULL, NULL);
+  Paint_SetGlyphCache(&GlyphCache);
+  Paint_SetTextCache(&TextCache);
   Paint_Clear(WHITE);
-  Paint_SelectImage(RYImage);
+  return;
+#endif
+  printf("NewImage:BlackImage and sparse RedPlane\r\n");
+  Paint_NewImage(BlackImage, EPD_7IN5B_V2_WIDTH, EPD_7IN5B_V2_HEIGHT, 0, WHITE);
+  PaintSparse_Init(&RedPlane, RedRowHead, RedRuns, sizeof(RedRuns) / sizeof(RedRuns[0]));
+  Paint_SetRedImage(NULL, &RedPlane);
+  Paint_SetGlyphCache(&GlyphCache);
+  Paint_SetTextCache(&TextCache);
+
   Paint_Clear(WHITE);
 }
 
@@ -209,16 +365,23 @@ void cleanupDisplay()
   printf("Goto Sleep...\r\n");
   EPD_7IN5B_V2_Sleep();
   free(BlackImage);
-  free(RYImage);
+  free(RedPlane.Dense);
   BlackImage = NULL;
-  RYImage = NULL;
+  RedPlane.Dense = NULL;
+#if BAND_ROWS
+  free(StripImage);
+  StripImage = NULL;
+#endif
 }
 
-void drawCurrentConditions(int margin, const char* temp, const char* humidity, const char* pressure)
+void drawCurrentConditions(PAINT_FRAME *frame, int margin, const char* temp, const char* humidity, const char* pressure)
 {
-  Paint_DrawString_EN(10 + margin, 70 + margin, temp, &Font32, BLACK, WHITE);
-  Paint_DrawString_EN(10 + margin, 110 + margin, humidity, &Font12, BLACK, WHITE);
-  Paint_DrawString_EN(10 + margin, 130 + margin, pressure, &Font12, BLACK, WHITE);
+  // Temperature at twice the size of Font32N, digits in cells of one width so
+  // that a new reading only redraws the digits that changed
+  TempOp = PaintFrame_DrawStringScaled(frame, 10 + margin, 60 + margin, temp, &Font32N, 2, TEXT_SMOOTH | TEXT_TABULAR,
+                                       BLACK, WHITE);
+  HumidityOp = PaintFrame_DrawString_EN(frame, 10 + margin, 135 + margin, humidity, &Font12, BLACK, WHITE);
+  PressureOp = PaintFrame_DrawString_EN(frame, 10 + margin, 155 + margin, pressure, &Font12, BLACK, WHITE);
 }
 
 /* The main loop -------------------------------------------------------------*/
@@ -0,0 +1,174 @@
+/******************************************************************************
+* | File      	:   test_clip.cpp
+* | Function    :   Host test of clip windows and bands
+* | Info        :
+*   A scene of thick and dotted lines, polygons, circles and text that
+*   runs across the edges is drawn once over the whole image. Drawn again
+*   inside a clip window it must leave exactly the pixels of the first
+*   drawing that are inside the window, and drawn into strip buffers it
+*   must give the rows of the first drawing, in every rotation.
+*
+*   pio test -e native -f test_clip
+******************************************************************************/
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include "GUI_Paint.h"
+
+#define W 100
+#define H 72
+#define WB ((W + 7) / 8)
+
+static UBYTE Full[WB * H], Image[WB * H];
+
+static void Scene(PaintContext *Ctx)
+{
+    static const PAINT_POINT Star[] = {{50, 2}, {62, 38}, {30, 16}, {70, 16}, {38, 38}};
+    static const PAINT_POINT Hook[] = {{3, 40}, {40, 70}, {20, 50}, {45, 44}, {9, 66}};
+    for (UWORD w = 1; w <= 4; w++) {
+        LINE_STYLE Style = w % 2 ? LINE_STYLE_SOLID : LINE_STYLE_DOTTED;
+        DOT_PIXEL Width = (DOT_PIXEL)w;
+        PaintCtx_DrawLine(Ctx, 2 * w, 1, W - 3 * w, H - 2, BLACK, Width, Style);
+        PaintCtx_DrawLine(Ctx, W - 1, 5 * w, 0, H - 9 * w, BLACK, Width, (LINE_STYLE)!Style);
+        PaintCtx_DrawLine(Ctx, 11 * w, 0, 11 * w + 7, H - 1, BLACK, Width, Style);
+        PaintCtx_DrawLine(Ctx, 0, 7 * w, W - 1, 7 * w + 3, BLACK, Width, Style);
+    }
+    PaintCtx_FillPolygon(Ctx, Star, 5, BLACK, FILL_RULE_EVEN_ODD);
+    PaintCtx_FillPolygon(Ctx, Hook, 5, BLACK, FILL_RULE_NON_ZERO);
+    PaintCtx_DrawCircle(Ctx, 80, 50, 19, BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+    PaintCtx_DrawCircle(Ctx, 20, 60, 9, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    PaintCtx_DrawString_EN(Ctx, 1, 24, "Partly cloudy", &Font16P, BLACK, WHITE);
+    PaintCtx_DrawString_EN(Ctx, 30, 44, "72" FONT_DEGREE, &Font20, WHITE, BLACK);
+    PaintCtx_DrawStringScaled(Ctx, 60, 2, "8", &Font12P, 3, TEXT_SMOOTH, BLACK, WHITE);
+}
+
+static void Draw_Full(UWORD Rotate)
+{
+    PaintContext Ctx;
+    PaintCtx_NewImage(&Ctx, Full, W, H, Rotate, WHITE);
+    PaintCtx_Clear(&Ctx, WHITE);
+    Scene(&Ctx);
+}
+
+static UBYTE Pixel(const UBYTE *Img, UWORD X, UWORD Y)
+{
+    return (Img[Y * WB + X / 8] >> (7 - X % 8)) & 1;
+}
+
+//Image is Full inside the window and white outside of it
+static void Check_Masked(const PAINT_RECT *Win)
+{
+    for (UWORD Y = 0; Y < H; Y++) {
+        for (UWORD X = 0; X < W; X++) {
+            UBYTE Inside = X >= Win->Xstart && X < Win->Xend && Y >= Win->Ystart && Y < Win->Yend;
+            UBYTE Want = Inside ? Pixel(Full, X, Y) : 1;
+            if (Pixel(Image, X, Y) != Want) {
+                char Msg[64];
+                snprintf(Msg, sizeof(Msg), "pixel %u,%u in %u,%u-%u,%u", X, Y,
+                         Win->Xstart, Win->Ystart, Win->Xend, Win->Yend);
+                TEST_ASSERT_TRUE_MESSAGE(0, Msg);
+            }
+        }
+    }
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_clip_window_masks_the_scene(void)
+{
+    static const PAINT_RECT Windows[] = {
+        {0, 0, W, H}, {13, 9, 14, 60}, {5, 21, 95, 22}, {17, 3, 61, 47},
+        {33, 30, 67, 71}, {0, 36, 50, H}, {71, 0, W, 40}, {40, 40, 40, 50},
+    };
+    Draw_Full(ROTATE_0);
+    for (UWORD i = 0; i < sizeof(Windows) / sizeof(Windows[0]); i++) {
+        const PAINT_RECT *Win = &Windows[i];
+        PaintContext Ctx;
+        PaintCtx_NewImage(&Ctx, Image, W, H, ROTATE_0, WHITE);
+        PaintCtx_Clear(&Ctx, WHITE);
+        PaintCtx_PushClip(&Ctx, Win->Xstart, Win->Ystart, Win->Xend, Win->Yend);
+        Scene(&Ctx);
+        Check_Masked(Win);
+    }
+}
+
+void test_full_clip_stack_pops_back(void)
+{
+    static const PAINT_RECT Win = {9, 7, 77, 59};
+    Draw_Full(ROTATE_0);
+    PaintContext Ctx;
+    PaintCtx_NewImage(&Ctx, Image, W, H, ROTATE_0, WHITE);
+    PaintCtx_Clear(&Ctx, WHITE);
+    PaintCtx_PushClip(&Ctx, Win.Xstart, Win.Ystart, Win.Xend, Win.Yend);
+
+    //Windows pushed beyond the stack are dropped, their pops are not
+    for (UWORD i = 0; i < PAINT_CLIP_DEPTH + 3; i++)
+        PaintCtx_PushClip(&Ctx, Win.Xstart + i, Win.Ystart, Win.Xend, Win.Yend);
+    for (UWORD i = 0; i < PAINT_CLIP_DEPTH + 3; i++)
+        PaintCtx_PopClip(&Ctx);
+    Scene(&Ctx);
+    Check_Masked(&Win);
+
+    PaintCtx_PopClip(&Ctx);
+    PaintCtx_PopClip(&Ctx);
+    Scene(&Ctx);
+    TEST_ASSERT_EQUAL_MEMORY(Full, Image, sizeof(Full));
+}
+
+void test_strips_give_the_rows_of_the_scene(void)
+{
+    static UBYTE Strip[WB * H];
+    static const UWORD Heights[] = {1, 7, 16, 29, H};
+    for (UWORD Rotate = 0; Rotate < 360; Rotate += 90) {
+        Draw_Full(Rotate);
+        PaintContext Ctx;
+        PaintCtx_NewImage(&Ctx, Image, W, H, Rotate, WHITE);
+        UWORD Rows = Ctx.HeightMemory, Row_Bytes = Ctx.WidthByte;
+        for (UWORD h = 0; h < sizeof(Heights) / sizeof(Heights[0]); h++) {
+            for (UWORD Y = 0; Y < Rows; Y += Heights[h]) {
+                UWORD Yend = Y + Heights[h] < Rows ? Y + Heights[h] : Rows;
+                PaintCtx_SelectBand(&Ctx, Strip, Y, Yend);
+                PaintCtx_Clear(&Ctx, WHITE);
+                Scene(&Ctx);
+                TEST_ASSERT_EQUAL_MEMORY(Full + Y * Row_Bytes, Strip, (Yend - Y) * Row_Bytes);
+            }
+        }
+    }
+}
+
+void test_band_clip_leaves_other_rows(void)
+{
+    for (UWORD Rotate = 0; Rotate < 360; Rotate += 90) {
+        Draw_Full(Rotate);
+        PaintContext Ctx;
+        PaintCtx_NewImage(&Ctx, Image, W, H, Rotate, WHITE);
+        UWORD Rows = Ctx.HeightMemory, Row_Bytes = Ctx.WidthByte;
+        PaintCtx_Clear(&Ctx, WHITE);
+        PaintCtx_PushBand(&Ctx, 11, 40);
+        Scene(&Ctx);
+        for (UWORD Y = 0; Y < Rows; Y++) {
+            if (Y >= 11 && Y < 40) {
+                TEST_ASSERT_EQUAL_MEMORY(Full + Y * Row_Bytes, Image + Y * Row_Bytes, Row_Bytes);
+            } else {
+                for (UWORD X = 0; X < Row_Bytes; X++)
+                    TEST_ASSERT_EQUAL_HEX8(0xFF, Image[Y * Row_Bytes + X]);
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_clip_window_masks_the_scene);
+    RUN_TEST(test_full_clip_stack_pops_back);
+    RUN_TEST(test_strips_give_the_rows_of_the_scene);
+    RUN_TEST(test_band_clip_leaves_other_rows);
+    return UNITY_END();
+}
@@ -0,0 +1,512 @@
+/******************************************************************************
+* | File      	:   test_decode.cpp
+* | Function    :   Host test of GUI_Decode: PNM, BMP and PNG files fed to
+*                   the decoder in chunks of random size
+* | Info        :
+*   The files are made here from known pixels, the PNGs through the
+*   system zlib with stored, fixed and dynamic blocks and 512 byte to
+*   32 KB windows, every row with a random filter. Each file is decoded
+*   whole and in random chunks down to single bytes; both must give the
+*   known pixels drawn row by row with PaintCtx_DrawImage or the
+*   dithering stage. Corrupt and truncated files have to end in
+*   DECODE_ERROR or DECODE_MORE without writing past the work area.
+*
+*   pio test -e native -f test_decode
+******************************************************************************/
+#include <unity.h>
+#include <zlib.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "GUI_Decode.h"
+
+#define CW 160
+#define CH 40
+#define GUARD 64
+
+static UBYTE Black_A[CW / 8 * CH], Red_A[CW / 8 * CH];
+static UBYTE Black_B[CW / 8 * CH], Red_B[CW / 8 * CH];
+static UBYTE Black_R[CW / 8 * CH], Red_R[CW / 8 * CH];
+static UBYTE Work[DECODE_WORK_SIZE(CW) + GUARD];
+static PAINT_DECODER Dec;
+
+/**
+ * Encoded file and the pixels it holds, top row first
+**/
+struct TestFile {
+    std::vector<UBYTE> Data;
+    int Mode;               //0 bits (0 or 255), 1 gray, 2 RGB
+    int Width, Height;
+    bool Bottom_Up;         //Rows are drawn from the bottom
+    std::vector<UBYTE> Pixels;
+};
+
+static std::vector<TestFile> Files;
+static UDOUBLE Seed = 7;
+
+static int Random(int n)
+{
+    Seed ^= Seed << 13;
+    Seed ^= Seed >> 17;
+    Seed ^= Seed << 5;
+    return Seed % n;
+}
+
+//Blocky random samples with repeated rows, so that LZ77 finds matches
+static std::vector<std::vector<int>> Content(int W, int H, int Max)
+{
+    std::vector<std::vector<int>> Rows;
+    for (int y = 0; y < H; y++) {
+        if (y && Random(10) < 3) {
+            Rows.push_back(Rows.back());
+            continue;
+        }
+        std::vector<int> Row;
+        int v = Random(Max + 1);
+        for (int x = 0; x < W; x++) {
+            if (Random(5) == 0)
+                v = Random(Max + 1);
+            Row.push_back(v);
+        }
+        Rows.push_back(Row);
+    }
+    return Rows;
+}
+
+static void Put32(std::vector<UBYTE> *Out, UDOUBLE v, bool Big)
+{
+    for (int i = 0; i < 4; i++)
+        Out->push_back(Big ? v >> (24 - 8 * i) : v >> (8 * i));
+}
+
+static void Put16(std::vector<UBYTE> *Out, UWORD v)
+{
+    Out->push_back(v);
+    Out->push_back(v >> 8);
+}
+
+static void Append(std::vector<UBYTE> *Out, const char *s)
+{
+    Out->insert(Out->end(), s, s + strlen(s));
+}
+
+//Samples of depth bits packed MSB first, rows padded to whole bytes
+static std::vector<UBYTE> Pack(const std::vector<int> &Samples, int Depth)
+{
+    std::vector<UBYTE> Out;
+    int Acc = 0, Bits = 0;
+    for (int v : Samples) {
+        if (Depth == 16) {
+            Out.push_back(v >> 8);
+            Out.push_back(v);
+            continue;
+        }
+        Acc = Acc << Depth | v;
+        Bits += Depth;
+        if (Bits == 8) {
+            Out.push_back(Acc);
+            Acc = Bits = 0;
+        }
+    }
+    if (Bits)
+        Out.push_back(Acc << (8 - Bits));
+    return Out;
+}
+
+static void MakePNM(int W, int H)
+{
+    char Head[64];
+    std::vector<std::vector<int>> Bits = Content(W, H, 1);
+    TestFile F = {{}, 0, W, H, false, {}};
+    snprintf(Head, sizeof(Head), "P4\n# comment\n%d %d\n", W, H);
+    Append(&F.Data, Head);
+    for (auto &Row : Bits) {
+        std::vector<UBYTE> Packed = Pack(Row, 1);
+        F.Data.insert(F.Data.end(), Packed.begin(), Packed.end());
+        for (int v : Row)
+            F.Pixels.push_back(v ? 0 : 255);
+    }
+    Files.push_back(F);
+
+    for (int Max : {255, 100}) {
+        TestFile G = {{}, 1, W, H, false, {}};
+        snprintf(Head, sizeof(Head), "P5 %d\t%d\n#c\n%d\n", W, H, Max);
+        Append(&G.Data, Head);
+        for (auto &Row : Content(W, H, Max))
+            for (int v : Row) {
+                G.Data.push_back(v);
+                G.Pixels.push_back(v * 255 / Max);
+            }
+        Files.push_back(G);
+
+        TestFile C = {{}, 2, W, H, false, {}};
+        snprintf(Head, sizeof(Head), "P6\n%d %d\n%d\n", W, H, Max);
+        Append(&C.Data, Head);
+        for (auto &Row : Content(W, H, Max))
+            for (int v : Row) {
+                int Rgb[3] = {v, v * 3 % (Max + 1), Max - v};
+                for (int c = 0; c < 3; c++) {
+                    C.Data.push_back(Rgb[c]);
+                    C.Pixels.push_back(Rgb[c] * 255 / Max);
+                }
+            }
+        Files.push_back(C);
+    }
+}
+
+static void MakeBMP(int W, int H, int Bpp, bool Top_Down)
+{
+    std::vector<std::vector<UBYTE>> Palette;
+    std::vector<std::vector<int>> Index;
+    std::vector<std::vector<UBYTE>> Rgb(H);
+    if (Bpp <= 8) {
+        int Count = Bpp == 1 ? 2 : Bpp == 4 ? 5 : 200;
+        for (int i = 0; i < Count; i++)
+            Palette.push_back({(UBYTE)Random(256), (UBYTE)Random(256), (UBYTE)Random(256)});
+        if (Bpp == 1)
+            Palette = Top_Down ? std::vector<std::vector<UBYTE>>{{0, 0, 0}, {255, 255, 255}}
+                               : std::vector<std::vector<UBYTE>>{{255, 255, 255}, {230, 20, 20}};
+        Index = Content(W, H, Count - 1);
+        for (int y = 0; y < H; y++)
+            for (int v : Index[y])
+                Rgb[y].insert(Rgb[y].end(), Palette[v].begin(), Palette[v].end());
+    } else {
+        for (int y = 0; y < H; y++)
+            for (int x = 0; x < W; x++) {
+                bool Solid = Random(2);
+                Rgb[y].push_back(Solid ? 200 : Random(256));
+                Rgb[y].push_back(Solid ? 10 : Random(256));
+                Rgb[y].push_back(Solid ? 10 : Random(256));
+            }
+    }
+
+    //Rows are stored bottom up unless the height is negative
+    std::vector<UBYTE> Body;
+    int Row_Bytes = (W * Bpp + 31) / 32 * 4;
+    for (int i = 0; i < H; i++) {
+        int y = Top_Down ? i : H - 1 - i;
+        std::vector<UBYTE> Row;
+        if (Bpp <= 8) {
+            Row = Pack(Index[y], Bpp);
+        } else {
+            for (int x = 0; x < W; x++) {
+                for (int c = 2; c >= 0; c--)
+                    Row.push_back(Rgb[y][x * 3 + c]);
+                if (Bpp == 32)
+                    Row.push_back(0);
+            }
+        }
+        Row.resize(Row_Bytes, 0);
+        Body.insert(Body.end(), Row.begin(), Row.end());
+    }
+
+    //A V5 header for 8 bits, three junk bytes before the pixels
+    int Extra = Bpp == 8 ? 84 : 0, Info = 40 + Extra;
+    int Palette_Bytes = Palette.size() * 4, Offset = 14 + Info + Palette_Bytes + 3;
+    int Used = Bpp <= 8 && (int)Palette.size() < (1 << Bpp) ? Palette.size() : 0;
+    TestFile F = {{'B', 'M'}, 2, W, H, !Top_Down, {}};
+    Put32(&F.Data, Offset + Body.size(), false);
+    Put32(&F.Data, 0, false);
+    Put32(&F.Data, Offset, false);
+    Put32(&F.Data, Info, false);
+    Put32(&F.Data, W, false);
+    Put32(&F.Data, Top_Down ? -H : H, false);
+    Put16(&F.Data, 1);
+    Put16(&F.Data, Bpp);
+    Put32(&F.Data, 0, false);
+    Put32(&F.Data, Body.size(), false);
+    Put32(&F.Data, 2835, false);
+    Put32(&F.Data, 2835, false);
+    Put32(&F.Data, Used, false);
+    Put32(&F.Data, 0, false);
+    F.Data.insert(F.Data.end(), Extra, 7);
+    for (auto &c : Palette) {
+        F.Data.push_back(c[2]);
+        F.Data.push_back(c[1]);
+        F.Data.push_back(c[0]);
+        F.Data.push_back(0);
+    }
+    F.Data.insert(F.Data.end(), {1, 2, 3});
+    F.Data.insert(F.Data.end(), Body.begin(), Body.end());
+    //Drawn in file order
+    for (int i = 0; i < H; i++) {
+        int y = Top_Down ? i : H - 1 - i;
+        F.Pixels.insert(F.Pixels.end(), Rgb[y].begin(), Rgb[y].end());
+    }
+    Files.push_back(F);
+}
+
+static void Chunk(std::vector<UBYTE> *Out, const char *Type, const std::vector<UBYTE> &Data)
+{
+    Put32(Out, Data.size(), true);
+    size_t Start = Out->size();
+    Out->insert(Out->end(), Type, Type + 4);
+    Out->insert(Out->end(), Data.begin(), Data.end());
+    Put32(Out, crc32(0, Out->data() + Start, Out->size() - Start), true);
+}
+
+static int Paeth(int a, int b, int c)
+{
+    int p = a + b - c, pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+    return pa <= pb && pa <= pc ? a : pb <= pc ? b : c;
+}
+
+/******************************************************************************
+function: Encode samples as a PNG
+parameter:
+    Rows     : Samples of each row, channels interleaved
+    Strategy : -1 stored, Z_FIXED or Z_DEFAULT_STRATEGY
+    Wbits    : zlib window bits
+******************************************************************************/
+static std::vector<UBYTE> MakePNG(int W, int H, int Depth, int Type, const std::vector<std::vector<int>> &Rows,
+                                  const std::vector<std::vector<UBYTE>> &Palette, int Strategy, int Wbits)
+{
+    int Channels = Type == 2 ? 3 : Type == 4 ? 2 : Type == 6 ? 4 : 1;
+    int Bpp = Depth * Channels / 8 ? Depth * Channels / 8 : 1;
+    std::vector<UBYTE> Raw, Prev((W * Depth * Channels + 7) / 8, 0);
+    for (auto &Samples : Rows) {
+        std::vector<UBYTE> Line = Pack(Samples, Depth);
+        int Filter = Random(5);
+        Raw.push_back(Filter);
+        for (size_t i = 0; i < Line.size(); i++) {
+            int a = i >= (size_t)Bpp ? Line[i - Bpp] : 0, b = Prev[i], c = i >= (size_t)Bpp ? Prev[i - Bpp] : 0;
+            int Predict[5] = {0, a, b, (a + b) / 2, Paeth(a, b, c)};
+            Raw.push_back(Line[i] - Predict[Filter]);
+        }
+        Prev = Line;
+    }
+
+    z_stream Z;
+    memset(&Z, 0, sizeof(Z));
+    deflateInit2(&Z, Strategy < 0 ? 0 : 9, Z_DEFLATED, Wbits, 9, Strategy < 0 ? Z_DEFAULT_STRATEGY : Strategy);
+    std::vector<UBYTE> Packed(deflateBound(&Z, Raw.size()));
+    Z.next_in = Raw.data();
+    Z.avail_in = Raw.size();
+    Z.next_out = Packed.data();
+    Z.avail_out = Packed.size();
+    deflate(&Z, Z_FINISH);
+    Packed.resize(Z.total_out);
+    deflateEnd(&Z);
+
+    std::vector<UBYTE> Out = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'}, Head;
+    Put32(&Head, W, true);
+    Put32(&Head, H, true);
+    Head.insert(Head.end(), {(UBYTE)Depth, (UBYTE)Type, 0, 0, 0});
+    Chunk(&Out, "IHDR", Head);
+    Chunk(&Out, "tEXt", std::vector<UBYTE>({'C', 'o', 'm', 0, 'h', 'i'}));
+    if (!Palette.empty()) {
+        std::vector<UBYTE> Plte;
+        for (auto &c : Palette)
+            Plte.insert(Plte.end(), c.begin(), c.end());
+        Chunk(&Out, "PLTE", Plte);
+    }
+    //The data split over three IDAT chunks
+    size_t Part = Packed.size() / 3 ? Packed.size() / 3 : 1;
+    for (size_t i = 0; i < Packed.size(); i += Part)
+        Chunk(&Out, "IDAT", std::vector<UBYTE>(Packed.begin() + i, Packed.begin() + std::min(i + Part, Packed.size())));
+    Chunk(&Out, "IEND", {});
+    return Out;
+}
+
+//Sample over a white background
+static int Over(int Color, int Alpha)
+{
+    return (Color * Alpha + 255 * (255 - Alpha)) / 255;
+}
+
+static void MakePNGs(int W, int H, int Strategy, int Wbits)
+{
+    for (int Depth : {1, 2, 4, 8, 16}) {
+        int Max = (1 << Depth) - 1;
+        std::vector<std::vector<int>> Gray = Content(W, H, Max);
+        TestFile F = {MakePNG(W, H, Depth, 0, Gray, {}, Strategy, Wbits), Depth == 1 ? 0 : 1, W, H, false, {}};
+        for (auto &Row : Gray)
+            for (int v : Row)
+                F.Pixels.push_back(Depth == 16 ? v >> 8 : v * 255 / Max);
+        Files.push_back(F);
+
+        if (Depth <= 8) {
+            int Count = std::min(Max + 1, 2 + Random(255));
+            std::vector<std::vector<UBYTE>> Palette;
+            for (int i = 0; i < Count; i++)
+                Palette.push_back({(UBYTE)Random(256), (UBYTE)Random(256), (UBYTE)Random(256)});
+            std::vector<std::vector<int>> Index = Content(W, H, Count - 1);
+            TestFile P = {MakePNG(W, H, Depth, 3, Index, Palette, Strategy, Wbits), 2, W, H, false, {}};
+            for (auto &Row : Index)
+                for (int v : Row)
+                    P.Pixels.insert(P.Pixels.end(), Palette[v].begin(), Palette[v].end());
+            Files.push_back(P);
+        }
+        if (Depth < 8)
+            continue;
+        for (int Type : {2, 4, 6}) {
+            int Channels = Type == 2 ? 3 : Type == 4 ? 2 : 4;
+            std::vector<std::vector<std::vector<int>>> Planes;
+            for (int c = 0; c < Channels; c++)
+                Planes.push_back(Content(W, H, Max));
+            std::vector<std::vector<int>> Samples(H);
+            TestFile C = {{}, Type == 4 ? 1 : 2, W, H, false, {}};
+            for (int y = 0; y < H; y++)
+                for (int x = 0; x < W; x++) {
+                    int s[4];
+                    for (int c = 0; c < Channels; c++) {
+                        Samples[y].push_back(Planes[c][y][x]);
+                        s[c] = Depth == 16 ? Planes[c][y][x] >> 8 : Planes[c][y][x];
+                    }
+                    if (Type == 2)
+                        C.Pixels.insert(C.Pixels.end(), {(UBYTE)s[0], (UBYTE)s[1], (UBYTE)s[2]});
+                    else if (Type == 6)
+                        C.Pixels.insert(C.Pixels.end(), {(UBYTE)Over(s[0], s[3]), (UBYTE)Over(s[1], s[3]),
+                                                         (UBYTE)Over(s[2], s[3])});
+                    else
+                        C.Pixels.push_back(Over(s[0], s[1]));
+                }
+            C.Data = MakePNG(W, H, Depth, Type, Samples, {}, Strategy, Wbits);
+            Files.push_back(C);
+        }
+    }
+}
+
+static void NewContext(PaintContext *Ctx, UBYTE *Black, UBYTE *Red)
+{
+    PaintCtx_NewImage(Ctx, Black, CW, CH, ROTATE_0, WHITE);
+    PaintCtx_SetRedImage(Ctx, Red, NULL);
+    PaintCtx_Clear(Ctx, WHITE);
+}
+
+/******************************************************************************
+function: Decode Len bytes of a file
+parameter:
+    Chunked : Feed random chunks of 1 to 300 bytes instead of the whole file
+return:
+    Status after the last chunk
+******************************************************************************/
+static DECODE_STATUS Decode(const UBYTE *Data, size_t Len, bool Chunked, DITHER_METHOD Method, UBYTE *Black, UBYTE *Red)
+{
+    PaintContext Ctx;
+    NewContext(&Ctx, Black, Red);
+    memset(Work + DECODE_WORK_SIZE(CW), 0xA5, GUARD);
+    PaintDecoder_Init(&Dec, &Ctx, 5, 3, Method, Work, DECODE_WORK_SIZE(CW));
+    DECODE_STATUS Status = DECODE_MORE;
+    for (size_t i = 0; i < Len && Status == DECODE_MORE; ) {
+        size_t n = Len - i;
+        if (Chunked) {
+            int Kind = Random(4);
+            n = std::min(n, (size_t)(1 + (Kind == 0 ? 0 : Random(Kind == 1 ? 7 : 300))));
+        }
+        Status = PaintDecoder_Feed(&Dec, Data + i, n);
+        i += n;
+    }
+    for (int i = 0; i < GUARD; i++)
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE(0xA5, Work[DECODE_WORK_SIZE(CW) + i], "write past the work area");
+    return Status;
+}
+
+//The known pixels, drawn row by row the way the decoder draws them
+static void DrawReference(const TestFile &F, DITHER_METHOD Method)
+{
+    PaintContext Ctx;
+    NewContext(&Ctx, Black_R, Red_R);
+    if (F.Mode == 0) {
+        std::vector<UBYTE> Bits((F.Width + 7) / 8);
+        for (int y = 0; y < F.Height; y++) {
+            std::fill(Bits.begin(), Bits.end(), 0);
+            for (int x = 0; x < F.Width; x++)
+                if (F.Pixels[y * F.Width + x])
+                    Bits[x / 8] |= 0x80 >> (x % 8);
+            PaintCtx_DrawImage(&Ctx, Bits.data(), 5, 3 + y, F.Width, 1);
+        }
+        return;
+    }
+    static int16_t Dither_Work[DITHER_WORK_SIZE(CW) / 2 + 1];
+    PAINT_DITHER Dither;
+    PaintDither_Init(&Dither, &Ctx, 5, 3, F.Width, F.Height, Method, Dither_Work);
+    PaintDither_SetBottomUp(&Dither, F.Bottom_Up);
+    for (int y = 0; y < F.Height; y++) {
+        if (F.Mode == 1)
+            PaintDither_Gray(&Dither, F.Pixels.data() + y * F.Width);
+        else
+            PaintDither_RGB(&Dither, F.Pixels.data() + y * F.Width * 3);
+    }
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_whole_and_chunked_files_give_the_known_pixels(void)
+{
+    char Message[64];
+    for (size_t f = 0; f < Files.size(); f++) {
+        const TestFile &F = Files[f];
+        for (int m = 0; m < 2; m++) {
+            DITHER_METHOD Method = (DITHER_METHOD)m;
+            snprintf(Message, sizeof(Message), "file %u, method %d", (unsigned)f, m);
+            TEST_ASSERT_EQUAL_INT_MESSAGE(DECODE_DONE, Decode(F.Data.data(), F.Data.size(), false, Method,
+                                                              Black_A, Red_A), Message);
+            DrawReference(F, Method);
+            TEST_ASSERT_EQUAL_MEMORY_MESSAGE(Black_R, Black_A, sizeof(Black_A), Message);
+            TEST_ASSERT_EQUAL_MEMORY_MESSAGE(Red_R, Red_A, sizeof(Red_A), Message);
+            for (int Rep = 0; Rep < 4; Rep++) {
+                TEST_ASSERT_EQUAL_INT_MESSAGE(DECODE_DONE, Decode(F.Data.data(), F.Data.size(), true, Method,
+                                                                  Black_B, Red_B), Message);
+                TEST_ASSERT_EQUAL_MEMORY_MESSAGE(Black_A, Black_B, sizeof(Black_A), Message);
+                TEST_ASSERT_EQUAL_MEMORY_MESSAGE(Red_A, Red_B, sizeof(Red_A), Message);
+            }
+        }
+    }
+}
+
+void test_corrupt_and_truncated_files_stop_cleanly(void)
+{
+    for (const TestFile &F : Files) {
+        for (int t = 0; t < 20; t++) {
+            std::vector<UBYTE> Bad = F.Data;
+            Bad[Random(Bad.size())] ^= 1 << Random(8);
+            Decode(Bad.data(), Bad.size(), true, (DITHER_METHOD)(t & 1), Black_B, Red_B);
+        }
+        //Cut in half the decoder waits for the rest
+        TEST_ASSERT_EQUAL_INT(DECODE_MORE, Decode(F.Data.data(), F.Data.size() / 2, true, DITHER_BAYER,
+                                                  Black_B, Red_B));
+    }
+    //Garbage is refused from the first bytes
+    const UBYTE Junk[] = "GIF89a not supported";
+    TEST_ASSERT_EQUAL_INT(DECODE_ERROR, Decode(Junk, sizeof(Junk), false, DITHER_BAYER, Black_B, Red_B));
+}
+
+void test_small_work_area_is_an_error(void)
+{
+    const TestFile &F = Files.back();
+    PaintContext Ctx;
+    NewContext(&Ctx, Black_B, Red_B);
+    PaintDecoder_Init(&Dec, &Ctx, 0, 0, DITHER_BAYER, Work, 200);
+    TEST_ASSERT_EQUAL_INT(DECODE_ERROR, PaintDecoder_Feed(&Dec, F.Data.data(), F.Data.size()));
+}
+
+int main(int argc, char **argv)
+{
+    for (int Size : {1, 37, 64, 130})
+        MakePNM(Size, Size == 1 ? 1 : Size == 64 ? 9 : Size == 37 ? 23 : 40);
+    for (int Size : {1, 37, 130})
+        for (int Bpp : {1, 4, 8, 24, 32})
+            for (bool Top_Down : {false, true})
+                MakeBMP(Size, Size == 1 ? 1 : Size == 37 ? 23 : 17, Bpp, Top_Down);
+    for (int Size : {1, 37, 131}) {
+        int H = Size == 1 ? 1 : Size == 37 ? 23 : 29;
+        MakePNGs(Size, H, -1, 15);
+        MakePNGs(Size, H, Z_FIXED, 15);
+        for (int Wbits : {15, 9, 12})
+            MakePNGs(Size, H, Z_DEFAULT_STRATEGY, Wbits);
+    }
+
+    UNITY_BEGIN();
+    RUN_TEST(test_whole_and_chunked_files_give_the_known_pixels);
+    RUN_TEST(test_corrupt_and_truncated_files_stop_cleanly);
+    RUN_TEST(test_small_work_area_is_an_error);
+    return UNITY_END();
+}
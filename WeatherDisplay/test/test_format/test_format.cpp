@@ -0,0 +1,147 @@
+/******************************************************************************
+* | File      	:   test_format.cpp
+* | Function    :   Host test of the number and unit formatting
+* | Info        :
+*   Checks integers at the ends of their range, fixed-point rounding and
+*   signs, padding, units and cutting off output that does not fit.
+*
+*   pio test -e native -f test_format
+******************************************************************************/
+#include <unity.h>
+#include <stdint.h>
+#include <string.h>
+#include "GUI_Format.h"
+
+static char Buf[32];
+static PAINT_FORMAT Fmt;
+
+static const char *Fixed(int32_t Value, UBYTE Decimals, UBYTE Shown)
+{
+    PaintFormat_Init(&Fmt, Buf, sizeof(Buf));
+    PaintFormat_Fixed(&Fmt, Value, Decimals, Shown);
+    return Buf;
+}
+
+static const char *Int(int32_t Value)
+{
+    PaintFormat_Init(&Fmt, Buf, sizeof(Buf));
+    PaintFormat_Int(&Fmt, Value);
+    return Buf;
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_int(void)
+{
+    TEST_ASSERT_EQUAL_STRING("0", Int(0));
+    TEST_ASSERT_EQUAL_STRING("7", Int(7));
+    TEST_ASSERT_EQUAL_STRING("-7", Int(-7));
+    TEST_ASSERT_EQUAL_STRING("100", Int(100));
+    TEST_ASSERT_EQUAL_STRING("2147483647", Int(INT32_MAX));
+    TEST_ASSERT_EQUAL_STRING("-2147483648", Int(INT32_MIN));
+    TEST_ASSERT_EQUAL_INT(11, Fmt.Len);
+    TEST_ASSERT_FALSE(Fmt.Overflow);
+}
+
+void test_digits(void)
+{
+    PaintFormat_Init(&Fmt, Buf, sizeof(Buf));
+    PaintFormat_Digits(&Fmt, 7, 2);
+    PaintFormat_Char(&Fmt, ':');
+    PaintFormat_Digits(&Fmt, 0, 2);
+    PaintFormat_Char(&Fmt, ' ');
+    PaintFormat_Digits(&Fmt, 12345, 2);
+    PaintFormat_Char(&Fmt, ' ');
+    PaintFormat_Digits(&Fmt, 0, 0);
+    TEST_ASSERT_EQUAL_STRING("07:00 12345 0", Buf);
+}
+
+void test_fixed_rounds_half_away_from_zero(void)
+{
+    TEST_ASSERT_EQUAL_STRING("0", Fixed(0, 0, 0));
+    TEST_ASSERT_EQUAL_STRING("0.0", Fixed(0, 2, 1));
+    TEST_ASSERT_EQUAL_STRING("21.5", Fixed(215, 1, 1));
+    TEST_ASSERT_EQUAL_STRING("3", Fixed(25, 1, 0));
+    TEST_ASSERT_EQUAL_STRING("-3", Fixed(-25, 1, 0));
+    TEST_ASSERT_EQUAL_STRING("2", Fixed(24, 1, 0));
+    TEST_ASSERT_EQUAL_STRING("-2", Fixed(-24, 1, 0));
+    TEST_ASSERT_EQUAL_STRING("30.0", Fixed(2995, 2, 1));
+    TEST_ASSERT_EQUAL_STRING("-30.0", Fixed(-2995, 2, 1));
+    TEST_ASSERT_EQUAL_STRING("29.9", Fixed(2994, 2, 1));
+    TEST_ASSERT_EQUAL_STRING("0.05", Fixed(5, 2, 2));
+    TEST_ASSERT_EQUAL_STRING("-0.05", Fixed(-5, 2, 2));
+    TEST_ASSERT_EQUAL_STRING("-21474836.48", Fixed(INT32_MIN, 2, 2));
+    TEST_ASSERT_EQUAL_STRING("-2", Fixed(INT32_MIN, 9, 0));
+    TEST_ASSERT_EQUAL_STRING("2.147483647", Fixed(INT32_MAX, 9, 9));
+}
+
+void test_fixed_has_no_negative_zero(void)
+{
+    TEST_ASSERT_EQUAL_STRING("0", Fixed(-4, 1, 0));
+    TEST_ASSERT_EQUAL_STRING("0.0", Fixed(-4, 2, 1));
+    TEST_ASSERT_EQUAL_STRING("0.00", Fixed(-4, 3, 2));
+    TEST_ASSERT_EQUAL_STRING("-1", Fixed(-5, 1, 0));
+    TEST_ASSERT_EQUAL_STRING("-0.1", Fixed(-5, 2, 1));
+}
+
+void test_fixed_pads_shown_digits(void)
+{
+    TEST_ASSERT_EQUAL_STRING("5.00", Fixed(5, 0, 2));
+    TEST_ASSERT_EQUAL_STRING("-5.0", Fixed(-5, 0, 1));
+    TEST_ASSERT_EQUAL_STRING("21.500", Fixed(215, 1, 3));
+    TEST_ASSERT_EQUAL_STRING("0.0500", Fixed(5, 2, 4));
+    TEST_ASSERT_EQUAL_STRING("0.000", Fixed(0, 1, 3));
+}
+
+void test_value_with_unit(void)
+{
+    PaintFormat_Init(&Fmt, Buf, sizeof(Buf));
+    PaintFormat_Value(&Fmt, -35, 1, 1, UNIT_FAHRENHEIT);
+    TEST_ASSERT_EQUAL_STRING("-3.5" FONT_DEGREE "F", Buf);
+    PaintFormat_Init(&Fmt, Buf, sizeof(Buf));
+    PaintFormat_Value(&Fmt, 2992, 2, 2, UNIT_INHG);
+    TEST_ASSERT_EQUAL_STRING("29.92 inHg", Buf);
+    PaintFormat_Init(&Fmt, Buf, sizeof(Buf));
+    PaintFormat_Value(&Fmt, 270, 0, 0, UNIT_DEGREE);
+    TEST_ASSERT_EQUAL_STRING("270" FONT_DEGREE, Buf);
+    TEST_ASSERT_FALSE(Fmt.Overflow);
+}
+
+void test_overflow_cuts_at_a_character(void)
+{
+    //"-3°F" is 5 bytes with the two of the degree sign
+    char Small[6];
+    for (UWORD Size = 1; Size <= sizeof(Small); Size++) {
+        static const char * const Expected[] = {
+            "", "-", "-3", "-3", "-3" FONT_DEGREE, "-3" FONT_DEGREE "F"};
+        PaintFormat_Init(&Fmt, Small, Size);
+        PaintFormat_Value(&Fmt, -3, 0, 0, UNIT_FAHRENHEIT);
+        TEST_ASSERT_EQUAL_STRING(Expected[Size - 1], Small);
+        TEST_ASSERT_EQUAL_INT(strlen(Expected[Size - 1]), Fmt.Len);
+        TEST_ASSERT_EQUAL_INT(Size < 6, Fmt.Overflow);
+    }
+
+    PaintFormat_Init(&Fmt, Small, 3);
+    PaintFormat_Str(&Fmt, FONT_DEGREE FONT_DEGREE);
+    TEST_ASSERT_EQUAL_STRING(FONT_DEGREE, Small);
+    TEST_ASSERT_TRUE(Fmt.Overflow);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_int);
+    RUN_TEST(test_digits);
+    RUN_TEST(test_fixed_rounds_half_away_from_zero);
+    RUN_TEST(test_fixed_has_no_negative_zero);
+    RUN_TEST(test_fixed_pads_shown_digits);
+    RUN_TEST(test_value_with_unit);
+    RUN_TEST(test_overflow_cuts_at_a_character);
+    return UNITY_END();
+}
@@ -0,0 +1,179 @@
+/******************************************************************************
+* | File      	:   test_frame.cpp
+* | Function    :   Host test of recorded frames: rendering in strips, in
+*                   parallel bands and redrawing what changed
+* | Info        :
+*   Every way of drawing a frame must give the image of a plain render,
+*   in every rotation. Changed strings and replaced operations are
+*   redrawn into the previous image and compared with a render of the
+*   changed frame from scratch; a string only redraws the characters
+*   between the first and the last one that change.
+*
+*   pio test -e native -f test_frame
+******************************************************************************/
+#include <unity.h>
+#include <string.h>
+#include "GUI_Frame.h"
+
+#define W 124
+#define H 90
+#define WB ((W + 7) / 8)
+
+static UBYTE Image[WB * H], Expected[WB * H], Strip[WB * H];
+static PAINT_OP Ops[24];
+static PAINT_FRAME Frame;
+static UWORD Temp, Wind, Box, Line;
+
+#define TEMP_X  9
+#define TEMP_Y  4
+#define WIND_X  3
+#define WIND_Y  52
+
+static void Record(void)
+{
+    static const PAINT_POINT Wedge[] = {{70, 40}, {121, 30}, {110, 85}};
+    PaintFrame_Init(&Frame, Ops, 24);
+    PaintFrame_Clear(&Frame, WHITE);
+    PaintFrame_FillPolygon(&Frame, Wedge, 3, BLACK, FILL_RULE_EVEN_ODD);
+    Line = PaintFrame_DrawLine(&Frame, 0, 20, W - 1, 30, BLACK, DOT_PIXEL_2X2, LINE_STYLE_SOLID);
+    Temp = PaintFrame_DrawStringScaled(&Frame, TEMP_X, TEMP_Y, "72" FONT_DEGREE "F", &Font16P, 2,
+                                       TEXT_TABULAR, BLACK, WHITE);
+    Wind = PaintFrame_DrawString_EN(&Frame, WIND_X, WIND_Y, "Wind 5 mph", &Font12P, BLACK, WHITE);
+    Box = PaintFrame_DrawTextBox(&Frame, 60, 60, W, H, "Light rain this evening", &Font12P,
+                                 TEXT_WRAP, BLACK, WHITE);
+    PaintFrame_DrawLine(&Frame, 5, H - 1, 60, 0, BLACK, DOT_PIXEL_1X1, LINE_STYLE_DOTTED);
+    PaintFrame_DrawCircle(&Frame, 100, 20, 14, BLACK, DOT_PIXEL_1X1, DRAW_FILL_EMPTY);
+}
+
+static void Render(UBYTE *Out, UWORD Rotate)
+{
+    PaintContext Ctx;
+    PaintCtx_NewImage(&Ctx, Out, W, H, Rotate, WHITE);
+    PaintCtx_Clear(&Ctx, WHITE);
+    PaintFrame_Render(&Frame, &Ctx);
+}
+
+static void Keep_Strip(const UBYTE *Rows, UWORD Ystart, UWORD Yend, void *Arg)
+{
+    PaintContext *Ctx = (PaintContext *)Arg;
+    memcpy(Image + Ystart * Ctx->WidthByte, Rows, (Yend - Ystart) * Ctx->WidthByte);
+}
+
+//Left and right of characters From..To-1 of a string, in pixels
+static void Cells(const char *Text, sFONT *Font, UWORD Flags, UWORD From, UWORD To,
+                  UWORD *Left, UWORD *Right)
+{
+    PAINT_GLYPH_POS Glyphs[PAINT_OP_TEXT_LEN];
+    PAINT_LAYOUT Layout;
+    PaintLayout_Init(&Layout, Glyphs, PAINT_OP_TEXT_LEN);
+    PaintLayout_String(&Layout, Text, Font, Flags);
+    *Left = Glyphs[From].X;
+    *Right = Glyphs[To - 1].X + Glyphs[To - 1].Width;
+}
+
+void setUp(void)
+{
+    Record();
+}
+
+void tearDown(void)
+{
+}
+
+void test_strips_and_bands_match_a_render(void)
+{
+    static const UWORD Heights[] = {1, 8, 13, 64, 200};
+    for (UWORD Rotate = 0; Rotate < 360; Rotate += 90) {
+        Render(Expected, Rotate);
+        for (UWORD h = 0; h < sizeof(Heights) / sizeof(Heights[0]); h++) {
+            PaintContext Ctx;
+            PaintCtx_NewImage(&Ctx, Image, W, H, Rotate, WHITE);
+            memset(Image, 0x55, sizeof(Image));
+            PaintFrame_RenderStrips(&Frame, &Ctx, Strip, Heights[h], 0, Keep_Strip, &Ctx);
+            TEST_ASSERT_EQUAL_MEMORY(Expected, Image, sizeof(Image));
+        }
+
+        //The frame clears the image itself, both start out black
+        PaintContext Ctx;
+        PaintCtx_NewImage(&Ctx, Expected, W, H, Rotate, WHITE);
+        PaintCtx_Clear(&Ctx, BLACK);
+        PaintFrame_Render(&Frame, &Ctx);
+        PaintCtx_SelectImage(&Ctx, Image);
+        PaintCtx_Clear(&Ctx, BLACK);
+        PaintFrame_RenderParallel(&Frame, &Ctx);
+        TEST_ASSERT_EQUAL_MEMORY(Expected, Image, sizeof(Image));
+    }
+}
+
+void test_redraw_matches_a_render_of_the_change(void)
+{
+    for (UWORD Rotate = 0; Rotate < 360; Rotate += 90) {
+        Record();
+        PaintContext Ctx;
+        PaintCtx_NewImage(&Ctx, Image, W, H, Rotate, WHITE);
+        PaintCtx_Clear(&Ctx, WHITE);
+        PaintFrame_Render(&Frame, &Ctx);
+
+        PaintFrame_SetString(&Frame, Temp, "-3" FONT_DEGREE "F");
+        PaintFrame_SetString(&Frame, Wind, "Wind 15 mph");
+        TEST_ASSERT_TRUE(PaintFrame_Redraw(&Frame, &Ctx, NULL));
+        Render(Expected, Rotate);
+        TEST_ASSERT_EQUAL_MEMORY(Expected, Image, sizeof(Image));
+
+        PaintFrame_SetString(&Frame, Box, "Clear");
+        PAINT_OP Op;
+        PAINT_FRAME Scratch;
+        PaintFrame_Init(&Scratch, &Op, 1);
+        PaintFrame_DrawLine(&Scratch, 0, 70, W - 1, 35, BLACK, DOT_PIXEL_3X3, LINE_STYLE_DOTTED);
+        PaintFrame_Replace(&Frame, Line, &Op);
+        TEST_ASSERT_TRUE(PaintFrame_Redraw(&Frame, &Ctx, NULL));
+        Render(Expected, Rotate);
+        TEST_ASSERT_EQUAL_MEMORY(Expected, Image, sizeof(Image));
+
+        TEST_ASSERT_FALSE(PaintFrame_Redraw(&Frame, &Ctx, NULL));
+    }
+}
+
+void test_set_string_redraws_only_what_changes(void)
+{
+    PaintContext Ctx;
+    PAINT_RECT Redrawn;
+    UWORD Left, Right;
+    PaintCtx_NewImage(&Ctx, Image, W, H, ROTATE_0, WHITE);
+    PaintCtx_Clear(&Ctx, WHITE);
+    PaintFrame_Render(&Frame, &Ctx);
+
+    //Tabular digits keep "°F" in place, only the "2" becomes a "3"
+    PaintFrame_SetString(&Frame, Temp, "73" FONT_DEGREE "F");
+    TEST_ASSERT_TRUE(PaintFrame_Redraw(&Frame, &Ctx, &Redrawn));
+    Cells("73" FONT_DEGREE "F", &Font16P, TEXT_TABULAR, 1, 2, &Left, &Right);
+    TEST_ASSERT_EQUAL_INT(TEMP_X + 2 * Left, Redrawn.Xstart);
+    TEST_ASSERT_EQUAL_INT(TEMP_X + 2 * Right, Redrawn.Xend);
+    TEST_ASSERT_EQUAL_INT(TEMP_Y, Redrawn.Ystart);
+    TEST_ASSERT_EQUAL_INT(TEMP_Y + 2 * Font16P.Height, Redrawn.Yend);
+
+    //An extra digit moves " mph", "Wind " stays
+    PaintFrame_SetString(&Frame, Wind, "Wind 15 mph");
+    TEST_ASSERT_TRUE(PaintFrame_Redraw(&Frame, &Ctx, &Redrawn));
+    Cells("Wind 15 mph", &Font12P, 0, 5, 11, &Left, &Right);
+    TEST_ASSERT_EQUAL_INT(WIND_X + Left, Redrawn.Xstart);
+    TEST_ASSERT_EQUAL_INT(WIND_X + Right, Redrawn.Xend);
+    TEST_ASSERT_EQUAL_INT(WIND_Y, Redrawn.Ystart);
+    TEST_ASSERT_EQUAL_INT(WIND_Y + Font12P.Height, Redrawn.Yend);
+
+    //The same text again changes nothing
+    PaintFrame_SetString(&Frame, Wind, "Wind 15 mph");
+    TEST_ASSERT_FALSE(PaintFrame_Redraw(&Frame, &Ctx, &Redrawn));
+
+    Render(Expected, ROTATE_0);
+    TEST_ASSERT_EQUAL_MEMORY(Expected, Image, sizeof(Image));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_strips_and_bands_match_a_render);
+    RUN_TEST(test_redraw_matches_a_render_of_the_change);
+    RUN_TEST(test_set_string_redraws_only_what_changes);
+    return UNITY_END();
+}
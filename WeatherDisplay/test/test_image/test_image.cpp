@@ -0,0 +1,291 @@
+/******************************************************************************
+* | File      	:   test_image.cpp
+* | Function    :   Host test of the tri-colour planes
+* | Info        :
+*   A scene in black, white and red is drawn into a tri-colour image with
+*   a dense or a sparse red plane, and into plain 1-bit images with its
+*   colours mapped to what each plane holds: the black plane is white
+*   where the scene is red, the red plane is black only where it is red.
+*   The planes must match those images in every rotation, also on a
+*   width that is not a whole number of bytes.
+*
+*   A packed 2-bit image holds both colours; the planes split out of it
+*   must match the planes drawn separately, and a random packed image
+*   must split like a loop testing every pixel.
+*
+*   Images are blitted at any position, partly outside of the image and
+*   of a clip window, and compared with drawing them pixel by pixel.
+*
+*   pio test -e native -f test_image
+******************************************************************************/
+#include <unity.h>
+#include <stdlib.h>
+#include <string.h>
+#include "GUI_Paint.h"
+
+#define W 101
+#define H 67
+#define WB ((W + 7) / 8)
+
+static UBYTE Black[WB * H], Red[WB * H], Expected[WB * H], Rows[WB * H];
+static UBYTE Packed[(W + 3) / 4 * H];
+static UBYTE Reference[WB * H], Reference_Red[WB * H];
+static UWORD RowHead[H], RedHead[H];
+static PAINT_RUN Runs[4096], RedRuns[4096];
+
+//Black on white cloud with a white sun cut out of it
+static const unsigned char Icon[] = {
+    0xF0, 0x3F, 0xC0, 0x7F, 0x00, 0x1F, 0x38, 0x0F, 0x7C, 0x07,
+    0x38, 0x07, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0F, 0xC0, 0x1F,
+};
+#define ICON_W  13
+#define ICON_H  10
+
+typedef enum {
+    ROUTE_SCENE = 0,    //Colours as they are
+    ROUTE_BLACK,        //What the black plane holds
+    ROUTE_RED,          //What the red plane holds
+} ROUTE;
+
+static UWORD Ink(ROUTE Route, UWORD Color)
+{
+    if (Route == ROUTE_BLACK)
+        return Color == RED ? WHITE : Color;
+    if (Route == ROUTE_RED)
+        return Color == RED ? BLACK : WHITE;
+    return Color;
+}
+
+static void Scene(PaintContext *Ctx, ROUTE Route)
+{
+    static const PAINT_POINT Flag[] = {{60, 3}, {97, 12}, {61, 26}, {70, 13}};
+    PaintCtx_ClearWindows(Ctx, 5, 4, 43, 29, Ink(Route, RED));
+    //A white background is left transparent, on the black plane a red one
+    //only matches it where nothing is drawn yet
+    PaintCtx_DrawString_EN(Ctx, 7, 6, "Hi", &Font16P, Ink(Route, WHITE), Ink(Route, RED));
+    PaintCtx_DrawString_EN(Ctx, 9, 31, "Ice", &Font12, Ink(Route, BLACK), Ink(Route, RED));
+    PaintCtx_DrawRectangle(Ctx, 21, 9, 70, 40, Ink(Route, BLACK), DOT_PIXEL_3X3, DRAW_FILL_EMPTY);
+    PaintCtx_DrawCircle(Ctx, 30, 45, 19, Ink(Route, RED), DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+    PaintCtx_DrawCircle(Ctx, 80, 50, 11, Ink(Route, RED), DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    PaintCtx_DrawLine(Ctx, 0, 66, 100, 2, Ink(Route, RED), DOT_PIXEL_2X2, LINE_STYLE_DOTTED);
+    PaintCtx_DrawLine(Ctx, 3, 60, 97, 58, Ink(Route, WHITE), DOT_PIXEL_1X1, LINE_STYLE_SOLID);
+    PaintCtx_FillPolygon(Ctx, Flag, 4, Ink(Route, RED), FILL_RULE_EVEN_ODD);
+    PaintCtx_DrawPoint(Ctx, 50, 33, Ink(Route, RED), DOT_PIXEL_4X4, DOT_FILL_AROUND);
+    PaintCtx_DrawString_EN(Ctx, 40, 30, "32" FONT_DEGREE, &Font12P, Ink(Route, RED), Ink(Route, WHITE));
+
+    //Drawn image pixels leave nothing red under them
+    if (Route == ROUTE_RED)
+        PaintCtx_ClearWindows(Ctx, 37, 20, 37 + ICON_W, 20 + ICON_H, WHITE);
+    else
+        PaintCtx_DrawImage(Ctx, Icon, 37, 20, ICON_W, ICON_H);
+}
+
+//A 1-bit image of the scene through Route
+static void Draw_Route(UWORD Rotate, UBYTE Mirror, ROUTE Route)
+{
+    PaintContext Ctx;
+    PaintCtx_NewImage(&Ctx, Expected, W, H, Rotate, WHITE);
+    PaintCtx_SetMirroring(&Ctx, Mirror);
+    PaintCtx_Clear(&Ctx, WHITE);
+    Scene(&Ctx, Route);
+}
+
+static void Check_Plane(PaintContext *Ctx, ROUTE Route)
+{
+    UWORD Rotate = Ctx->Rotate;
+    UBYTE Mirror = Ctx->Mirror;
+    UDOUBLE Bytes = (UDOUBLE)Ctx->WidthByte * Ctx->HeightMemory;
+    if (Route == ROUTE_RED)
+        PaintCtx_ReadRedRows(Ctx, 0, Ctx->HeightMemory, Rows);
+    else
+        PaintCtx_ReadRows(Ctx, 0, Ctx->HeightMemory, Rows);
+    Draw_Route(Rotate, Mirror, Route);
+    TEST_ASSERT_EQUAL_MEMORY(Expected, Rows, Bytes);
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_tricolour_routes_red_to_its_plane(void)
+{
+    static const UBYTE Mirrors[] = {MIRROR_NONE, MIRROR_HORIZONTAL, MIRROR_ORIGIN};
+    for (UWORD Rotate = 0; Rotate < 360; Rotate += 90) {
+        for (UWORD m = 0; m < sizeof(Mirrors); m++) {
+            PaintContext Ctx;
+            PAINT_SPARSE Sparse, Sparse_Red;
+
+            //Dense black and red planes
+            PaintCtx_NewImage(&Ctx, Black, W, H, Rotate, WHITE);
+            PaintCtx_SetMirroring(&Ctx, Mirrors[m]);
+            PaintCtx_SetRedImage(&Ctx, Red, NULL);
+            PaintCtx_Clear(&Ctx, WHITE);
+            Scene(&Ctx, ROUTE_SCENE);
+            Check_Plane(&Ctx, ROUTE_BLACK);
+            Check_Plane(&Ctx, ROUTE_RED);
+
+            //Dense black plane, sparse red plane
+            PaintSparse_Init(&Sparse_Red, RedHead, RedRuns, 4096);
+            PaintCtx_NewImage(&Ctx, Black, W, H, Rotate, WHITE);
+            PaintCtx_SetMirroring(&Ctx, Mirrors[m]);
+            PaintCtx_SetRedImage(&Ctx, NULL, &Sparse_Red);
+            PaintCtx_Clear(&Ctx, WHITE);
+            Scene(&Ctx, ROUTE_SCENE);
+            Check_Plane(&Ctx, ROUTE_BLACK);
+            Check_Plane(&Ctx, ROUTE_RED);
+            TEST_ASSERT_NULL(Sparse_Red.Dense);
+
+            //Both planes sparse
+            PaintSparse_Init(&Sparse, RowHead, Runs, 4096);
+            PaintSparse_Init(&Sparse_Red, RedHead, RedRuns, 4096);
+            PaintCtx_NewSparseImage(&Ctx, &Sparse, W, H, Rotate, WHITE);
+            PaintCtx_SetMirroring(&Ctx, Mirrors[m]);
+            PaintCtx_SetRedImage(&Ctx, NULL, &Sparse_Red);
+            Scene(&Ctx, ROUTE_SCENE);
+            Check_Plane(&Ctx, ROUTE_BLACK);
+            Check_Plane(&Ctx, ROUTE_RED);
+            TEST_ASSERT_NULL(Sparse.Dense);
+            TEST_ASSERT_NULL(Sparse_Red.Dense);
+        }
+    }
+}
+
+void test_red_without_a_red_plane_is_black(void)
+{
+    PaintContext Ctx;
+    PaintCtx_NewImage(&Ctx, Black, W, H, ROTATE_0, WHITE);
+    PaintCtx_Clear(&Ctx, WHITE);
+    Scene(&Ctx, ROUTE_SCENE);
+
+    //Black wherever the tri-colour image is black or red
+    PaintCtx_NewImage(&Ctx, Expected, W, H, ROTATE_0, WHITE);
+    PaintCtx_SetRedImage(&Ctx, Red, NULL);
+    PaintCtx_Clear(&Ctx, WHITE);
+    Scene(&Ctx, ROUTE_SCENE);
+    PaintCtx_ReadRows(&Ctx, 0, H, Rows);
+    PaintCtx_ReadRedRows(&Ctx, 0, H, Expected);
+    for (UWORD i = 0; i < WB * H; i++)
+        Rows[i] &= Expected[i];
+    TEST_ASSERT_EQUAL_MEMORY(Rows, Black, WB * H);
+}
+
+void test_packed_image_splits_into_the_planes(void)
+{
+    for (UWORD Rotate = 0; Rotate < 360; Rotate += 90) {
+        PaintContext Ctx;
+        PaintCtx_NewImage(&Ctx, Black, W, H, Rotate, WHITE);
+        PaintCtx_SetRedImage(&Ctx, Red, NULL);
+        PaintCtx_Clear(&Ctx, WHITE);
+        Scene(&Ctx, ROUTE_SCENE);
+
+        PaintCtx_NewImage(&Ctx, Packed, W, H, Rotate, WHITE);
+        PaintCtx_SetScale(&Ctx, 4);
+        PaintCtx_SetRedImage(&Ctx, NULL, NULL);
+        PaintCtx_Clear(&Ctx, WHITE);
+        Scene(&Ctx, ROUTE_SCENE);
+        PaintCtx_ReadRows(&Ctx, 0, H, Rows);
+        TEST_ASSERT_EQUAL_MEMORY(Black, Rows, WB * H);
+        PaintCtx_ReadRedRows(&Ctx, 0, H, Rows);
+        TEST_ASSERT_EQUAL_MEMORY(Red, Rows, WB * H);
+    }
+}
+
+void test_packed_split_matches_every_pixel(void)
+{
+    srand(7);
+    for (UWORD Width = 1; Width <= W; Width++) {
+        UWORD Plane_Bytes = (Width + 7) / 8;
+        PaintContext Ctx;
+        PaintCtx_NewImage(&Ctx, Packed, Width, H, ROTATE_0, WHITE);
+        PaintCtx_SetScale(&Ctx, 4);
+        PaintCtx_SetRedImage(&Ctx, NULL, NULL);
+        for (UDOUBLE i = 0; i < (UDOUBLE)Ctx.WidthByte * H; i++)
+            Packed[i] = rand();
+
+        for (UBYTE Plane = 0; Plane < 2; Plane++) {
+            if (Plane)
+                PaintCtx_ReadRedRows(&Ctx, 0, H, Rows);
+            else
+                PaintCtx_ReadRows(&Ctx, 0, H, Rows);
+            //Padding bits are white, only one code is drawn on each plane
+            memset(Expected, 0xFF, Plane_Bytes * H);
+            for (UWORD Y = 0; Y < H; Y++) {
+                for (UWORD X = 0; X < Width; X++) {
+                    UBYTE Code = (Packed[Y * Ctx.WidthByte + X / 4] >> (6 - X % 4 * 2)) & 0x03;
+                    if (Code == (Plane ? PACKED_RED : PACKED_BLACK))
+                        Expected[Y * Plane_Bytes + X / 8] &= ~(0x80 >> (X % 8));
+                }
+            }
+            TEST_ASSERT_EQUAL_MEMORY(Expected, Rows, Plane_Bytes * H);
+        }
+    }
+}
+
+//A red and black background with the clip window pushed
+static void Start_Blit(PaintContext *Ctx, UBYTE *Image, UBYTE *Image_Red, UWORD Rotate, UBYTE Mirror,
+                       const PAINT_RECT *Win)
+{
+    PaintCtx_NewImage(Ctx, Image, W, H, Rotate, WHITE);
+    PaintCtx_SetMirroring(Ctx, Mirror);
+    PaintCtx_SetRedImage(Ctx, Image_Red, NULL);
+    PaintCtx_Clear(Ctx, WHITE);
+    PaintCtx_ClearWindows(Ctx, 0, 0, Ctx->Width / 2, Ctx->Height, BLACK);
+    PaintCtx_ClearWindows(Ctx, Ctx->Width / 3, Ctx->Height / 4, Ctx->Width, Ctx->Height / 2, RED);
+    PaintCtx_PushClip(Ctx, Win->Xstart, Win->Ystart, Win->Xend, Win->Yend);
+}
+
+void test_blit_matches_drawing_every_pixel(void)
+{
+    static UBYTE Bits[8 * 40];
+    static const UBYTE Mirrors[] = {MIRROR_NONE, MIRROR_HORIZONTAL, MIRROR_VERTICAL, MIRROR_ORIGIN};
+    srand(36);
+    for (UWORD n = 0; n < 800; n++) {
+        UWORD Rotate = 90 * (n % 4);
+        UBYTE Mirror = Mirrors[n / 4 % 4];
+        IMAGE_MODE Mode = (IMAGE_MODE)(n / 16 % 3);
+        UWORD Width = 1 + rand() % 60, Height = 1 + rand() % 40;
+        UWORD Row_Len = (Width + 7) / 8;
+        for (UWORD i = 0; i < Row_Len * Height; i++)
+            Bits[i] = rand();
+
+        PaintContext Ctx, Ref;
+        UWORD Logical_W = Rotate % 180 ? H : W, Logical_H = Rotate % 180 ? W : H;
+        UWORD X = rand() % Logical_W, Y = rand() % Logical_H;
+        PAINT_RECT Win = {0, 0, Logical_W, Logical_H};
+        if (n % 2) {
+            Win.Xstart = rand() % Logical_W;
+            Win.Ystart = rand() % Logical_H;
+            Win.Xend = Win.Xstart + 1 + rand() % (Logical_W - Win.Xstart);
+            Win.Yend = Win.Ystart + 1 + rand() % (Logical_H - Win.Ystart);
+        }
+
+        Start_Blit(&Ctx, Black, Red, Rotate, Mirror, &Win);
+        PaintCtx_DrawImageMode(&Ctx, Bits, X, Y, Width, Height, Mode);
+
+        Start_Blit(&Ref, Reference, Reference_Red, Rotate, Mirror, &Win);
+        for (UWORD j = 0; j < Height; j++) {
+            for (UWORD i = 0; i < Width; i++) {
+                UBYTE Bit = (Bits[j * Row_Len + i / 8] >> (7 - i % 8)) & 1;
+                if (Mode == IMAGE_COPY || (Mode == IMAGE_OR) == Bit)
+                    PaintCtx_SetPixel(&Ref, X + i, Y + j, Bit ? WHITE : BLACK);
+            }
+        }
+        TEST_ASSERT_EQUAL_MEMORY(Reference, Black, WB * H);
+        TEST_ASSERT_EQUAL_MEMORY(Reference_Red, Red, WB * H);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_tricolour_routes_red_to_its_plane);
+    RUN_TEST(test_red_without_a_red_plane_is_black);
+    RUN_TEST(test_packed_image_splits_into_the_planes);
+    RUN_TEST(test_packed_split_matches_every_pixel);
+    RUN_TEST(test_blit_matches_drawing_every_pixel);
+    return UNITY_END();
+}
@@ -0,0 +1,113 @@
+/******************************************************************************
+* | File      	:   test_sparse.cpp
+* | Function    :   Host test of the sparse plane: drawing into runs, and
+*                   turning the runs into a dense image
+* | Info        :
+*   A frame of lines, shapes, text and white windows cut out of them is
+*   rendered into a dense image and into sparse planes with run pools of
+*   several sizes, in every rotation. A pool too small for the frame
+*   makes the plane dense partway through; the dense image it leaves
+*   must hold the same bytes as the image drawn dense from the start, and
+*   the rows read out of every plane must be those bytes.
+*
+*   pio test -e native -f test_sparse
+******************************************************************************/
+#include <unity.h>
+#include <stdlib.h>
+#include <string.h>
+#include "GUI_Frame.h"
+
+#define W 120
+#define H 88
+
+static UBYTE Dense[W / 8 * H], Rows[W / 8 * H];
+static UWORD RowHead[W > H ? W : H];
+static PAINT_RUN Runs[2048];
+static PAINT_OP Ops[32];
+static PAINT_FRAME Frame;
+
+static void Record(void)
+{
+    static const PAINT_POINT Star[] = {{60, 4}, {72, 40}, {40, 18}, {80, 18}, {48, 40}};
+    PaintFrame_Init(&Frame, Ops, 32);
+    PaintFrame_DrawRectangle(&Frame, 3, 3, W - 3, H - 3, BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+    PaintFrame_DrawLine(&Frame, 0, 0, W - 1, H - 1, BLACK, DOT_PIXEL_1X1, LINE_STYLE_SOLID);
+    PaintFrame_DrawLine(&Frame, 5, H - 7, W - 9, 11, BLACK, DOT_PIXEL_3X3, LINE_STYLE_DOTTED);
+    PaintFrame_DrawCircle(&Frame, 30, 50, 17, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    PaintFrame_DrawCircle(&Frame, 90, 60, 20, BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+    PaintFrame_FillPolygon(&Frame, Star, 5, BLACK, FILL_RULE_EVEN_ODD);
+    PaintFrame_DrawString_EN(&Frame, 9, 66, "Rain 72\xC2\xB0" "F", &Font12P, BLACK, WHITE);
+    PaintFrame_DrawString_EN(&Frame, 50, 30, "Wind", &Font16, WHITE, BLACK);
+    PaintFrame_ClearWindows(&Frame, 20, 40, 37, 47, WHITE);
+    PaintFrame_DrawRectangle(&Frame, 70, 44, 100, 52, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+}
+
+void setUp(void)
+{
+    Record();
+}
+
+void tearDown(void)
+{
+}
+
+void test_sparse_planes_read_out_the_dense_image(void)
+{
+    static const UWORD Capacities[] = {4, 40, 120, 300, 2048};
+    for (UWORD Rotate = 0; Rotate < 360; Rotate += 90) {
+        PaintContext Ctx;
+        PaintCtx_NewImage(&Ctx, Dense, W, H, Rotate, WHITE);
+        PaintCtx_Clear(&Ctx, WHITE);
+        PaintFrame_Render(&Frame, &Ctx);
+        UWORD Memory_Rows = Ctx.HeightMemory;
+
+        UBYTE Stayed_Sparse = 0, Turned_Dense = 0;
+        for (UWORD c = 0; c < sizeof(Capacities) / sizeof(Capacities[0]); c++) {
+            PAINT_SPARSE Sparse;
+            PaintSparse_Init(&Sparse, RowHead, Runs, Capacities[c]);
+            PaintCtx_NewSparseImage(&Ctx, &Sparse, W, H, Rotate, WHITE);
+            PaintFrame_Render(&Frame, &Ctx);
+            PaintCtx_ReadRows(&Ctx, 0, Memory_Rows, Rows);
+            TEST_ASSERT_EQUAL_MEMORY(Dense, Rows, sizeof(Dense));
+            if (Sparse.Dense) {
+                //The context now draws into the dense image the plane left
+                TEST_ASSERT_EQUAL_PTR(Sparse.Dense, Ctx.Image);
+                TEST_ASSERT_NULL(Ctx.Sparse);
+                TEST_ASSERT_EQUAL_MEMORY(Dense, Sparse.Dense, sizeof(Dense));
+                free(Sparse.Dense);
+                Turned_Dense = 1;
+            } else {
+                Stayed_Sparse = 1;
+            }
+        }
+        TEST_ASSERT_TRUE(Stayed_Sparse);
+        TEST_ASSERT_TRUE(Turned_Dense);
+    }
+}
+
+void test_dense_clear_makes_the_plane_dense(void)
+{
+    PAINT_SPARSE Sparse;
+    PaintContext Ctx;
+    PaintSparse_Init(&Sparse, RowHead, Runs, 2048);
+    PaintCtx_NewSparseImage(&Ctx, &Sparse, W, H, ROTATE_0, WHITE);
+    PaintFrame_Render(&Frame, &Ctx);
+    TEST_ASSERT_NULL(Sparse.Dense);
+
+    //Black everywhere has no room in runs, white again is an empty plane
+    PaintCtx_Clear(&Ctx, BLACK);
+    TEST_ASSERT_NOT_NULL(Sparse.Dense);
+    memset(Rows, 0xFF, sizeof(Rows));
+    PaintCtx_ReadRows(&Ctx, 0, H, Rows);
+    for (UWORD i = 0; i < sizeof(Rows); i++)
+        TEST_ASSERT_EQUAL_HEX8(0x00, Rows[i]);
+    free(Sparse.Dense);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_sparse_planes_read_out_the_dense_image);
+    RUN_TEST(test_dense_clear_makes_the_plane_dense);
+    return UNITY_END();
+}
@@ -0,0 +1,344 @@
+/******************************************************************************
+* | File      	:   test_text.cpp
+* | Function    :   Host test of the string path: decoding of UTF-8 and of
+*                   legacy 8-bit text
+* | Info        :
+*   A byte that does not start a valid UTF-8 sequence is drawn as the
+*   Latin-1 character it is on its own. Strings are drawn with a copy of
+*   Font16P that also maps U+00C0 and U+00E9 to the glyphs of 'A' and 'e',
+*   and compared pixel by pixel with strings of the same characters
+*   written out.
+*
+*   Text boxes are compared with their lines drawn one by one as strings.
+*   A character a font leaves out is drawn as its fallback glyph.
+*   Text drawn at twice or three times its size must be the text drawn
+*   at its size with every pixel repeated.
+*   Underlined text is the plain text with one row filled below the
+*   bottom of 'H', across every cell.
+*   Kerned pairs are placed closer by the adjustment of the font's
+*   table, and TEXT_TABULAR gives every digit the same cell.
+*
+*   pio test -e native -f test_text
+******************************************************************************/
+#include <unity.h>
+#include <string.h>
+#include "GUI_Paint.h"
+
+#define W 200
+#define H 16
+
+#define BOX_W 64
+#define BOX_H 48
+
+static UBYTE Image[W / 8 * H], Expected[W / 8 * H];
+static UBYTE Box[BOX_W / 8 * BOX_H], Box_Expected[BOX_W / 8 * BOX_H];
+static UBYTE Big[W / 8 * 3 * H], Big_Expected[W / 8 * 3 * H];
+static sFONT Latin;
+
+//Font16P with U+00B0 where it was, U+00C0 as 'A' and U+00E9 as 'e'
+static const sRANGE Latin_Ranges[] =
+{
+    {0x00B0, 1, 96},
+    {0x00C0, 1, 'A' - 0x20},
+    {0x00E9, 1, 'e' - 0x20},
+};
+
+//Pairs for a copy of Font16P, sorted by left and then right character
+static const sKERN Kerned_Pairs[] =
+{
+    {'1', '7', -2},
+    {'A', 'V', -2},
+    {'T', 'o', -3},
+    {'V', 'A', -2},
+};
+
+static void Draw(UBYTE *Out, const char *Text)
+{
+    PaintContext Ctx;
+    PaintCtx_NewImage(&Ctx, Out, W, H, ROTATE_0, WHITE);
+    PaintCtx_Clear(&Ctx, WHITE);
+    PaintCtx_DrawString_EN(&Ctx, 0, 0, Text, &Latin, BLACK, WHITE);
+}
+
+static void Draw_Font(UBYTE *Out, const char *Text, sFONT *Font)
+{
+    PaintContext Ctx;
+    PaintCtx_NewImage(&Ctx, Out, BOX_W, BOX_H, ROTATE_0, WHITE);
+    PaintCtx_Clear(&Ctx, WHITE);
+    PaintCtx_DrawString_EN(&Ctx, 0, 0, Text, Font, BLACK, WHITE);
+}
+
+static void Same_In(sFONT *Font, const char *Text, const char *As)
+{
+    Draw_Font(Box, Text, Font);
+    Draw_Font(Box_Expected, As, Font);
+    TEST_ASSERT_EQUAL_UINT16(Paint_MeasureString(As, Font), Paint_MeasureString(Text, Font));
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(Box_Expected, Box, sizeof(Box), As);
+}
+
+static void Same(const char *Text, const char *As)
+{
+    Draw(Image, Text);
+    Draw(Expected, As);
+    TEST_ASSERT_EQUAL_UINT16(Paint_MeasureString(As, &Latin), Paint_MeasureString(Text, &Latin));
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(Expected, Image, sizeof(Image), As);
+}
+
+//Draw a text box, and the lines it should hold as strings
+static UWORD Draw_Box(UWORD Box_Width, UWORD Box_Height, const char *Text, sFONT *Font, UWORD Flags,
+                      const char * const *Lines, UWORD Count)
+{
+    PaintContext Ctx;
+    PaintCtx_NewImage(&Ctx, Box_Expected, BOX_W, BOX_H, ROTATE_0, WHITE);
+    PaintCtx_Clear(&Ctx, WHITE);
+    for (UWORD i = 0; i < Count; i++) {
+        //Each line has to fit in the box
+        TEST_ASSERT_LESS_OR_EQUAL(Box_Width, Paint_MeasureString(Lines[i], Font));
+        PaintCtx_DrawString_EN(&Ctx, 0, i * Font->Height, Lines[i], Font, BLACK, WHITE);
+    }
+    PaintCtx_NewImage(&Ctx, Box, BOX_W, BOX_H, ROTATE_0, WHITE);
+    PaintCtx_Clear(&Ctx, WHITE);
+    return PaintCtx_DrawTextBox(&Ctx, 0, 0, Box_Width, Box_Height, Text, Font, Flags, BLACK, WHITE);
+}
+
+void setUp(void)
+{
+    Latin = Font16P;
+    Latin.Ranges = Latin_Ranges;
+    Latin.RangeCount = sizeof(Latin_Ranges) / sizeof(Latin_Ranges[0]);
+}
+
+void tearDown(void)
+{
+}
+
+void test_utf8_is_decoded(void)
+{
+    Same("\xC3\xA9t\xC3\xA9 72\xC2\xB0", "ete 72\xC2\xB0");
+    Same("\xC3\x80", "A");
+}
+
+void test_stray_continuation_byte_is_latin1(void)
+{
+    Same("72\xB0" "F", "72\xC2\xB0" "F");
+    Same("\xB0", "\xC2\xB0");
+}
+
+void test_truncated_sequence_is_latin1(void)
+{
+    //Latin-1 "été": E9 starts a three byte sequence that is not there
+    Same("\xE9t\xE9", "\xC3\xA9t\xC3\xA9");
+    Same("t\xE9", "te");
+    Same("\xC0", "A");
+    //Two bytes of three: both are single characters, neither in the font
+    Same("\xE2\x82x", "??x");
+}
+
+void test_overlong_and_surrogate_are_latin1(void)
+{
+    //C0 B0 would be an overlong '0'
+    Same("\xC0\xB0", "A\xC2\xB0");
+    //ED A0 80 would be the surrogate U+D800
+    Same("\xED\xA0\x80", "???");
+}
+
+void test_word_wider_than_the_box_is_broken(void)
+{
+    static const char * const Lines[] = {"Thund", "erstor", "ms"};
+    const UWORD Narrow = 40;
+    TEST_ASSERT_TRUE(Paint_MeasureString("Thunde", &Font12P) > Narrow);
+    TEST_ASSERT_EQUAL_INT(3, Draw_Box(Narrow, BOX_H, "Thunderstorms", &Font12P, TEXT_WRAP, Lines, 3));
+    TEST_ASSERT_EQUAL_MEMORY(Box_Expected, Box, sizeof(Box));
+    TEST_ASSERT_EQUAL_INT(3, Paint_MeasureTextBox("Thunderstorms", &Font12P, Narrow, TEXT_WRAP));
+
+    //Words that fit go to the next line whole, lines below the box are dropped
+    static const char * const Words[] = {"Light", "rain", "Thund", "erstor"};
+    TEST_ASSERT_EQUAL_INT(4, Draw_Box(Narrow, BOX_H, "Light rain Thunderstorms", &Font12P, TEXT_WRAP, Words, 4));
+    TEST_ASSERT_EQUAL_MEMORY(Box_Expected, Box, sizeof(Box));
+}
+
+void test_last_line_shown_ends_with_ellipsis(void)
+{
+    //"rain this" would fit, but not with the "..." after it
+    static const char * const Lines[] = {"Light", "rain thi..."};
+    TEST_ASSERT_EQUAL_INT(2, Draw_Box(BOX_W, 2 * Font12P.Height, "Light rain this evening", &Font12P,
+                                      TEXT_WRAP | TEXT_ELLIPSIS, Lines, 2));
+    TEST_ASSERT_EQUAL_MEMORY(Box_Expected, Box, sizeof(Box));
+
+    //Without more text the last line is drawn as it is
+    static const char * const Whole[] = {"Light", "rain"};
+    TEST_ASSERT_EQUAL_INT(2, Draw_Box(BOX_W, 2 * Font12P.Height, "Light rain", &Font12P,
+                                      TEXT_WRAP | TEXT_ELLIPSIS, Whole, 2));
+    TEST_ASSERT_EQUAL_MEMORY(Box_Expected, Box, sizeof(Box));
+
+    //A line cut off at the edge without wrapping
+    static const char * const Cut[] = {"Thu..."};
+    TEST_ASSERT_EQUAL_INT(1, Draw_Box(40, BOX_H, "Thunderstorms", &Font12P, TEXT_ELLIPSIS, Cut, 1));
+    TEST_ASSERT_EQUAL_MEMORY(Box_Expected, Box, sizeof(Box));
+}
+
+void test_missing_glyph_is_the_fallback(void)
+{
+    //Font32N only holds what the temperature needs
+    Same_In(&Font32N, "7X", "7?");
+    Same_In(&Font32N, "-3" FONT_DEGREE "K", "-3" FONT_DEGREE "?");
+    Same_In(&Font32N, "\xE2\x98\x80" "5", "?5");
+
+    sFONT Dash = Font32N;
+    Dash.Fallback = '-';
+    Same_In(&Dash, "7X", "7-");
+    Same_In(&Dash, "\xE2\x98\x80" "5", "-5");
+}
+
+//Text drawn at a factor, against the text at its size with every pixel repeated
+static void Same_Scaled(const char *Text, sFONT *Font, UBYTE Factor)
+{
+    PaintContext Ctx;
+    PaintCtx_NewImage(&Ctx, Image, W, H, ROTATE_0, WHITE);
+    PaintCtx_Clear(&Ctx, WHITE);
+    PaintCtx_DrawString_EN(&Ctx, 0, 0, Text, Font, BLACK, WHITE);
+    memset(Big_Expected, 0xFF, sizeof(Big_Expected));
+    for (UWORD Y = 0; Y < Factor * Font->Height; Y++) {
+        for (UWORD X = 0; X < W; X++) {
+            UWORD Sx = X / Factor, Sy = Y / Factor;
+            if (!((Image[Sy * (W / 8) + Sx / 8] >> (7 - Sx % 8)) & 1))
+                Big_Expected[Y * (W / 8) + X / 8] &= ~(0x80 >> (X % 8));
+        }
+    }
+
+    PaintCtx_NewImage(&Ctx, Big, W, 3 * H, ROTATE_0, WHITE);
+    PaintCtx_Clear(&Ctx, WHITE);
+    PaintCtx_DrawStringScaled(&Ctx, 0, 0, Text, Font, Factor, 0, BLACK, WHITE);
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(Big_Expected, Big, sizeof(Big), Text);
+}
+
+void test_scaled_text_repeats_every_pixel(void)
+{
+    for (UBYTE Factor = 1; Factor <= 3; Factor++) {
+        Same_Scaled("72" FONT_DEGREE "F", &Font16P, Factor);
+        Same_Scaled("Wj 5%", &Font12P, Factor);
+        Same_Scaled("Hi 5", &Font12, Factor);
+        Same_Scaled("-8" FONT_DEGREE, &Font16, Factor);
+    }
+}
+
+//Row below the lowest ink of 'H', or the last row of the line
+static UWORD Underline_Row(sFONT *Font)
+{
+    UWORD Row = 0;
+    PaintContext Ctx;
+    PaintCtx_NewImage(&Ctx, Image, W, H, ROTATE_0, WHITE);
+    PaintCtx_Clear(&Ctx, WHITE);
+    PaintCtx_DrawString_EN(&Ctx, 0, 0, "H", Font, BLACK, WHITE);
+    for (UWORD Y = 0; Y < Font->Height; Y++) {
+        for (UWORD i = 0; i < W / 8; i++) {
+            if (Image[Y * (W / 8) + i] != 0xFF)
+                Row = Y + 1;
+        }
+    }
+    return Row < Font->Height ? Row : Font->Height - 1;
+}
+
+static void Same_Underlined(const char *Text, sFONT *Font)
+{
+    UWORD Row = Underline_Row(Font);
+    UWORD Width = Paint_MeasureString(Text, Font);
+    PaintContext Ctx;
+    PaintCtx_NewImage(&Ctx, Expected, W, H, ROTATE_0, WHITE);
+    PaintCtx_Clear(&Ctx, WHITE);
+    PaintCtx_DrawString_EN(&Ctx, 0, 0, Text, Font, BLACK, WHITE);
+    for (UWORD X = 0; X < Width; X++)
+        Expected[Row * (W / 8) + X / 8] &= ~(0x80 >> (X % 8));
+
+    PaintCtx_NewImage(&Ctx, Image, W, H, ROTATE_0, WHITE);
+    PaintCtx_Clear(&Ctx, WHITE);
+    PaintCtx_DrawStringScaled(&Ctx, 0, 0, Text, Font, 1, TEXT_UNDERLINE, BLACK, WHITE);
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(Expected, Image, sizeof(Image), Text);
+}
+
+void test_underline_is_one_row_under_the_baseline(void)
+{
+    Same_Underlined("Hey, jumpy 42" FONT_DEGREE, &Font16P);
+    Same_Underlined("Hey, jumpy 42" FONT_DEGREE, &Font12P);
+    Same_Underlined("Hey, jumpy 42", &Font16);
+    Same_Underlined("Hey, jumpy 42", &Font12);
+    Same_Underlined("Hey", &Font8);
+}
+
+void test_kerned_pairs_move_closer(void)
+{
+    sFONT Kerned = Font16P;
+    Kerned.Kerning = Kerned_Pairs;
+    Kerned.KernCount = sizeof(Kerned_Pairs) / sizeof(Kerned_Pairs[0]);
+    UWORD A = Paint_MeasureString("A", &Font16P), V = Paint_MeasureString("V", &Font16P);
+    UWORD T = Paint_MeasureString("T", &Font16P);
+
+    PAINT_GLYPH_POS Glyphs[4];
+    PAINT_LAYOUT Layout;
+    PaintLayout_Init(&Layout, Glyphs, 4);
+    TEST_ASSERT_EQUAL_INT(2 * A + V - 4, PaintLayout_String(&Layout, "AVA", &Kerned, 0));
+    TEST_ASSERT_EQUAL_INT(0, Glyphs[0].X);
+    TEST_ASSERT_EQUAL_INT(A - 2, Glyphs[1].X);
+    TEST_ASSERT_EQUAL_INT(A + V - 4, Glyphs[2].X);
+    TEST_ASSERT_EQUAL_INT(2 * A + V - 4, Paint_MeasureString("AVA", &Kerned));
+
+    //Pairs the table does not list keep their advance
+    TEST_ASSERT_EQUAL_INT(Paint_MeasureString("AT oV", &Font16P), Paint_MeasureString("AT oV", &Kerned));
+
+    //"To" is the two glyphs drawn on their own, the 'o' moved left
+    PaintContext Ctx;
+    PaintCtx_NewImage(&Ctx, Expected, W, H, ROTATE_0, WHITE);
+    PaintCtx_Clear(&Ctx, WHITE);
+    PaintCtx_DrawString_EN(&Ctx, 0, 0, "T", &Font16P, BLACK, WHITE);
+    PaintCtx_DrawString_EN(&Ctx, T - 3, 0, "o", &Font16P, BLACK, WHITE);
+    PaintCtx_NewImage(&Ctx, Image, W, H, ROTATE_0, WHITE);
+    PaintCtx_Clear(&Ctx, WHITE);
+    PaintCtx_DrawString_EN(&Ctx, 0, 0, "To", &Kerned, BLACK, WHITE);
+    TEST_ASSERT_EQUAL_MEMORY(Expected, Image, sizeof(Image));
+
+    //Tabular digits are not kerned against each other
+    PaintLayout_String(&Layout, "17", &Kerned, 0);
+    TEST_ASSERT_EQUAL_INT(Paint_MeasureString("1", &Font16P) - 2, Glyphs[1].X);
+    PaintLayout_String(&Layout, "17", &Kerned, TEXT_TABULAR);
+    TEST_ASSERT_EQUAL_INT(Glyphs[0].Width, Glyphs[1].X);
+}
+
+void test_tabular_digits_share_a_cell(void)
+{
+    PAINT_GLYPH_POS Ones[4], Eights[4];
+    PAINT_LAYOUT One, Eight;
+    PaintLayout_Init(&One, Ones, 4);
+    PaintLayout_Init(&Eight, Eights, 4);
+
+    //Without TEXT_TABULAR a '1' of the temperature font is narrower than an '8'
+    TEST_ASSERT_TRUE(PaintLayout_String(&One, "11", &Font32N, 0) < PaintLayout_String(&Eight, "88", &Font32N, 0));
+
+    TEST_ASSERT_EQUAL_INT(PaintLayout_String(&Eight, "88", &Font32N, TEXT_TABULAR),
+                          PaintLayout_String(&One, "11", &Font32N, TEXT_TABULAR));
+    for (UWORD i = 0; i < 2; i++) {
+        TEST_ASSERT_EQUAL_INT(Eights[i].X, Ones[i].X);
+        TEST_ASSERT_EQUAL_INT(Eights[i].Width, Ones[i].Width);
+    }
+
+    //Characters after the digits stay in place as well
+    TEST_ASSERT_EQUAL_INT(PaintLayout_String(&Eight, "88" FONT_DEGREE "F", &Font32N, TEXT_TABULAR),
+                          PaintLayout_String(&One, "11" FONT_DEGREE "F", &Font32N, TEXT_TABULAR));
+    TEST_ASSERT_EQUAL_INT(Eights[3].X, Ones[3].X);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_utf8_is_decoded);
+    RUN_TEST(test_stray_continuation_byte_is_latin1);
+    RUN_TEST(test_truncated_sequence_is_latin1);
+    RUN_TEST(test_overlong_and_surrogate_are_latin1);
+    RUN_TEST(test_word_wider_than_the_box_is_broken);
+    RUN_TEST(test_last_line_shown_ends_with_ellipsis);
+    RUN_TEST(test_missing_glyph_is_the_fallback);
+    RUN_TEST(test_scaled_text_repeats_every_pixel);
+    RUN_TEST(test_underline_is_one_row_under_the_baseline);
+    RUN_TEST(test_kerned_pairs_move_closer);
+    RUN_TEST(test_tabular_digits_share_a_cell);
+    return UNITY_END();
+}
@@ -0,0 +1,72 @@
+/******************************************************************************
+* | File      	:   bench.cpp
+* | Function    :   Host tool: run the benchmarks of the drawing library
+* | Info        :
+*   Build it as the PlatformIO native target:
+*       pio run -e bench && .pio/build/bench/program [NAME...]
+*
+*   Without a name every benchmark is run, in the order of the table
+*   below. The numbers depend on the host; compare runs on the same
+*   machine, e.g. with this directory copied into an older tree.
+******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include "bench.h"
+
+typedef struct {
+    const char *Name;
+    void (*Run)(void);
+    const char *Info;
+} BENCH;
+
+static const BENCH Benches[] =
+{
+    {"render", Bench_Render, "the demo layout rendered in one pass and in two bands on two threads"},
+    {"strips", Bench_Strips, "the demo layout strip by strip, per strip height"},
+    {"sparse", Bench_Sparse, "memory and read-out time of a sparse red plane against a dense one"},
+    {"packed", Bench_Packed, "a packed 2-bit image split into the black and the red plane"},
+    {"dither", Bench_Dither, "gray and RGB rows dithered into the planes, ordered and error diffused"},
+    {"format", Bench_Format, "weather fields and integers formatted by PaintFormat and by snprintf"},
+    {"fonts",  Bench_Fonts,  "flash per font, and a compressed glyph on first use and from the cache"},
+    {"rotate", Bench_Rotate, "ns/char of a string in every rotation, with and without a glyph cache"},
+    {"layout", Bench_Layout, "render and redraw the demo layout, with and without a text-run cache"},
+};
+
+#define BENCH_COUNT (sizeof(Benches) / sizeof(Benches[0]))
+
+double Bench_Now(void)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void Usage()
+{
+    fprintf(stderr, "usage: bench [NAME...]\n");
+    for (size_t i = 0; i < BENCH_COUNT; i++)
+        fprintf(stderr, "    %-10s %s\n", Benches[i].Name, Benches[i].Info);
+}
+
+int main(int argc, char **argv)
+{
+    for (int i = 1; i < argc; i++) {
+        size_t b = 0;
+        while (b < BENCH_COUNT && strcmp(argv[i], Benches[b].Name) != 0)
+            b++;
+        if (b == BENCH_COUNT) {
+            Usage();
+            return 1;
+        }
+    }
+    for (size_t b = 0; b < BENCH_COUNT; b++) {
+        bool Wanted = argc == 1;
+        for (int i = 1; i < argc; i++)
+            Wanted = Wanted || strcmp(argv[i], Benches[b].Name) == 0;
+        if (!Wanted)
+            continue;
+        printf("== %s: %s\n", Benches[b].Name, Benches[b].Info);
+        Benches[b].Run();
+        printf("\n");
+    }
+    return 0;
+}
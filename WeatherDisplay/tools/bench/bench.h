@@ -0,0 +1,48 @@
+/******************************************************************************
+* | File      	:   bench.h
+* | Function    :   Host benchmarks of the drawing library
+* | Info        :
+*   Every benchmark prints its own table to stdout. Times are the best of
+*   BENCH_ROUNDS rounds, as a host timer is noisy.
+******************************************************************************/
+#ifndef __BENCH_H
+#define __BENCH_H
+
+#include "GUI_Frame.h"
+
+#define BENCH_ROUNDS    5
+
+//Monotonic time in seconds
+double Bench_Now(void);
+
+//Best, over BENCH_ROUNDS rounds, of the seconds per Step when it is run
+//Count times in a row
+#define BENCH_BEST(Best, Count, Step)                               \
+    do {                                                            \
+        Best = 1e9;                                                 \
+        for (int r_ = 0; r_ < BENCH_ROUNDS; r_++) {                 \
+            double Start_ = Bench_Now();                            \
+            for (int i_ = 0; i_ < (Count); i_++) { Step; }          \
+            double Time_ = (Bench_Now() - Start_) / (Count);        \
+            if (Time_ < Best)                                       \
+                Best = Time_;                                       \
+        }                                                           \
+    } while (0)
+
+//The weather layout of the demo, Values receives the operations of the
+//three readings that Bench_SetValues changes
+void Bench_RecordLayout(PAINT_FRAME *Frame, PAINT_OP *Ops, UWORD Capacity, UWORD *Values);
+void Bench_SetValues(PAINT_FRAME *Frame, const UWORD *Values, int Reading);
+
+//Benchmarks
+void Bench_Render(void);
+void Bench_Strips(void);
+void Bench_Sparse(void);
+void Bench_Packed(void);
+void Bench_Dither(void);
+void Bench_Format(void);
+void Bench_Fonts(void);
+void Bench_Rotate(void);
+void Bench_Layout(void);
+
+#endif
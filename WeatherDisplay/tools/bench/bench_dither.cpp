@@ -0,0 +1,63 @@
+/******************************************************************************
+* | File      	:   bench_dither.cpp
+* | Function    :   Gray and colour rows dithered into the planes
+* | Info        :
+*   An 800x480 noisy horizontal gradient with a red disc, fed a row at a
+*   time as a decoder would, ordered and error diffused, gray into the
+*   black plane and RGB into both planes of a tri-colour image. The
+*   source is only held whole here, to leave the decoding out of the time.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "GUI_Dither.h"
+#include "bench.h"
+
+#define W   800
+#define H   480
+
+static UBYTE Image[W / 8 * H], Red[W / 8 * H];
+static UBYTE Gray[W * H], Rgb[W * H * 3];
+static int16_t Work[(DITHER_WORK_SIZE(W) + 1) / 2];
+
+void Bench_Dither(void)
+{
+    const int Count = 10;
+    double Best;
+    srand(1);
+    for (int Y = 0; Y < H; Y++) {
+        for (int X = 0; X < W; X++) {
+            int Level = X * 255 / (W - 1) + rand() % 41 - 20;
+            UBYTE *Pixel = Rgb + (Y * W + X) * 3;
+            Level = Level < 0 ? 0 : (Level > 255 ? 255 : Level);
+            Gray[Y * W + X] = Pixel[0] = Pixel[1] = Pixel[2] = Level;
+            if ((X - 600) * (X - 600) + (Y - 240) * (Y - 240) < 80 * 80) {
+                Pixel[0] = 220;
+                Pixel[1] = 30;
+                Pixel[2] = 40;
+            }
+        }
+    }
+
+    printf("                  ms/frame    rows/s\n");
+    for (int Method = DITHER_BAYER; Method <= DITHER_FLOYD_STEINBERG; Method++) {
+        for (int Colour = 0; Colour < 2; Colour++) {
+            PaintContext Ctx;
+            PAINT_DITHER Dither;
+            PaintCtx_NewImage(&Ctx, Image, W, H, ROTATE_0, WHITE);
+            if (Colour)
+                PaintCtx_SetRedImage(&Ctx, Red, NULL);
+            BENCH_BEST(Best, Count,
+                       PaintDither_Init(&Dither, &Ctx, 0, 0, W, H, (DITHER_METHOD)Method, Work);
+                       for (int Y = 0; Y < H; Y++) {
+                           if (Colour)
+                               PaintDither_RGB(&Dither, Rgb + Y * W * 3);
+                           else
+                               PaintDither_Gray(&Dither, Gray + Y * W);
+                       });
+            printf("  %-6s %-5s %10.2f %9.0fk\n", Method == DITHER_BAYER ? "bayer" : "floyd",
+                   Colour ? "rgb" : "gray", Best * 1e3, H / Best / 1e3);
+        }
+    }
+    printf("memory: %u bytes of work area, %u of state, one source row (%u gray, %u rgb)\n",
+           (unsigned)DITHER_WORK_SIZE(W), (unsigned)sizeof(PAINT_DITHER), W, W * 3);
+}
@@ -0,0 +1,104 @@
+/******************************************************************************
+* | File      	:   bench_fonts.cpp
+* | Function    :   Flash taken by the fonts, and the time of a compressed
+*                   glyph on first use and from the glyph cache
+* | Info        :
+*   The flash of a proportional font is its bitmaps, up to the end of the
+*   last glyph, and its glyph index; a monospaced font holds a cell for
+*   every code from ' ' to 0x7F. The temperature readout is then drawn in
+*   the legacy Font32 and in Font32P, without a cache, with a single slot
+*   that every glyph misses and with 16 slots that it hits.
+******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "bench.h"
+
+#define W   800
+#define H   480
+
+static UBYTE Image[W / 8 * H];
+
+//Bytes of a glyph's bitmap in the font table
+static UDOUBLE Bench_GlyphBytes(const sFONT *Font, const sGLYPH *Glyph)
+{
+    if (Font->Encoding != FONT_ENCODING_ROWS)
+        return ((UDOUBLE)Glyph->Width * Glyph->Height + 7) / 8;
+    const UBYTE *Bitmap = Font->table + Glyph->Offset;
+    UDOUBLE Bit = 0;
+    for (UWORD y = 0; y < Glyph->Height; y++) {
+        UBYTE Repeat = Bitmap[Bit / 8] & (0x80 >> (Bit % 8));
+        Bit++;
+        if (!Repeat)
+            Bit += Glyph->Width;
+    }
+    return (Bit + 7) / 8;
+}
+
+//Glyphs in the index of a proportional font
+static UWORD Bench_GlyphCount(const sFONT *Font)
+{
+    UWORD Count = Font->Last - Font->First + 1;
+    if (Font->Map) {
+        Count = 0;
+        for (UWORD i = 0; i <= (UWORD)(Font->Last - Font->First) / 32; i++)
+            Count += __builtin_popcount(Font->Map[i]);
+    }
+    for (UWORD r = 0; r < Font->RangeCount; r++)
+        if (Font->Ranges[r].Index + Font->Ranges[r].Count > Count)
+            Count = Font->Ranges[r].Index + Font->Ranges[r].Count;
+    return Count;
+}
+
+static UDOUBLE Bench_FontBytes(const sFONT *Font)
+{
+    if (Font->Glyphs == NULL)
+        return (UDOUBLE)(0x7F - ' ' + 1) * Font->Height * ((Font->Width + 7) / 8);
+    UWORD Count = Bench_GlyphCount(Font);
+    UDOUBLE End = 0;
+    for (UWORD i = 0; i < Count; i++) {
+        UDOUBLE Glyph_End = Font->Glyphs[i].Offset + Bench_GlyphBytes(Font, &Font->Glyphs[i]);
+        if (Glyph_End > End)
+            End = Glyph_End;
+    }
+    return End + (UDOUBLE)Count * sizeof(sGLYPH);
+}
+
+void Bench_Fonts(void)
+{
+    sFONT *Fonts[] = {&Font8, &Font12, &Font16, &Font20, &Font24, &Font32,
+                      &Font8P, &Font12P, &Font16P, &Font20P, &Font24P, &Font32P, &Font32N};
+    const char *Names[] = {"Font8", "Font12", "Font16", "Font20", "Font24", "Font32",
+                           "Font8P", "Font12P", "Font16P", "Font20P", "Font24P", "Font32P", "Font32N"};
+    UDOUBLE Total[2] = {0, 0};
+    printf("flash bytes, bitmaps and glyph index\n");
+    for (int f = 0; f < 13; f++) {
+        UDOUBLE Bytes = Bench_FontBytes(Fonts[f]);
+        printf("  %-8s %6lu%s\n", Names[f], (unsigned long)Bytes,
+               Fonts[f]->Encoding == FONT_ENCODING_ROWS ? "  rows" : "");
+        if (f < 12)
+            Total[f / 6] += Bytes;
+    }
+    printf("  legacy %lu, proportional %lu\n", (unsigned long)Total[0], (unsigned long)Total[1]);
+
+    static const char Text[] = "72.5" FONT_DEGREE "F";
+    static PAINT_GLYPH_SLOT Slots[16];
+    const char *Modes[] = {"Font32 legacy", "Font32P no cache", "Font32P 1 slot, misses", "Font32P 16 slots, hits"};
+    const UWORD Count = 20000;
+    PAINT_GLYPH_CACHE Cache;
+    PaintContext Ctx;
+    PaintCtx_NewImage(&Ctx, Image, W, H, ROTATE_0, WHITE);
+    PaintCtx_Clear(&Ctx, WHITE);
+    printf("ns/char of \"72.5%sF\"\n", FONT_DEGREE);
+    for (int m = 0; m < 4; m++) {
+        sFONT *Font = m == 0 ? &Font32 : &Font32P;
+        PaintCtx_SetGlyphCache(&Ctx, m >= 2 ? &Cache : NULL);
+        if (m >= 2)
+            PaintGlyphCache_Init(&Cache, Slots, m == 2 ? 1 : 16);
+        double Best;
+        int Line = 0;
+        BENCH_BEST(Best, Count, PaintCtx_DrawString_EN(&Ctx, 10 + (Line % 8) * 80, (Line / 8 % 14) * 33, Text,
+                                                       Font, BLACK, WHITE);
+                   Line++);
+        printf("  %-24s %6.0f\n", Modes[m], Best * 1e9 / 6);
+    }
+}
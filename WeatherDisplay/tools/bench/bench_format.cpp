@@ -0,0 +1,82 @@
+/******************************************************************************
+* | File      	:   bench_format.cpp
+* | Function    :   Weather fields and integers formatted by PaintFormat
+*                   against snprintf
+* | Info        :
+*   The three fields of a weather line, "-12.3°F", "Humidity: 45%" and
+*   "29.92 inHg", and plain integers, over 256 readings in turn. Both
+*   write the same strings.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "GUI_Format.h"
+#include "bench.h"
+
+#define READINGS    256
+
+static int32_t Readings[READINGS];
+static char Temp[2][32], Humidity[2][32], Pressure[2][32], Number[2][32];
+
+static void Bench_FormatFields(int Reading)
+{
+    PAINT_FORMAT Fmt;
+    int32_t Value = Readings[Reading % READINGS];
+    PaintFormat_Init(&Fmt, Temp[0], sizeof(Temp[0]));
+    PaintFormat_Value(&Fmt, Value, 1, 1, UNIT_FAHRENHEIT);
+    PaintFormat_Init(&Fmt, Humidity[0], sizeof(Humidity[0]));
+    PaintFormat_Str(&Fmt, "Humidity: ");
+    PaintFormat_Value(&Fmt, Value & 63, 0, 0, UNIT_PERCENT);
+    PaintFormat_Init(&Fmt, Pressure[0], sizeof(Pressure[0]));
+    PaintFormat_Value(&Fmt, 2900 + (Value & 127), 2, 2, UNIT_INHG);
+}
+
+static void Bench_PrintFields(int Reading)
+{
+    int32_t Value = Readings[Reading % READINGS];
+    snprintf(Temp[1], sizeof(Temp[1]), "%s%d.%d" FONT_DEGREE "F", Value < 0 ? "-" : "",
+             (int)(abs(Value) / 10), (int)(abs(Value) % 10));
+    snprintf(Humidity[1], sizeof(Humidity[1]), "Humidity: %d%%", (int)(Value & 63));
+    snprintf(Pressure[1], sizeof(Pressure[1]), "%d.%02d inHg", (int)((2900 + (Value & 127)) / 100),
+             (int)((2900 + (Value & 127)) % 100));
+}
+
+void Bench_Format(void)
+{
+    const int Count = 200000;
+    double Best[2];
+    srand(1);
+    for (int i = 0; i < READINGS; i++)
+        Readings[i] = rand() % 2000 - 1000;
+
+    int Reading = 0;
+    BENCH_BEST(Best[0], Count, Bench_FormatFields(Reading++));
+    BENCH_BEST(Best[1], Count, Bench_PrintFields(Reading++));
+    printf("ns          PaintFormat  snprintf\n");
+    printf("  field      %8.1f %9.1f\n", Best[0] / 3 * 1e9, Best[1] / 3 * 1e9);
+    for (int i = 0; i < READINGS; i++) {
+        Bench_FormatFields(i);
+        Bench_PrintFields(i);
+        if (strcmp(Temp[0], Temp[1]) || strcmp(Humidity[0], Humidity[1]) || strcmp(Pressure[0], Pressure[1])) {
+            printf("  the fields differ: %s %s %s\n", Temp[0], Humidity[0], Pressure[0]);
+            break;
+        }
+    }
+
+    PAINT_FORMAT Fmt;
+    BENCH_BEST(Best[0], Count,
+               PaintFormat_Init(&Fmt, Number[0], sizeof(Number[0]));
+               PaintFormat_Int(&Fmt, Readings[Reading++ % READINGS] * 100003));
+    BENCH_BEST(Best[1], Count,
+               snprintf(Number[1], sizeof(Number[1]), "%d", (int)(Readings[Reading++ % READINGS] * 100003)));
+    printf("  int        %8.1f %9.1f\n", Best[0] * 1e9, Best[1] * 1e9);
+    for (int i = 0; i < READINGS; i++) {
+        PaintFormat_Init(&Fmt, Number[0], sizeof(Number[0]));
+        PaintFormat_Int(&Fmt, Readings[i] * 100003);
+        snprintf(Number[1], sizeof(Number[1]), "%d", (int)(Readings[i] * 100003));
+        if (strcmp(Number[0], Number[1])) {
+            printf("  the integers differ: %s %s\n", Number[0], Number[1]);
+            break;
+        }
+    }
+}
@@ -0,0 +1,156 @@
+/******************************************************************************
+* | File      	:   bench_layout.cpp
+* | Function    :   The weather layout of the demo, recorded into a frame,
+*                   drawn and redrawn with and without a text-run cache
+* | Info        :
+*   The image is set up as in the demo: a dense black plane, a sparse red
+*   plane, a 12-slot glyph cache and, when cached, 32 runs in a 6 KB pool.
+*   A value update changes the three readings and redraws what they touch.
+*   The readings either go round 4 values, which then stay in the cache, or
+*   are new every time, so that the cache never takes them in.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "GUI_Frame.h"
+#include "GUI_Format.h"
+#include "bench.h"
+
+#define W   800
+#define H   480
+
+static UBYTE Image[W / 8 * H], Strip[W / 8 * 48];
+static UBYTE Rendered[2][W / 8 * H], Updated[2][W / 8 * H], Stripped[2][W / 8 * H];
+static UWORD RedRowHead[H];
+static PAINT_RUN RedRuns[512];
+static PAINT_SPARSE RedPlane;
+static PAINT_GLYPH_SLOT GlyphSlots[12];
+static PAINT_GLYPH_CACHE GlyphCache;
+static PAINT_TEXT_RUN TextRuns[32];
+static UDOUBLE TextPool[1536];
+static PAINT_TEXT_CACHE TextCache;
+static PAINT_OP LayoutOps[48];
+
+void Bench_RecordLayout(PAINT_FRAME *Frame, PAINT_OP *Ops, UWORD Capacity, UWORD *Values)
+{
+    static const char *Days[] = {"Monday", "Tuesday", "Wednesday", "Thursday", "Friday"};
+    static const char *Forecasts[] = {"Sunny", "Partly cloudy", "Chance of rain showers",
+                                      "Thunderstorms likely in the afternoon", "Clear and cold"};
+    const int Margin = 20, Split = W / 4;
+    PaintFrame_Init(Frame, Ops, Capacity);
+    PaintFrame_DrawRectangle(Frame, Margin, Margin, Split, H - Margin, BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+    PaintFrame_DrawRectangle(Frame, Split + Margin, Margin, W - Margin, H - Margin, BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+    int Xstart = Split + Margin, Day_Width = (W - Margin - Xstart) / 5;
+    for (int i = 0; i < 5; i++) {
+        int X1 = Xstart + i * Day_Width, X2 = X1 + Day_Width;
+        int Y = Margin + 5 + Font16.Height + 8;
+        PaintFrame_DrawRectangle(Frame, X1, Margin, X2, H - Margin, BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+        PaintFrame_DrawTextBox(Frame, X1, Margin + 5, X2, Margin + 5 + Font16.Height, Days[i], &Font16,
+                               TEXT_CENTER, BLACK, WHITE);
+        PaintFrame_DrawTextBox(Frame, X1 + 6, Y, X2 - 6, Y + 3 * Font12.Height, Forecasts[i], &Font12,
+                               TEXT_CENTER | TEXT_WRAP | TEXT_ELLIPSIS, i == 4 ? RED : BLACK, WHITE);
+    }
+    PaintFrame_DrawString_EN(Frame, 10 + Margin, 10 + Margin, "Local Weather", &Font16P, BLACK, WHITE);
+    PaintFrame_DrawString_EN(Frame, 10 + Margin, 30 + Margin, "10/19/2026 00:00:00", &Font12, BLACK, WHITE);
+    Values[0] = PaintFrame_DrawStringScaled(Frame, 10 + Margin, 60 + Margin, "55\xC2\xB0" "F", &Font32N, 2,
+                                            TEXT_SMOOTH | TEXT_TABULAR, BLACK, WHITE);
+    Values[1] = PaintFrame_DrawString_EN(Frame, 10 + Margin, 135 + Margin, "Humidity: 45%", &Font12, BLACK, WHITE);
+    Values[2] = PaintFrame_DrawString_EN(Frame, 10 + Margin, 155 + Margin, "Pressure: 5 mb", &Font12, BLACK, WHITE);
+}
+
+void Bench_SetValues(PAINT_FRAME *Frame, const UWORD *Values, int Reading)
+{
+    char Temp[10], Humidity[20], Pressure[20];
+    PAINT_FORMAT Format;
+    PaintFormat_Init(&Format, Temp, sizeof(Temp));
+    PaintFormat_Value(&Format, 55 + Reading, 0, 0, UNIT_FAHRENHEIT);
+    PaintFormat_Init(&Format, Humidity, sizeof(Humidity));
+    PaintFormat_Str(&Format, "Humidity: ");
+    PaintFormat_Value(&Format, 45 + Reading, 0, 0, UNIT_PERCENT);
+    PaintFormat_Init(&Format, Pressure, sizeof(Pressure));
+    PaintFormat_Str(&Format, "Pressure: ");
+    PaintFormat_Value(&Format, 5 + Reading, 0, 0, UNIT_MBAR);
+    PaintFrame_SetString(Frame, Values[0], Temp);
+    PaintFrame_SetString(Frame, Values[1], Humidity);
+    PaintFrame_SetString(Frame, Values[2], Pressure);
+}
+
+static void Bench_Sink(const UBYTE *Rows, UWORD Ystart, UWORD Yend, void *Arg)
+{
+    memcpy((UBYTE *)Arg + (UDOUBLE)Ystart * (W / 8), Rows, (UDOUBLE)(Yend - Ystart) * (W / 8));
+}
+
+static void Bench_ResetCounters(void)
+{
+    TextCache.Hits = TextCache.Misses = TextCache.Evictions = TextCache.Bypassed =
+        TextCache.Declined = 0;
+}
+
+static void Bench_PrintCounters(void)
+{
+    unsigned long Lookups = TextCache.Hits + TextCache.Misses;
+    printf("      %.1f%% hits (%lu of %lu), %lu declined, %lu evictions, %lu bypassed, peak %lu of %lu bytes\n",
+           Lookups ? 100.0 * TextCache.Hits / Lookups : 0.0, (unsigned long)TextCache.Hits, Lookups,
+           (unsigned long)TextCache.Declined, (unsigned long)TextCache.Evictions, (unsigned long)TextCache.Bypassed,
+           (unsigned long)TextCache.PeakBytes, (unsigned long)TextCache.PoolWords * 4);
+}
+
+void Bench_Layout(void)
+{
+    const int Count = 100;
+    const int Cycles[] = {4, 1000};
+    for (int c = 0; c < 2; c++) {
+        int Cycle = Cycles[c];
+        printf("%s\n", c ? "every reading new" : "4 readings in turn");
+        for (int Cached = 0; Cached < 2; Cached++) {
+            PAINT_FRAME Frame;
+            UWORD Values[3];
+            PaintContext Ctx;
+            double Best;
+            int Reading = 0;
+            Bench_RecordLayout(&Frame, LayoutOps, 48, Values);
+            PaintCtx_NewImage(&Ctx, Image, W, H, ROTATE_0, WHITE);
+            PaintSparse_Init(&RedPlane, RedRowHead, RedRuns, 512);
+            PaintCtx_SetRedImage(&Ctx, NULL, &RedPlane);
+            PaintGlyphCache_Init(&GlyphCache, GlyphSlots, 12);
+            PaintCtx_SetGlyphCache(&Ctx, &GlyphCache);
+            PaintTextCache_Init(&TextCache, TextRuns, 32, TextPool, sizeof(TextPool));
+            if (Cached)
+                PaintCtx_SetTextCache(&Ctx, &TextCache);
+            printf("  %s\n", Cached ? "text-run cache, 32 runs in 6 KB" : "glyph by glyph");
+
+            BENCH_BEST(Best, Count, PaintCtx_Clear(&Ctx, WHITE); PaintFrame_Render(&Frame, &Ctx));
+            PaintCtx_ReadRows(&Ctx, 0, H, Rendered[Cached]);
+            printf("    full render    %7.1f us\n", Best * 1e6);
+            if (Cached)
+                Bench_PrintCounters();
+
+            Bench_ResetCounters();
+            BENCH_BEST(Best, Count, Bench_SetValues(&Frame, Values, Reading++ % Cycle);
+                       PaintFrame_Redraw(&Frame, &Ctx, NULL));
+            PaintCtx_ReadRows(&Ctx, 0, H, Updated[Cached]);
+            printf("    value update   %7.1f us\n", Best * 1e6);
+            if (Cached)
+                Bench_PrintCounters();
+
+            //The black plane in strips, through a context without storage
+            PaintContext Strips;
+            PaintCtx_NewImage(&Strips, NULL, W, H, ROTATE_0, WHITE);
+            PaintCtx_SetRedImage(&Strips, NULL, NULL);
+            PaintCtx_SetGlyphCache(&Strips, &GlyphCache);
+            if (Cached)
+                PaintCtx_SetTextCache(&Strips, &TextCache);
+            Bench_ResetCounters();
+            BENCH_BEST(Best, Count, PaintFrame_RenderStrips(&Frame, &Strips, Strip, 48, 0, Bench_Sink,
+                                                            Stripped[Cached]));
+            printf("    48-row strips  %7.1f us\n", Best * 1e6);
+            if (Cached)
+                Bench_PrintCounters();
+            free(RedPlane.Dense);
+        }
+        if (memcmp(Rendered[0], Rendered[1], sizeof(Rendered[0])) ||
+            memcmp(Updated[0], Updated[1], sizeof(Updated[0])) ||
+            memcmp(Stripped[0], Stripped[1], sizeof(Stripped[0])))
+            printf("  the cache changed the output\n");
+    }
+}
@@ -0,0 +1,60 @@
+/******************************************************************************
+* | File      	:   bench_packed.cpp
+* | Function    :   Splitting a packed 2-bit tri-colour image into the two
+*                   planes the panel takes
+* | Info        :
+*   The whole 800x480 image, row by row as the demo sends it, through
+*   ReadRows and ReadRedRows against a loop that tests every pixel.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+
+#define W   800
+#define H   480
+
+static UBYTE Packed[W / 4 * H];
+static UBYTE Planes[2][W / 8 * H], Expected[2][W / 8 * H];
+
+//One plane of a packed row, a pixel at a time
+static void Bench_SplitPixels(const UBYTE *Row, UBYTE Red, UBYTE *Plane)
+{
+    UBYTE Code = Red ? PACKED_RED : PACKED_BLACK;
+    for (UWORD X = 0; X < W; X++) {
+        if (X % 8 == 0)
+            Plane[X / 8] = 0xFF;
+        if (((Row[X / 4] >> (6 - X % 4 * 2)) & 0x03) == Code)
+            Plane[X / 8] &= ~(0x80 >> (X % 8));
+    }
+}
+
+void Bench_Packed(void)
+{
+    const int Count = 20;
+    double Best;
+    srand(1);
+    for (UDOUBLE i = 0; i < sizeof(Packed); i++)
+        Packed[i] = rand();
+
+    PaintContext Ctx;
+    PaintCtx_NewImage(&Ctx, Packed, W, H, ROTATE_0, WHITE);
+    PaintCtx_SetScale(&Ctx, 4);
+    PaintCtx_SetRedImage(&Ctx, NULL, NULL);
+
+    printf("both planes of %u packed bytes\n", (unsigned)sizeof(Packed));
+    BENCH_BEST(Best, Count,
+               for (UWORD Y = 0; Y < H; Y++) {
+                   PaintCtx_ReadRows(&Ctx, Y, 1, Planes[0] + (UDOUBLE)Y * (W / 8));
+                   PaintCtx_ReadRedRows(&Ctx, Y, 1, Planes[1] + (UDOUBLE)Y * (W / 8));
+               });
+    printf("  ReadRows      %7.0f us  %5.0f MB/s\n", Best * 1e6, sizeof(Packed) / Best / 1e6);
+    BENCH_BEST(Best, Count,
+               for (UWORD Y = 0; Y < H; Y++) {
+                   Bench_SplitPixels(Packed + (UDOUBLE)Y * (W / 4), 0, Expected[0] + (UDOUBLE)Y * (W / 8));
+                   Bench_SplitPixels(Packed + (UDOUBLE)Y * (W / 4), 1, Expected[1] + (UDOUBLE)Y * (W / 8));
+               });
+    printf("  per pixel     %7.0f us  %5.0f MB/s\n", Best * 1e6, sizeof(Packed) / Best / 1e6);
+    if (memcmp(Planes, Expected, sizeof(Planes)))
+        printf("  the planes differ\n");
+}
@@ -0,0 +1,65 @@
+/******************************************************************************
+* | File      	:   bench_render.cpp
+* | Function    :   A frame rendered in one pass against two bands on two
+*                   threads
+* | Info        :
+*   The demo layout, into an 800x480 image with only a black plane, with a
+*   dense red plane and with the sparse red plane of the demo. Each render
+*   starts from a cleared image. The parallel render only gains on a host
+*   with a second core free; its thread start is part of the time, as the
+*   band task's is on the ESP32.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include "bench.h"
+
+#define W   800
+#define H   480
+
+static UBYTE Image[W / 8 * H], Red[W / 8 * H];
+static UBYTE Black_Out[2][W / 8 * H], Red_Out[2][W / 8 * H];
+static UWORD RedRowHead[H];
+static PAINT_RUN RedRuns[512];
+static PAINT_SPARSE RedPlane;
+static PAINT_OP LayoutOps[48];
+
+void Bench_Render(void)
+{
+    static const char *Planes[] = {"black only", "dense red", "sparse red"};
+    const int Count = 100;
+    PAINT_FRAME Frame;
+    UWORD Values[3];
+    Bench_RecordLayout(&Frame, LayoutOps, 48, Values);
+
+    printf("%u hardware threads\n", std::thread::hardware_concurrency());
+    printf("us             one pass  two bands\n");
+    for (int p = 0; p < 3; p++) {
+        double Best[2];
+        for (int Parallel = 0; Parallel < 2; Parallel++) {
+            PaintContext Ctx;
+            PaintCtx_NewImage(&Ctx, Image, W, H, ROTATE_0, WHITE);
+            if (p == 1)
+                PaintCtx_SetRedImage(&Ctx, Red, NULL);
+            if (p == 2) {
+                PaintSparse_Init(&RedPlane, RedRowHead, RedRuns, 512);
+                PaintCtx_SetRedImage(&Ctx, NULL, &RedPlane);
+            }
+            if (Parallel)
+                BENCH_BEST(Best[1], Count, PaintCtx_Clear(&Ctx, WHITE); PaintFrame_RenderParallel(&Frame, &Ctx));
+            else
+                BENCH_BEST(Best[0], Count, PaintCtx_Clear(&Ctx, WHITE); PaintFrame_Render(&Frame, &Ctx));
+            PaintCtx_ReadRows(&Ctx, 0, H, Black_Out[Parallel]);
+            PaintCtx_ReadRedRows(&Ctx, 0, H, Red_Out[Parallel]);
+            if (p == 2) {
+                free(RedPlane.Dense);
+                RedPlane.Dense = NULL;
+            }
+        }
+        printf("  %-12s %8.1f %10.1f\n", Planes[p], Best[0] * 1e6, Best[1] * 1e6);
+        if (memcmp(Black_Out[0], Black_Out[1], sizeof(Black_Out[0])) ||
+            memcmp(Red_Out[0], Red_Out[1], sizeof(Red_Out[0])))
+            printf("  the two bands drew a different image\n");
+    }
+}
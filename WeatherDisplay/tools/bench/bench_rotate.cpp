@@ -0,0 +1,49 @@
+/******************************************************************************
+* | File      	:   bench_rotate.cpp
+* | Function    :   Text in every rotation: glyph cells are transposed and
+*                   blitted a column at a time in ROTATE_90 and ROTATE_270
+* | Info        :
+*   One line of the weather readout drawn over and over into an 800x480
+*   one-bit image, in a monospaced, a proportional and a compressed font.
+******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "bench.h"
+
+#define W   800
+#define H   480
+
+static UBYTE Image[W / 8 * H];
+
+void Bench_Rotate(void)
+{
+    static const char Text[] = "Humidity 49% Pressure 1013 mb";
+    sFONT *Fonts[] = {&Font16, &Font24P, &Font32P};
+    const char *Names[] = {"Font16", "Font24P", "Font32P"};
+    static PAINT_GLYPH_SLOT Slots[16];
+    PAINT_GLYPH_CACHE Cache;
+    const int Count = 2000;
+
+    printf("ns/char       rot0   rot90  rot180  rot270\n");
+    for (int Cached = 0; Cached < 2; Cached++) {
+        printf("%s\n", Cached ? "16-slot glyph cache" : "no cache");
+        for (int f = 0; f < 3; f++) {
+            printf("  %-8s", Names[f]);
+            for (UWORD Rotate = ROTATE_0; Rotate <= ROTATE_270; Rotate += 90) {
+                PaintContext Ctx;
+                PaintCtx_NewImage(&Ctx, Image, W, H, Rotate, WHITE);
+                PaintCtx_Clear(&Ctx, WHITE);
+                if (Cached) {
+                    PaintGlyphCache_Init(&Cache, Slots, 16);
+                    PaintCtx_SetGlyphCache(&Ctx, &Cache);
+                }
+                double Best;
+                int Line = 0;
+                BENCH_BEST(Best, Count, PaintCtx_DrawString_EN(&Ctx, 10, 10 + (Line++ % 8) * 40, Text,
+                                                               Fonts[f], BLACK, WHITE));
+                printf(" %7.0f", Best * 1e9 / strlen(Text));
+            }
+            printf("\n");
+        }
+    }
+}
@@ -0,0 +1,65 @@
+/******************************************************************************
+* | File      	:   bench_sparse.cpp
+* | Function    :   A sparse run-length plane against a dense one: memory,
+*                   and the time to read every row out for the panel
+* | Info        :
+*   The red plane of the demo, 800x480 with the demo's 512-run pool, empty,
+*   with a line of red text and with a red frame around the whole image,
+*   which needs more runs than the pool holds and turns the plane dense.
+*   Each scene is drawn into both planes and the rows read out must match.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+
+#define W       800
+#define H       480
+#define RUNS    512
+
+static UBYTE Image[W / 8 * H];
+static UBYTE Out[2][W / 8 * H];
+static UWORD RowHead[H];
+static PAINT_RUN Runs[RUNS];
+
+static void Bench_DrawScene(PaintContext *Ctx, int Scene)
+{
+    PaintCtx_Clear(Ctx, WHITE);
+    if (Scene == 1)
+        PaintCtx_DrawString_EN(Ctx, 240, 200, "Thunderstorms likely in the afternoon", &Font12, BLACK, WHITE);
+    if (Scene == 2)
+        PaintCtx_DrawRectangle(Ctx, 20, 20, W - 20, H - 20, BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+}
+
+void Bench_Sparse(void)
+{
+    static const char *Scenes[] = {"empty", "a line of text", "a frame"};
+    const int Count = 200;
+    double Best[2];
+
+    printf("a dense plane takes %u bytes\n", (unsigned)sizeof(Image));
+    printf("                    runs   bytes   send us   dense send us\n");
+    for (int Scene = 0; Scene < 3; Scene++) {
+        PAINT_SPARSE Sparse;
+        PaintContext Ctx;
+        PaintSparse_Init(&Sparse, RowHead, Runs, RUNS);
+        PaintCtx_NewSparseImage(&Ctx, &Sparse, W, H, ROTATE_0, WHITE);
+        Bench_DrawScene(&Ctx, Scene);
+        BENCH_BEST(Best[0], Count, PaintCtx_ReadRows(&Ctx, 0, H, Out[0]));
+        UDOUBLE Bytes = sizeof(RowHead) + sizeof(Runs) + (Sparse.Dense ? sizeof(Image) : 0);
+        UWORD Used = Sparse.Count;
+        UBYTE Dense = Sparse.Dense != NULL;
+        free(Sparse.Dense);
+
+        PaintCtx_NewImage(&Ctx, Image, W, H, ROTATE_0, WHITE);
+        Bench_DrawScene(&Ctx, Scene);
+        BENCH_BEST(Best[1], Count, PaintCtx_ReadRows(&Ctx, 0, H, Out[1]));
+        if (Dense)
+            printf("  %-15s  dense", Scenes[Scene]);
+        else
+            printf("  %-15s %6u", Scenes[Scene], Used);
+        printf(" %7lu %9.1f %15.1f\n", (unsigned long)Bytes, Best[0] * 1e6, Best[1] * 1e6);
+        if (memcmp(Out[0], Out[1], sizeof(Out[0])))
+            printf("  the sparse plane reads out different rows\n");
+    }
+}
@@ -0,0 +1,59 @@
+/******************************************************************************
+* | File      	:   bench_strips.cpp
+* | Function    :   A frame rendered strip by strip against full planes
+* | Info        :
+*   Both planes of the demo layout, as PaintFrame_RenderStrips sends them
+*   to the panel, for several strip heights. The strip buffer is the only
+*   memory the image takes, the library allocates nothing while rendering
+*   strips; full planes take two buffers of 48000 bytes.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+
+#define W   800
+#define H   480
+
+static UBYTE Full[2][W / 8 * H], Stripped[2][W / 8 * H];
+static PAINT_OP LayoutOps[48];
+
+static void Bench_Collect(const UBYTE *Rows, UWORD Ystart, UWORD Yend, void *Arg)
+{
+    memcpy((UBYTE *)Arg + (UDOUBLE)Ystart * (W / 8), Rows, (UDOUBLE)(Yend - Ystart) * (W / 8));
+}
+
+void Bench_Strips(void)
+{
+    static const UWORD Heights[] = {8, 16, 32, 64, 120, 480};
+    const int Count = 100;
+    PAINT_FRAME Frame;
+    UWORD Values[3];
+    double Best;
+    Bench_RecordLayout(&Frame, LayoutOps, 48, Values);
+
+    //Full planes
+    PaintContext Ctx;
+    PaintCtx_NewImage(&Ctx, Full[0], W, H, ROTATE_0, WHITE);
+    PaintCtx_SetRedImage(&Ctx, Full[1], NULL);
+    BENCH_BEST(Best, Count, PaintCtx_Clear(&Ctx, WHITE); PaintFrame_Render(&Frame, &Ctx));
+    printf("rows     bytes      us\n");
+    printf("  full %7u %7.1f\n", (unsigned)sizeof(Full), Best * 1e6);
+
+    PaintContext Strips;
+    PaintCtx_NewImage(&Strips, NULL, W, H, ROTATE_0, WHITE);
+    PaintCtx_SetRedImage(&Strips, NULL, NULL);
+    for (UWORD h = 0; h < sizeof(Heights) / sizeof(Heights[0]); h++) {
+        UDOUBLE Bytes = (UDOUBLE)Heights[h] * (W / 8);
+        UBYTE *Strip = (UBYTE *)malloc(Bytes);
+        if (Strip == NULL)
+            return;
+        BENCH_BEST(Best, Count,
+                   PaintFrame_RenderStrips(&Frame, &Strips, Strip, Heights[h], 0, Bench_Collect, Stripped[0]);
+                   PaintFrame_RenderStrips(&Frame, &Strips, Strip, Heights[h], 1, Bench_Collect, Stripped[1]));
+        printf("  %4u %7lu %7.1f\n", Heights[h], (unsigned long)Bytes, Best * 1e6);
+        if (memcmp(Full, Stripped, sizeof(Full)))
+            printf("  the strips differ from the full planes\n");
+        free(Strip);
+    }
+}
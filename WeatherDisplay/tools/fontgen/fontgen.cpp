@@ -0,0 +1,911 @@
+/******************************************************************************
+* | File      	:   fontgen.cpp
+* | Function    :   Host tool: turn a BDF or TTF font, or one of the
+*                   monospaced tables in lib/Fonts, into a font source file
+* | Info        :
+*   Build it as the PlatformIO native target (pio run -e fontgen, or
+*   -e fontgen_ttf to read TTF/OTF through FreeType), or directly:
+*       g++ -std=c++17 -O2 fontgen.cpp -o fontgen
+*       g++ -std=c++17 -O2 -DFONTGEN_FREETYPE fontgen.cpp -o fontgen \
+*           $(pkg-config --cflags --libs freetype2)
+*
+*   Usage: fontgen [options] SOURCE
+*       -n NAME     sFONT variable, e.g. Font32P (default from -o)
+*       -o FILE     Output .cpp (default stdout)
+*       -s PIXELS   Pixel size of a TTF/OTF source
+*       -c CODES    Code points to include, e.g. 32-126,127=176,0x2190-0x2199:
+*                   code 127 takes the glyph of U+00B0. Default
+*                   32-126,127=176,176, or 32-127,176=127 for a table
+*                   source, whose glyph 127 is the degree sign.
+*                   Codes up to 127 are indexed directly, with a Map when
+*                   there are gaps; higher ones go into sorted Ranges.
+*       -f CODE     Glyph drawn for characters the font lacks, default '?'
+*                   when the font has it
+*       -e BITS|ROWS|AUTO
+*                   Bitmap encoding, FONT_ENCODING_BITS (default) or
+*                   FONT_ENCODING_ROWS, for glyphs up to 32 x 32; AUTO
+*                   takes the smaller one that fits
+*       -m          Monospaced output in the legacy format, every glyph a
+*                   padded cell as wide as the widest advance, codes 32
+*                   to 127 only
+*       -k          Kerning pairs, see sKERN in fonts.h: from the kern
+*                   table of a TTF/OTF source, or else measured on the
+*                   bitmaps of the characters up to 127
+*
+*   A table source has no metrics: glyphs are cut to their ink and spaced
+*   by Height / 12 pixels, a space is half the cell. BDF and TTF glyphs
+*   keep their own bearings and advances; a negative left bearing is
+*   moved to 0, as sGLYPH cannot hold it.
+*   Measured kerning moves two characters together where their facing
+*   edges are further apart than the normal spacing on every row they
+*   share, by at most Height / 8 pixels.
+*   The output only depends on the source and the options, so a font
+*   change shows up as a reviewable diff of the generated file.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <map>
+
+#ifdef FONTGEN_FREETYPE
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#endif
+
+/**
+ * Glyph as read from the source, one string per row, '#' for ink
+**/
+struct Glyph {
+    bool Present = false;
+    int Width = 0;
+    int Height = 0;
+    int Left = 0;       //From the pen
+    int Top = 0;        //From the top of the line
+    int Advance = 0;
+    std::vector<std::string> Rows;
+};
+
+struct Source {
+    std::string Description;    //For the file comment
+    bool Table = false;         //Monospaced table without metrics
+    int Height = 0;             //Line height
+    int Cell = 0;               //Cell width of a table
+    std::map<long, Glyph> Glyphs;
+    std::map<std::pair<long, long>, int> Kerning;  //By source code points, from a kern table
+};
+
+static void Fail(const char *Message, const char *Detail = "")
+{
+    fprintf(stderr, "fontgen: %s%s\n", Message, Detail);
+    exit(1);
+}
+
+static std::string ReadFile(const char *Path)
+{
+    FILE *f = fopen(Path, "rb");
+    if (!f)
+        Fail("cannot read ", Path);
+    std::string Data;
+    char Buf[4096];
+    size_t n;
+    while ((n = fread(Buf, 1, sizeof(Buf), f)) > 0)
+        Data.append(Buf, n);
+    fclose(f);
+    return Data;
+}
+
+static std::string BaseName(const std::string &Path)
+{
+    size_t Slash = Path.find_last_of("/\\");
+    return Slash == std::string::npos ? Path : Path.substr(Slash + 1);
+}
+
+static bool EndsWith(const std::string &s, const char *Suffix)
+{
+    size_t n = strlen(Suffix);
+    if (s.size() < n)
+        return false;
+    for (size_t i = 0; i < n; i++)
+        if (tolower((unsigned char)s[s.size() - n + i]) != Suffix[i])
+            return false;
+    return true;
+}
+
+//Round half to even, as the first fonts were made with
+static int RoundEven(double Value)
+{
+    return (int)nearbyint(Value);
+}
+
+/******************************************************************************
+function: Read a monospaced table from lib/Fonts, e.g. font24.cpp
+info:
+    The hex bytes of the first *_Table array, then Width and Height from
+    the sFONT initializer; glyphs are numbered from ' '.
+******************************************************************************/
+static std::string StripComments(const std::string &s)
+{
+    std::string Out;
+    for (size_t i = 0; i < s.size(); i++) {
+        if (s.compare(i, 2, "//") == 0) {
+            while (i < s.size() && s[i] != '\n')
+                i++;
+        } else if (s.compare(i, 2, "/*") == 0) {
+            size_t End = s.find("*/", i + 2);
+            i = End == std::string::npos ? s.size() : End + 1;
+            continue;
+        }
+        if (i < s.size())
+            Out += s[i];
+    }
+    return Out;
+}
+
+static void LoadTable(const char *Path, Source *Src)
+{
+    std::string Text = StripComments(ReadFile(Path));
+    size_t Table = Text.find("_Table");
+    size_t Open = Text.find('{', Table);
+    size_t Close = Text.find("};", Open);
+    size_t Font = Text.find("sFONT", Close);
+    size_t Init = Text.find('{', Font);
+    if (Table == std::string::npos || Open == std::string::npos || Close == std::string::npos ||
+        Font == std::string::npos || Init == std::string::npos)
+        Fail("no font table in ", Path);
+
+    std::vector<unsigned char> Data;
+    for (size_t i = Open; i < Close; i++) {
+        if (Text.compare(i, 2, "0x") == 0 || Text.compare(i, 2, "0X") == 0) {
+            char *End;
+            Data.push_back((unsigned char)strtoul(Text.c_str() + i, &End, 16));
+            i = End - Text.c_str() - 1;
+        }
+    }
+    int Width = 0, Height = 0;
+    if (sscanf(Text.c_str() + Text.find(',', Init) + 1, "%d , %d", &Width, &Height) != 2 || Width <= 0 || Height <= 0)
+        Fail("no Width and Height in ", Path);
+
+    int Row_Bytes = (Width + 7) / 8;
+    int Count = Data.size() / (Row_Bytes * Height);
+    Src->Table = true;
+    Src->Height = Height;
+    Src->Cell = Width;
+    for (int g = 0; g < Count; g++) {
+        Glyph &G = Src->Glyphs[' ' + g];
+        G.Present = true;
+        G.Width = Width;
+        G.Height = Height;
+        G.Advance = Width;
+        for (int y = 0; y < Height; y++) {
+            std::string Row;
+            for (int x = 0; x < Width; x++)
+                Row += (Data[(g * Height + y) * Row_Bytes + x / 8] >> (7 - x % 8)) & 1 ? '#' : ' ';
+            G.Rows.push_back(Row);
+        }
+    }
+}
+
+/******************************************************************************
+function: Read a BDF bitmap font
+******************************************************************************/
+static void LoadBDF(const char *Path, Source *Src)
+{
+    std::string Text = ReadFile(Path);
+    int Ascent = 0, Descent = 0;
+    long Code = -1;
+    Glyph G;
+    int Xoff = 0, Yoff = 0;
+    size_t Pos = 0;
+    bool Bitmap = false;
+
+    while (Pos < Text.size()) {
+        size_t End = Text.find('\n', Pos);
+        if (End == std::string::npos)
+            End = Text.size();
+        std::string Line = Text.substr(Pos, End - Pos);
+        Pos = End + 1;
+        if (!Line.empty() && Line.back() == '\r')
+            Line.pop_back();
+
+        if (Bitmap) {
+            if (Line == "ENDCHAR") {
+                Bitmap = false;
+                G.Present = true;
+                G.Left = Xoff;
+                G.Top = Ascent - (Yoff + G.Height);
+                if (Code >= 0)
+                    Src->Glyphs[Code] = G;
+                continue;
+            }
+            std::string Row;
+            for (int x = 0; x < G.Width; x++) {
+                char Hex[2] = {x / 4 < (int)Line.size() ? Line[x / 4] : '0', 0};
+                Row += (strtoul(Hex, NULL, 16) >> (3 - x % 4)) & 1 ? '#' : ' ';
+            }
+            G.Rows.push_back(Row);
+        } else if (sscanf(Line.c_str(), "FONT_ASCENT %d", &Ascent) == 1 ||
+                   sscanf(Line.c_str(), "FONT_DESCENT %d", &Descent) == 1) {
+        } else if (Line.compare(0, 9, "STARTCHAR") == 0) {
+            G = Glyph();
+            Code = -1;
+        } else if (sscanf(Line.c_str(), "ENCODING %ld", &Code) == 1) {
+        } else if (sscanf(Line.c_str(), "DWIDTH %d", &G.Advance) == 1) {
+        } else if (sscanf(Line.c_str(), "BBX %d %d %d %d", &G.Width, &G.Height, &Xoff, &Yoff) == 4) {
+        } else if (Line == "BITMAP") {
+            Bitmap = true;
+        }
+    }
+    if (Ascent + Descent <= 0)
+        Fail("no FONT_ASCENT/FONT_DESCENT in ", Path);
+    Src->Height = Ascent + Descent;
+}
+
+/******************************************************************************
+function: Rasterize a TTF/OTF font at a pixel size with FreeType
+******************************************************************************/
+static void LoadFreeType(const char *Path, int Pixels, const std::map<long, long> &Codes, bool Kern, Source *Src)
+{
+#ifdef FONTGEN_FREETYPE
+    FT_Library Library;
+    FT_Face Face;
+    if (FT_Init_FreeType(&Library) || FT_New_Face(Library, Path, 0, &Face))
+        Fail("cannot open ", Path);
+    if (Pixels <= 0 || FT_Set_Pixel_Sizes(Face, 0, Pixels))
+        Fail("needs a pixel size (-s) for ", Path);
+    int Ascent = (Face->size->metrics.ascender + 63) >> 6;
+    int Descent = (-Face->size->metrics.descender + 63) >> 6;
+    Src->Height = Ascent + Descent;
+
+    for (const auto &Code : Codes) {
+        long Ucs = Code.second;
+        if (FT_Get_Char_Index(Face, Ucs) == 0 ||
+            FT_Load_Char(Face, Ucs, FT_LOAD_RENDER | FT_LOAD_TARGET_MONO | FT_LOAD_MONOCHROME))
+            continue;
+        FT_GlyphSlot Slot = Face->glyph;
+        Glyph &G = Src->Glyphs[Ucs];
+        G.Present = true;
+        G.Width = Slot->bitmap.width;
+        G.Height = Slot->bitmap.rows;
+        G.Left = Slot->bitmap_left;
+        G.Top = Ascent - Slot->bitmap_top;
+        G.Advance = (Slot->advance.x + 32) >> 6;
+        for (int y = 0; y < G.Height; y++) {
+            const unsigned char *Row = Slot->bitmap.buffer + y * Slot->bitmap.pitch;
+            std::string Bits;
+            for (int x = 0; x < G.Width; x++)
+                Bits += (Row[x / 8] >> (7 - x % 8)) & 1 ? '#' : ' ';
+            G.Rows.push_back(Bits);
+        }
+    }
+
+    //Pairs of the kern table, rounded to whole pixels
+    if (Kern && FT_HAS_KERNING(Face)) {
+        for (const auto &Left : Src->Glyphs)
+            for (const auto &Right : Src->Glyphs) {
+                FT_Vector Delta;
+                if (FT_Get_Kerning(Face, FT_Get_Char_Index(Face, Left.first), FT_Get_Char_Index(Face, Right.first),
+                                   FT_KERNING_DEFAULT, &Delta) == 0 && (Delta.x + 32) >> 6 != 0)
+                    Src->Kerning[std::make_pair(Left.first, Right.first)] = (Delta.x + 32) >> 6;
+            }
+    }
+    FT_Done_Face(Face);
+    FT_Done_FreeType(Library);
+#else
+    (void)Pixels;
+    (void)Codes;
+    (void)Kern;
+    (void)Src;
+    Fail("built without FreeType, cannot read ", Path);
+#endif
+}
+
+/******************************************************************************
+function: Parse -c, e.g. "32-126,127=176,0x2190-0x2199"
+return:
+    Output code -> source code point
+******************************************************************************/
+static std::map<long, long> ParseCodes(const char *Spec)
+{
+    std::map<long, long> Codes;
+    const char *p = Spec;
+    while (*p) {
+        char *End;
+        long First = strtol(p, &End, 0), Last = First, From = First;
+        if (End == p)
+            Fail("bad -c list: ", Spec);
+        p = End;
+        if (*p == '-') {
+            Last = strtol(p + 1, &End, 0);
+            p = End;
+        } else if (*p == '=') {
+            From = strtol(p + 1, &End, 0);
+            p = End;
+        }
+        if (First < 0x20 || Last > 0x10FFFF || Last < First)
+            Fail("codes must be within 32-0x10FFFF: ", Spec);
+        for (long c = First; c <= Last; c++)
+            Codes[c] = From + (c - First);
+        if (*p == ',')
+            p++;
+        else if (*p)
+            Fail("bad -c list: ", Spec);
+    }
+    if (Codes.empty())
+        Fail("empty -c list", "");
+    return Codes;
+}
+
+/**
+ * Glyph as written: cut to its ink
+**/
+struct Output {
+    long Code;
+    long From;          //Source code point, aliases share its bitmap
+    int Width, Height, Left, Top, Advance;
+    std::vector<std::string> Rows;
+    std::vector<unsigned char> Bits;
+};
+
+static void Trim(const Source &Src, const Glyph *G, Output *Out)
+{
+    int Gap = std::max(1, RoundEven(Src.Height / 12.0));
+    int x0 = 1 << 30, x1 = -1, y0 = 1 << 30, y1 = -1;
+    if (G) {
+        for (int y = 0; y < (int)G->Rows.size(); y++)
+            for (int x = 0; x < (int)G->Rows[y].size(); x++)
+                if (G->Rows[y][x] == '#') {
+                    x0 = std::min(x0, x);
+                    x1 = std::max(x1, x);
+                    y0 = std::min(y0, y);
+                    y1 = std::max(y1, y);
+                }
+    }
+    if (x1 < 0) {
+        //Blank: only an advance
+        Out->Width = Out->Height = Out->Left = Out->Top = 0;
+        Out->Advance = Src.Table ? std::max(2, RoundEven(Src.Cell / 2.0)) : (G ? std::max(G->Advance, 0) : 0);
+        return;
+    }
+    Out->Width = x1 - x0 + 1;
+    Out->Height = y1 - y0 + 1;
+    for (int y = y0; y <= y1; y++)
+        Out->Rows.push_back(G->Rows[y].substr(x0, Out->Width));
+    if (Src.Table) {
+        Out->Left = (Gap + 1) / 2;
+        Out->Top = y0;
+        Out->Advance = Out->Left + Out->Width + Gap / 2;
+    } else {
+        Out->Left = std::max(0, G->Left + x0);
+        Out->Top = G->Top + y0;
+        Out->Advance = std::max(G->Advance, Out->Left + Out->Width);
+    }
+    if (Out->Top < 0 || Out->Top + Out->Height > Src.Height)
+        fprintf(stderr, "fontgen: glyph %ld reaches outside the line, cut\n", Out->Code);
+    while (Out->Top < 0) {
+        Out->Rows.erase(Out->Rows.begin());
+        Out->Top++;
+        Out->Height--;
+    }
+    while (Out->Height > 0 && Out->Top + Out->Height > Src.Height) {
+        Out->Rows.pop_back();
+        Out->Height--;
+    }
+    if (Out->Height <= 0)
+        Out->Width = Out->Height = Out->Top = 0;
+    if (Out->Width > 255 || Out->Height > 255 || Out->Advance > 255)
+        Fail("glyph larger than 255 pixels", "");
+}
+
+/**
+ * Kerning pair as written, by output codes
+**/
+struct Kern {
+    long Left, Right;
+    int Adjust;
+};
+
+//Column of the ink edge of a glyph on a line row, -1 without ink there
+static int InkEdge(const Output &G, int y, bool Right)
+{
+    if (y < G.Top || y >= G.Top + G.Height)
+        return -1;
+    const std::string &Row = G.Rows[y - G.Top];
+    size_t x = Right ? Row.find_last_of('#') : Row.find('#');
+    return x == std::string::npos ? -1 : G.Left + (int)x;
+}
+
+/******************************************************************************
+function: Measure kerning pairs on the bitmaps
+info:
+    For every row both characters have ink on, the rows above and below
+    included, the blank columns between the right edge of the first and
+    the left edge of the second are counted. Where the fewest of them
+    are still more than the normal spacing, Height / 12 pixels, the pair
+    is moved together by the difference, at most Height / 8. Characters
+    that share no rows, like "T.", are left as they are.
+******************************************************************************/
+static std::vector<Kern> MeasureKerning(const Source &Src, const std::vector<Output> &Glyphs)
+{
+    std::vector<Kern> Pairs;
+    int Spacing = std::max(1, RoundEven(Src.Height / 12.0));
+    int Most = std::max(1, Src.Height / 8);
+    for (const auto &A : Glyphs) {
+        if (A.Code > 0x7F || !isalnum((int)A.Code) || !A.Width)
+            continue;
+        for (const auto &B : Glyphs) {
+            if (B.Code > 0x7F || !isalnum((int)B.Code) || !B.Width)
+                continue;
+            int Gap = 1 << 30;
+            for (int y = 0; y < Src.Height; y++) {
+                int Left = InkEdge(B, y, false);
+                if (Left < 0)
+                    continue;
+                for (int dy = -1; dy <= 1; dy++) {
+                    int Right = InkEdge(A, y + dy, true);
+                    if (Right >= 0)
+                        Gap = std::min(Gap, A.Advance + Left - Right - 1);
+                }
+            }
+            if (Gap != 1 << 30 && Gap - Spacing >= std::max(2, Most))
+                Pairs.push_back({A.Code, B.Code, -std::min((Gap - Spacing + 1) / 2, Most)});
+        }
+    }
+    return Pairs;
+}
+
+static void PackBits(std::vector<unsigned char> *Bytes, const std::vector<int> &Bits)
+{
+    for (size_t i = 0; i < Bits.size(); i += 8) {
+        int Byte = 0;
+        for (size_t j = 0; j < 8; j++)
+            Byte = Byte << 1 | (i + j < Bits.size() ? Bits[i + j] : 0);
+        Bytes->push_back(Byte);
+    }
+}
+
+//FONT_ENCODING_BITS: rows packed without padding
+static void EncodeBits(Output *G)
+{
+    std::vector<int> Bits;
+    for (const auto &Row : G->Rows)
+        for (char c : Row)
+            Bits.push_back(c == '#');
+    G->Bits.clear();
+    PackBits(&G->Bits, Bits);
+}
+
+//FONT_ENCODING_ROWS: a 1 repeats the row above, a 0 starts a new row
+static void EncodeRows(Output *G)
+{
+    std::vector<int> Bits;
+    for (size_t y = 0; y < G->Rows.size(); y++) {
+        if (y && G->Rows[y] == G->Rows[y - 1]) {
+            Bits.push_back(1);
+            continue;
+        }
+        Bits.push_back(0);
+        for (char c : G->Rows[y])
+            Bits.push_back(c == '#');
+    }
+    G->Bits.clear();
+    PackBits(&G->Bits, Bits);
+}
+
+static std::string Label(long Code)
+{
+    char Buf[24];
+    if (Code == 0x7F)
+        return "degree sign";
+    if (Code < 0x7F) {
+        snprintf(Buf, sizeof(Buf), "'%c'", (char)Code);
+        return Buf;
+    }
+    snprintf(Buf, sizeof(Buf), "U+%04lX", Code);
+    return Buf;
+}
+
+static void WriteBytes(std::string *Out, const unsigned char *Bytes, size_t Len)
+{
+    char Buf[8];
+    for (size_t i = 0; i < Len; i += 16) {
+        *Out += "\t";
+        for (size_t j = i; j < Len && j < i + 16; j++) {
+            snprintf(Buf, sizeof(Buf), j == i ? "0x%02X," : " 0x%02X,", Bytes[j]);
+            *Out += Buf;
+        }
+        *Out += "\n";
+    }
+}
+
+/******************************************************************************
+function: Write a proportional font: tight bitmaps and the sGLYPH index
+info:
+    Glyphs are sorted by code. Codes up to 0x7F are indexed from First to
+    Last, the rest through runs of consecutive codes in Ranges. Codes
+    taken from the same source glyph share one bitmap.
+******************************************************************************/
+static std::string WriteProportional(const std::string &File, const std::string &Name, const Source &Src,
+                                     std::vector<Output> &Glyphs, bool Rows, long Fallback,
+                                     const std::vector<Kern> &Pairs, const std::string &Command)
+{
+    std::string Out, Index, Line;
+    char Buf[256];
+    size_t Offset = 0;
+    int Widest = 0;
+
+    Out += "/**\n  ******************************************************************************\n";
+    Out += "  * @file    " + File + "\n";
+    if (Src.Table)
+        Out += "  * @brief   Proportional version of " + Src.Description + ": every glyph is cut to its ink\n";
+    else
+        Out += "  * @brief   " + Src.Description + ": every glyph is cut to its ink\n";
+    Out += "  *          and packed without row padding, see sGLYPH in fonts.h.\n";
+    if (Rows)
+        Out += "  *          Rows equal to the one above are stored as a single bit\n"
+               "  *          (FONT_ENCODING_ROWS).\n";
+    Out += "  *          Generated by tools/fontgen, do not edit:\n";
+    Out += "  *          " + Command + "\n";
+    Out += "  ******************************************************************************\n  */\n\n";
+    Out += "#include \"fonts.h\"\n\nconst uint8_t " + Name + "_Table[] =\n{\n";
+
+    bool First = true;
+    std::map<long, size_t> Shared;
+    for (auto &G : Glyphs) {
+        Widest = std::max(Widest, G.Advance);
+        auto Alias = Shared.find(G.From);
+        snprintf(Buf, sizeof(Buf), "\t{%zu, %d, %d, %d, %d, %d}, // %s\n",
+                 Alias != Shared.end() ? Alias->second : Offset,
+                 G.Width, G.Height, G.Left, G.Top, G.Advance, Label(G.Code).c_str());
+        Index += Buf;
+        if (!G.Width || Alias != Shared.end())
+            continue;
+        Shared[G.From] = Offset;
+        if (!First)
+            Out += "\n";
+        First = false;
+        snprintf(Buf, sizeof(Buf), "\t// @%zu %s (%dx%d)\n", Offset, Label(G.Code).c_str(), G.Width, G.Height);
+        Out += Buf;
+        for (const auto &Row : G.Rows)
+            Out += "\t//" + Row + "\n";
+        WriteBytes(&Out, G.Bits.data(), G.Bits.size());
+        Offset += G.Bits.size();
+    }
+    if (Offset > 0xFFFF)
+        Fail("font table larger than 64 KB", "");
+    if (First)
+        Out += "\t0x00,\n";
+    Out += "};\n\nconst sGLYPH " + Name + "_Glyphs[] =\n{\n\t//Offset, Width, Height, Left, Top, Advance\n";
+    Out += Index;
+    Out += "};\n";
+
+    //A subset has gaps between First and Last, a bit per code marks the glyphs
+    size_t Ascii = 0;
+    while (Ascii < Glyphs.size() && Glyphs[Ascii].Code <= 0x7F)
+        Ascii++;
+    long First_Code = Ascii ? Glyphs.front().Code : 0x01, Last_Code = Ascii ? Glyphs[Ascii - 1].Code : 0x00;
+    bool Subset = (long)Ascii != Last_Code - First_Code + 1;
+    size_t Map_Words = (Last_Code - First_Code) / 32 + 1;
+    if (Subset) {
+        std::vector<unsigned long> Map(Map_Words, 0);
+        for (size_t i = 0; i < Ascii; i++)
+            Map[(Glyphs[i].Code - First_Code) / 32] |= 1UL << ((Glyphs[i].Code - First_Code) % 32);
+        Out += "\nconst uint32_t " + Name + "_Map[] =\n{\n\t";
+        for (size_t i = 0; i < Map_Words; i++) {
+            snprintf(Buf, sizeof(Buf), i ? " 0x%08lX," : "0x%08lX,", Map[i]);
+            Out += Buf;
+        }
+        Out += "\n};\n";
+    }
+
+    //The other codes in runs: first code, length and glyph index
+    size_t Ranges = 0;
+    for (size_t i = Ascii; i < Glyphs.size(); ) {
+        size_t End = i + 1;
+        while (End < Glyphs.size() && Glyphs[End].Code == Glyphs[End - 1].Code + 1 && End - i < 0xFFFF)
+            End++;
+        if (!Ranges++)
+            Out += "\nconst sRANGE " + Name + "_Ranges[] =\n{\n\t//First, Count, Index\n";
+        snprintf(Buf, sizeof(Buf), "\t{0x%04lX, %zu, %zu}, // %s\n", Glyphs[i].Code, End - i, i,
+                 (End - i > 1 ? Label(Glyphs[i].Code) + " to " + Label(Glyphs[End - 1].Code)
+                              : Label(Glyphs[i].Code)).c_str());
+        Out += Buf;
+        i = End;
+    }
+    if (Ranges)
+        Out += "};\n";
+
+    //Kerning pairs, sorted for the binary search
+    if (!Pairs.empty()) {
+        Out += "\nconst sKERN " + Name + "_Kerning[] =\n{\n\t//Left, Right, Adjust\n";
+        for (const auto &Pair : Pairs) {
+            snprintf(Buf, sizeof(Buf), "\t{0x%02lX, 0x%02lX, %d}, // %s %s\n", Pair.Left, Pair.Right, Pair.Adjust,
+                     Label(Pair.Left).c_str(), Label(Pair.Right).c_str());
+            Out += Buf;
+        }
+        Out += "};\n";
+    }
+
+    std::string Fallback_Text = "0, /* Fallback: none */";
+    if (Fallback) {
+        if (Fallback > ' ' && Fallback < 0x7F && Fallback != '\'' && Fallback != '\\')
+            snprintf(Buf, sizeof(Buf), "'%c', /* Fallback */", (int)Fallback);
+        else
+            snprintf(Buf, sizeof(Buf), "0x%02lX, /* Fallback */", Fallback);
+        Fallback_Text = Buf;
+    }
+    snprintf(Buf, sizeof(Buf), "\nsFONT %s = {\n  %s_Table,\n  %d, /* Width */\n  %d, /* Height */\n"
+             "  %s_Glyphs,\n  0x%02lX, /* First */\n  0x%02lX, /* Last */\n  %s,\n",
+             Name.c_str(), Name.c_str(), Widest, Src.Height, Name.c_str(), First_Code, Last_Code,
+             Rows ? "FONT_ENCODING_ROWS" : "FONT_ENCODING_BITS");
+    Out += Buf;
+    Out += Subset ? "  " + Name + "_Map,\n" : "  0, /* Map: every code from First to Last */\n";
+    Out += "  " + Fallback_Text + "\n";
+    if (Ranges) {
+        snprintf(Buf, sizeof(Buf), "  %s_Ranges,\n  %zu, /* RangeCount */\n", Name.c_str(), Ranges);
+        Out += Buf;
+    } else {
+        Out += "  0, /* Ranges: none past Last */\n  0, /* RangeCount */\n";
+    }
+    if (!Pairs.empty()) {
+        snprintf(Buf, sizeof(Buf), "  %s_Kerning,\n  %zu, /* KernCount */\n", Name.c_str(), Pairs.size());
+        Out += Buf;
+    } else {
+        Out += "  0, /* Kerning: none */\n  0, /* KernCount */\n";
+    }
+    Out += "};\n";
+    fprintf(stderr, "fontgen: %s %zu bytes of bitmaps, %zu of index\n", Name.c_str(), Offset,
+            Glyphs.size() * 8 + (Subset ? Map_Words * 4 : 0) + Ranges * 8 + Pairs.size() * 6);
+    return Out;
+}
+
+/******************************************************************************
+function: Write a monospaced font in the legacy format
+info:
+    Every glyph is a cell as wide as the widest advance and a line high,
+    rows padded to whole bytes. Only contiguous codes from ' ' are
+    allowed, as the renderer indexes the table from ' '.
+******************************************************************************/
+static std::string WriteMonospaced(const std::string &File, const std::string &Name, const Source &Src,
+                                   const std::vector<Output> &Glyphs, const std::string &Command)
+{
+    std::string Out;
+    char Buf[256];
+    int Cell = 0;
+    for (const auto &G : Glyphs)
+        Cell = std::max(Cell, G.Advance);
+    int Row_Bytes = (Cell + 7) / 8;
+    if (Glyphs.front().Code != ' ' || Glyphs.back().Code > 0x7F)
+        Fail("monospaced fonts hold codes 32 to 127", "");
+
+    Out += "/**\n  ******************************************************************************\n";
+    Out += "  * @file    " + File + "\n";
+    Out += "  * @brief   " + Src.Description + ", monospaced.\n";
+    Out += "  *          Generated by tools/fontgen, do not edit:\n";
+    Out += "  *          " + Command + "\n";
+    Out += "  ******************************************************************************\n  */\n\n";
+    Out += "#include \"fonts.h\"\n\nconst uint8_t " + Name + "_Table[] =\n{\n";
+    for (size_t g = 0; g < Glyphs.size(); g++) {
+        const Output &G = Glyphs[g];
+        snprintf(Buf, sizeof(Buf), "%s\t// @%zu %s (%d pixels wide)\n", g ? "\n" : "",
+                 g * Row_Bytes * Src.Height, Label(G.Code).c_str(), Cell);
+        Out += Buf;
+        //Centre the ink of glyphs narrower than the cell
+        int Left = (Cell - G.Advance) / 2 + G.Left;
+        for (int y = 0; y < Src.Height; y++) {
+            std::string Row(Cell, ' ');
+            if (y >= G.Top && y < G.Top + G.Height)
+                Row.replace(Left, G.Width, G.Rows[y - G.Top]);
+            Out += "\t";
+            for (int b = 0; b < Row_Bytes; b++) {
+                int Byte = 0;
+                for (int x = b * 8; x < b * 8 + 8; x++)
+                    Byte = Byte << 1 | (x < Cell && Row[x] == '#');
+                snprintf(Buf, sizeof(Buf), "0x%02X, ", Byte);
+                Out += Buf;
+            }
+            Out += "//" + Row + "\n";
+        }
+    }
+    snprintf(Buf, sizeof(Buf), "};\n\nsFONT %s = {\n  %s_Table,\n  %d, /* Width */\n  %d, /* Height */\n",
+             Name.c_str(), Name.c_str(), Cell, Src.Height);
+    Out += Buf;
+    Out += "  0, /* Glyphs: cells of Width from ' ' */\n  0, /* First */\n  0, /* Last */\n"
+           "  FONT_ENCODING_BITS,\n  0, /* Map */\n  0, /* Fallback */\n  0, /* Ranges */\n"
+           "  0, /* RangeCount */\n  0, /* Kerning: none */\n  0, /* KernCount */\n};\n";
+    fprintf(stderr, "fontgen: %s %zu bytes\n", Name.c_str(), Glyphs.size() * Row_Bytes * Src.Height);
+    return Out;
+}
+
+static void Usage()
+{
+    fprintf(stderr, "usage: fontgen [-n NAME] [-o FILE] [-s PIXELS] [-c CODES] [-f CODE] [-e BITS|ROWS|AUTO] [-m] [-k] SOURCE\n"
+                    "SOURCE is a .bdf, a .ttf/.otf (FreeType builds) or a monospaced table from lib/Fonts\n");
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    std::string Name, File, Encoding = "BITS", Spec, Path;
+    int Pixels = 0;
+    long Fallback = -1;
+    bool Mono = false;
+    bool Kerning = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string Arg = argv[i];
+        auto Value = [&]() -> std::string {
+            if (i + 1 >= argc)
+                Usage();
+            return argv[++i];
+        };
+        if (Arg == "-n")
+            Name = Value();
+        else if (Arg == "-o")
+            File = Value();
+        else if (Arg == "-s")
+            Pixels = atoi(Value().c_str());
+        else if (Arg == "-c")
+            Spec = Value();
+        else if (Arg == "-e")
+            Encoding = Value();
+        else if (Arg == "-f")
+            Fallback = strtol(Value().c_str(), NULL, 0);
+        else if (Arg == "-m")
+            Mono = true;
+        else if (Arg == "-k")
+            Kerning = true;
+        else if (Arg[0] == '-' || !Path.empty())
+            Usage();
+        else
+            Path = Arg;
+    }
+    if (Path.empty())
+        Usage();
+    for (auto &c : Encoding)
+        c = toupper((unsigned char)c);
+    if (Encoding != "BITS" && Encoding != "ROWS" && Encoding != "AUTO")
+        Usage();
+    if (Name.empty()) {
+        if (File.empty())
+            Usage();
+        Name = BaseName(File);
+        Name = Name.substr(0, Name.find('.'));
+        Name[0] = toupper((unsigned char)Name[0]);
+        for (auto &c : Name)
+            if (!isalnum((unsigned char)c))
+                c = '_';
+        if (!Name.empty() && isalpha((unsigned char)Name.back()))
+            Name.back() = toupper((unsigned char)Name.back());
+    }
+
+    //The command line goes into the file, without directories
+    std::string Command = "fontgen";
+    if (Mono)
+        Command += " -m";
+    if (Kerning)
+        Command += " -k";
+    if (Encoding != "BITS")
+        Command += " -e " + Encoding;
+    if (Pixels)
+        Command += " -s " + std::to_string(Pixels);
+    if (!Spec.empty())
+        Command += " -c " + Spec;
+    if (Fallback >= 0)
+        Command += " -f " + std::to_string(Fallback);
+    Command += " -n " + Name;
+    if (!File.empty())
+        Command += " -o " + BaseName(File);
+    Command += " " + BaseName(Path);
+
+    Source Src;
+    std::string Base = BaseName(Path);
+    bool Table = EndsWith(Path, ".cpp") || EndsWith(Path, ".c");
+    const char *Default = Mono ? (Table ? "32-127" : "32-126,127=176")
+                               : (Table ? "32-127,176=127" : "32-126,127=176,176");
+    std::map<long, long> Codes = ParseCodes(!Spec.empty() ? Spec.c_str() : Default);
+    if (Table) {
+        LoadTable(Path.c_str(), &Src);
+        //font24.cpp holds Font24
+        Src.Description = "Font" + std::to_string(Src.Height);
+    } else if (EndsWith(Path, ".bdf")) {
+        LoadBDF(Path.c_str(), &Src);
+        Src.Description = Base + " at " + std::to_string(Src.Height) + " px";
+    } else {
+        LoadFreeType(Path.c_str(), Pixels, Codes, Kerning, &Src);
+        Src.Description = Base + " at " + std::to_string(Pixels) + " px";
+    }
+
+    //A proportional font only holds the codes asked for that the source
+    //has; a monospaced table needs every code, the others are left blank
+    std::vector<Output> Glyphs;
+    int Missing = 0;
+    const Glyph *Space = Src.Glyphs.count(' ') ? &Src.Glyphs[' '] : NULL;
+    if (Mono && Codes.rbegin()->first > 0x7F)
+        Fail("monospaced fonts hold codes 32 to 127", "");
+    if (Mono && Kerning)
+        Fail("monospaced fonts are not kerned", "");
+    for (long c = Codes.begin()->first; c <= Codes.rbegin()->first; c++) {
+        auto Code = Codes.find(c);
+        if (Code == Codes.end() && !Mono) {
+            //Jump over the gap
+            c = Codes.upper_bound(c)->first - 1;
+            continue;
+        }
+        Output G;
+        G.Code = c;
+        G.From = Code != Codes.end() ? Code->second : c;
+        auto Found = Code == Codes.end() ? Src.Glyphs.end() : Src.Glyphs.find(Code->second);
+        if (Found == Src.Glyphs.end() && Code != Codes.end())
+            Missing++;
+        if (Found == Src.Glyphs.end() && !Mono)
+            continue;
+        Trim(Src, Found != Src.Glyphs.end() ? &Found->second : Space, &G);
+        if (Found == Src.Glyphs.end())
+            G.Width = G.Height = G.Left = G.Top = 0, G.Rows.clear();
+        Glyphs.push_back(G);
+    }
+    if (Missing)
+        fprintf(stderr, "fontgen: %d codes have no glyph in %s, left %s\n", Missing, Base.c_str(),
+                Mono ? "blank" : "out");
+    if (Glyphs.empty())
+        Fail("no glyphs in ", Base.c_str());
+    if (Fallback < 0)
+        Fallback = std::any_of(Glyphs.begin(), Glyphs.end(), [](const Output &G) { return G.Code == '?'; }) ? '?' : 0;
+    else if (Fallback > 0xFF ||
+             !std::any_of(Glyphs.begin(), Glyphs.end(), [&](const Output &G) { return G.Code == Fallback; }))
+        Fail("the fallback is not in the font, or past 255", "");
+    if (Glyphs.size() > 0xFFFF)
+        Fail("more than 65535 glyphs", "");
+
+    //Decoded glyphs have to fit the renderer's 32 x GLYPH_ROWS buffers
+    bool Fits = true;
+    for (const auto &G : Glyphs)
+        Fits = Fits && G.Width <= 32 && G.Height <= 32;
+    if (Encoding == "ROWS" && !Fits)
+        Fail("FONT_ENCODING_ROWS glyphs are at most 32 x 32 pixels", "");
+
+    bool Rows = Encoding == "ROWS";
+    if (Encoding == "AUTO" && Fits) {
+        size_t Plain = 0, Packed = 0;
+        for (auto &G : Glyphs) {
+            EncodeBits(&G);
+            Plain += G.Bits.size();
+            EncodeRows(&G);
+            Packed += G.Bits.size();
+        }
+        Rows = Packed < Plain;
+    }
+    for (auto &G : Glyphs)
+        Rows ? EncodeRows(&G) : EncodeBits(&G);
+
+    //Kerning from the kern table, taken over by every code sharing a glyph,
+    //or else measured
+    std::vector<Kern> Pairs;
+    if (Kerning && !Src.Kerning.empty()) {
+        for (const auto &A : Glyphs)
+            for (const auto &B : Glyphs) {
+                auto Found = Src.Kerning.find(std::make_pair(A.From, B.From));
+                if (Found != Src.Kerning.end() && A.Code <= 0xFFFF && B.Code <= 0xFFFF)
+                    Pairs.push_back({A.Code, B.Code, std::max(-128, std::min(127, Found->second))});
+            }
+    } else if (Kerning) {
+        Pairs = MeasureKerning(Src, Glyphs);
+    }
+    if (Pairs.size() > 0xFFFF)
+        Fail("more than 65535 kerning pairs", "");
+
+    std::string Text = Mono ? WriteMonospaced(File.empty() ? Name + ".cpp" : BaseName(File), Name, Src, Glyphs, Command)
+                            : WriteProportional(File.empty() ? Name + ".cpp" : BaseName(File), Name, Src, Glyphs,
+                                                Rows, Fallback, Pairs, Command);
+    FILE *f = File.empty() ? stdout : fopen(File.c_str(), "wb");
+    if (!f)
+        Fail("cannot write ", File.c_str());
+    fwrite(Text.data(), 1, Text.size(), f);
+    if (f != stdout)
+        fclose(f);
+    return 0;
+}